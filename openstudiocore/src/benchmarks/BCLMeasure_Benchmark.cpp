@@ -0,0 +1,80 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../utilities/bcl/BCLMeasure.hpp"
+#include "../utilities/core/PathHelpers.hpp"
+#include "../utilities/core/Filesystem.hpp"
+
+#include <resources.hxx>
+
+#include <ctime>
+
+using namespace openstudio;
+
+// state.range(0) is 0 to remove the checksum cache before every check, 1 to keep it
+static void BM_BCLMeasure_CheckForUpdatesFiles(benchmark::State& state)
+{
+  boost::optional<BCLMeasure> source = BCLMeasure::load(resourcesPath() / toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/"));
+  if (!source){
+    state.SkipWithError("Unable to load measure");
+    return;
+  }
+
+  openstudio::path dir = openstudio::filesystem::temp_directory_path() / toPath("BM_BCLMeasure_CheckForUpdatesFiles");
+  removeDirectory(dir);
+  boost::optional<BCLMeasure> measure = source->clone(dir);
+  if (!measure){
+    state.SkipWithError("Unable to clone measure");
+    return;
+  }
+
+  // freshly written files are never cached
+  std::time_t anHourAgo = std::time(nullptr) - 3600;
+  for (const BCLFileReference& file : measure->files()){
+    openstudio::filesystem::last_write_time(file.path(), anHourAgo);
+  }
+  measure->checkForUpdatesFiles();
+
+  openstudio::path cachePath = dir / toPath(".measure_checksums");
+  while (state.KeepRunning()){
+    if (state.range(0) == 0){
+      state.PauseTiming();
+      openstudio::filesystem::remove(cachePath);
+      state.ResumeTiming();
+    }
+    benchmark::DoNotOptimize(measure->checkForUpdatesFiles());
+  }
+
+  state.SetItemsProcessed(state.iterations() * measure->files().size());
+  measure.reset();
+  removeDirectory(dir);
+}
+BENCHMARK(BM_BCLMeasure_CheckForUpdatesFiles)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
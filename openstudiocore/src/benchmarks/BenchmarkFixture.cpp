@@ -0,0 +1,203 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "BenchmarkFixture.hpp"
+
+#include "../model/Building.hpp"
+#include "../model/BuildingStory.hpp"
+#include "../model/Construction.hpp"
+#include "../model/DefaultConstructionSet.hpp"
+#include "../model/DefaultSubSurfaceConstructions.hpp"
+#include "../model/DefaultSurfaceConstructions.hpp"
+#include "../model/Lights.hpp"
+#include "../model/LightsDefinition.hpp"
+#include "../model/Material.hpp"
+#include "../model/People.hpp"
+#include "../model/PeopleDefinition.hpp"
+#include "../model/ScheduleRuleset.hpp"
+#include "../model/SimpleGlazing.hpp"
+#include "../model/Space.hpp"
+#include "../model/SpaceType.hpp"
+#include "../model/StandardOpaqueMaterial.hpp"
+#include "../model/Surface.hpp"
+#include "../model/ThermalZone.hpp"
+#include "../model/ZoneHVACIdealLoadsAirSystem.hpp"
+
+#include "../energyplus/ForwardTranslator.hpp"
+
+#include "../utilities/core/Assert.hpp"
+#include "../utilities/geometry/Point3d.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <map>
+#include <sstream>
+
+namespace openstudio {
+namespace benchmarks {
+
+  openstudio::model::Model syntheticModel(unsigned numSpaces)
+  {
+    using namespace openstudio::model;
+
+    const unsigned spacesPerRow = 10;
+    const unsigned spacesPerStory = spacesPerRow * spacesPerRow;
+    const double width = 10.0;
+    const double height = 3.0;
+
+    Model model;
+
+    ScheduleRuleset occupancySchedule(model, 0.5);
+    occupancySchedule.setName("Occupancy Schedule");
+    ScheduleRuleset activitySchedule(model, 120.0);
+    activitySchedule.setName("Activity Schedule");
+
+    SpaceType spaceType(model);
+    spaceType.setName("Office");
+
+    LightsDefinition lightsDefinition(model);
+    lightsDefinition.setWattsperSpaceFloorArea(10.0);
+    Lights lights(lightsDefinition);
+    lights.setSpaceType(spaceType);
+    lights.setSchedule(occupancySchedule);
+
+    PeopleDefinition peopleDefinition(model);
+    peopleDefinition.setPeopleperSpaceFloorArea(0.05);
+    People people(peopleDefinition);
+    people.setSpaceType(spaceType);
+    people.setNumberofPeopleSchedule(occupancySchedule);
+    people.setActivityLevelSchedule(activitySchedule);
+
+    StandardOpaqueMaterial opaqueMaterial(model, "MediumRough", 0.2, 1.0, 2000.0, 900.0);
+    Construction opaqueConstruction(model);
+    opaqueConstruction.setLayers(std::vector<Material>(1, opaqueMaterial));
+
+    SimpleGlazing glazing(model, 2.0, 0.4);
+    glazing.setVisibleTransmittance(0.6);
+    Construction windowConstruction(model);
+    windowConstruction.setLayers(std::vector<Material>(1, glazing));
+
+    DefaultSurfaceConstructions surfaceConstructions(model);
+    surfaceConstructions.setFloorConstruction(opaqueConstruction);
+    surfaceConstructions.setWallConstruction(opaqueConstruction);
+    surfaceConstructions.setRoofCeilingConstruction(opaqueConstruction);
+
+    DefaultSubSurfaceConstructions subSurfaceConstructions(model);
+    subSurfaceConstructions.setFixedWindowConstruction(windowConstruction);
+
+    DefaultConstructionSet constructionSet(model);
+    constructionSet.setDefaultExteriorSurfaceConstructions(surfaceConstructions);
+    constructionSet.setDefaultInteriorSurfaceConstructions(surfaceConstructions);
+    constructionSet.setDefaultGroundContactSurfaceConstructions(surfaceConstructions);
+    constructionSet.setDefaultExteriorSubSurfaceConstructions(subSurfaceConstructions);
+
+    Building building = model.getUniqueModelObject<Building>();
+    building.setSpaceType(spaceType);
+    building.setDefaultConstructionSet(constructionSet);
+
+    boost::optional<BuildingStory> story;
+    for (unsigned i = 0; i < numSpaces; ++i){
+      unsigned storyIndex = i / spacesPerStory;
+      unsigned x = (i % spacesPerStory) % spacesPerRow;
+      unsigned y = (i % spacesPerStory) / spacesPerRow;
+      double z = storyIndex * height;
+
+      if (i % spacesPerStory == 0){
+        story = BuildingStory(model);
+        story->setName("Story " + boost::lexical_cast<std::string>(storyIndex + 1));
+        story->setNominalZCoordinate(z);
+        story->setNominalFloortoFloorHeight(height);
+      }
+
+      std::vector<Point3d> floorPrint;
+      floorPrint.push_back(Point3d(x * width, (y + 1) * width, z));
+      floorPrint.push_back(Point3d((x + 1) * width, (y + 1) * width, z));
+      floorPrint.push_back(Point3d((x + 1) * width, y * width, z));
+      floorPrint.push_back(Point3d(x * width, y * width, z));
+
+      boost::optional<Space> space = Space::fromFloorPrint(floorPrint, height, model);
+      OS_ASSERT(space);
+      space->setName("Space " + boost::lexical_cast<std::string>(i + 1));
+      space->setBuildingStory(*story);
+
+      ThermalZone thermalZone(model);
+      thermalZone.setName("Zone " + boost::lexical_cast<std::string>(i + 1));
+      space->setThermalZone(thermalZone);
+
+      ZoneHVACIdealLoadsAirSystem idealLoads(model);
+      idealLoads.addToThermalZone(thermalZone);
+
+      for (Surface surface : space->surfaces()){
+        if (surface.surfaceType() == "Wall"){
+          surface.setWindowToWallRatio(0.3);
+        }
+      }
+    }
+
+    return model;
+  }
+
+  const std::string& syntheticOsm(unsigned numSpaces)
+  {
+    static std::map<unsigned, std::string> cache;
+
+    auto it = cache.find(numSpaces);
+    if (it == cache.end()){
+      std::stringstream ss;
+      ss << syntheticModel(numSpaces);
+      it = cache.insert(std::make_pair(numSpaces, ss.str())).first;
+    }
+    return it->second;
+  }
+
+  const std::string& syntheticIdf(unsigned numSpaces)
+  {
+    static std::map<unsigned, std::string> cache;
+
+    auto it = cache.find(numSpaces);
+    if (it == cache.end()){
+      openstudio::energyplus::ForwardTranslator forwardTranslator;
+      std::stringstream ss;
+      ss << forwardTranslator.translateModel(syntheticModel(numSpaces));
+      it = cache.insert(std::make_pair(numSpaces, ss.str())).first;
+    }
+    return it->second;
+  }
+
+  openstudio::path benchmarkOutputDir()
+  {
+    openstudio::path result = openstudio::toPath("./openstudio_benchmarks_output");
+    if (!openstudio::filesystem::exists(result)){
+      openstudio::filesystem::create_directories(result);
+    }
+    return result;
+  }
+
+} // benchmarks
+} // openstudio
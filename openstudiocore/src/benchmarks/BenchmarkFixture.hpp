@@ -0,0 +1,59 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef BENCHMARKS_BENCHMARKFIXTURE_HPP
+#define BENCHMARKS_BENCHMARKFIXTURE_HPP
+
+#include "../model/Model.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <string>
+
+namespace openstudio {
+namespace benchmarks {
+
+  /** Returns a deterministic model with numSpaces 10 m x 10 m spaces arranged in a grid of up to 10 by 10
+   *  spaces per story.  Each space has its own thermal zone with ideal loads, a shared space type with
+   *  lights and people, a shared construction set, and 30% window to wall ratio on exterior walls.
+   *  Surfaces are not matched. */
+  openstudio::model::Model syntheticModel(unsigned numSpaces);
+
+  /// Returns syntheticModel(numSpaces) serialized as an osm, cached per numSpaces
+  const std::string& syntheticOsm(unsigned numSpaces);
+
+  /// Returns syntheticModel(numSpaces) forward translated to an EnergyPlus idf, cached per numSpaces
+  const std::string& syntheticIdf(unsigned numSpaces);
+
+  /// Directory for files written by benchmarks, created on first use
+  openstudio::path benchmarkOutputDir();
+
+} // benchmarks
+} // openstudio
+
+#endif // BENCHMARKS_BENCHMARKFIXTURE_HPP
@@ -0,0 +1,81 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../utilities/core/Checksum.hpp"
+
+#include <boost/crc.hpp>
+
+#include <algorithm>
+#include <string>
+
+using namespace openstudio;
+
+// idf like text with windows line endings
+static std::string checksumText(size_t size)
+{
+  std::string line = "  OS:Space,{00000000-0000-0000-0000-000000000000}, Space 1, 3.048;\r\n";
+  std::string text;
+  text.reserve(size + line.size());
+  while (text.size() < size){
+    text += line;
+  }
+  text.resize(size);
+  return text;
+}
+
+// previous implementation, copies 1 KB chunks, removes carriage returns, and runs the bytewise boost crc
+static unsigned bytewiseChecksum(const std::string& text)
+{
+  boost::crc_32_type crc;
+  for (size_t pos = 0; pos < text.size(); pos += 1024){
+    std::string str = text.substr(pos, 1024);
+    str.erase(std::remove(str.begin(), str.end(), '\r'), str.end());
+    crc.process_bytes(str.c_str(), str.size());
+  }
+  return crc.checksum();
+}
+
+// state.range(0) is 0 for the bytewise reference, 1 for checksum; state.range(1) is the size in bytes
+static void BM_Checksum(benchmark::State& state)
+{
+  std::string text = checksumText(static_cast<size_t>(state.range(1)));
+
+  while (state.KeepRunning()){
+    if (state.range(0) == 0){
+      benchmark::DoNotOptimize(bytewiseChecksum(text));
+    } else {
+      benchmark::DoNotOptimize(checksum(text));
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_Checksum)->Ranges({{0, 1}, {1 << 10, 1 << 24}})->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,112 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../utilities/filetypes/EpwFile.hpp"
+#include "../utilities/core/Filesystem.hpp"
+
+#include <resources.hxx>
+
+#include <sstream>
+
+using namespace openstudio;
+
+static const std::string& epwText()
+{
+  static std::string text;
+  if (text.empty()){
+    openstudio::filesystem::ifstream file(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw"));
+    std::stringstream ss;
+    ss << file.rdbuf();
+    text = ss.str();
+  }
+  return text;
+}
+
+// state.range(0) is the number of files parsed per iteration, state.range(1) is storeData
+static void BM_EpwFile_LoadFromString(benchmark::State& state)
+{
+  const std::string& text = epwText();
+  if (text.empty()){
+    state.SkipWithError("Unable to read epw file");
+    return;
+  }
+
+  while (state.KeepRunning()){
+    for (int64_t i = 0; i < state.range(0); ++i){
+      boost::optional<EpwFile> epwFile = EpwFile::loadFromString(text, state.range(1) != 0);
+      benchmark::DoNotOptimize(epwFile);
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0) * text.size());
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_EpwFile_LoadFromString)->Ranges({{1, 8}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+// state.range(0) is 0 to compute wet bulb temperatures point by point through AirState, 1 to use the batched functions
+static void BM_EpwFile_WetBulb(benchmark::State& state)
+{
+  boost::optional<EpwFile> epwFile = EpwFile::loadFromString(epwText(), true);
+  if (!epwFile){
+    state.SkipWithError("Unable to load epw file");
+    return;
+  }
+
+  std::vector<double> drybulb;
+  std::vector<double> relativeHumidity;
+  std::vector<double> pressure;
+  for (const EpwDataPoint& point : epwFile->data()){
+    drybulb.push_back(point.dryBulbTemperature().get_value_or(0.0));
+    relativeHumidity.push_back(point.relativeHumidity().get_value_or(0.0));
+    pressure.push_back(point.atmosphericStationPressure().get_value_or(101325.0));
+  }
+  size_t n = drybulb.size();
+  std::vector<double> vaporPressure(n);
+  std::vector<double> humidityRatio(n);
+  std::vector<double> wetbulb(n);
+
+  while (state.KeepRunning()){
+    if (state.range(0) == 0){
+      for (size_t i = 0; i < n; ++i){
+        boost::optional<AirState> airState = AirState::fromDryBulbRelativeHumidityPressure(drybulb[i], relativeHumidity[i], pressure[i]);
+        wetbulb[i] = airState ? airState->wetbulb() : 0.0;
+      }
+    } else {
+      computeVaporPressuresFromRelativeHumidity(drybulb.data(), relativeHumidity.data(), vaporPressure.data(), n);
+      computeHumidityRatios(vaporPressure.data(), pressure.data(), humidityRatio.data(), n);
+      computeWetBulbs(drybulb.data(), humidityRatio.data(), pressure.data(), wetbulb.data(), n);
+    }
+    benchmark::DoNotOptimize(wetbulb.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_EpwFile_WetBulb)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,178 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkFixture.hpp"
+
+#include "../model/Model.hpp"
+#include "../model/ModelMerger.hpp"
+#include "../model/Space.hpp"
+#include "../model/ThreeJSReverseTranslator.hpp"
+#include "../utilities/geometry/FloorplanJS.hpp"
+#include "../utilities/geometry/ThreeJS.hpp"
+
+#include <jsoncpp/json.h>
+
+using namespace openstudio;
+using namespace openstudio::benchmarks;
+
+// numStories stories of 10 adjacent 10 m x 10 m spaces, wallOffset moves the wall between the first two spaces of the top story
+static std::string syntheticFloorplan(unsigned numStories, double wallOffset)
+{
+  const unsigned spacesPerStory = 10;
+  const double width = 10.0;
+
+  unsigned lastId = 0;
+  auto nextId = [&lastId]() { return std::to_string(++lastId); };
+
+  Json::Value floorplan(Json::objectValue);
+  floorplan["project"]["config"]["units"] = "m";
+
+  Json::Value stories(Json::arrayValue);
+  for (unsigned storyIdx = 0; storyIdx < numStories; ++storyIdx){
+    Json::Value story(Json::objectValue);
+    story["id"] = nextId();
+    story["name"] = "Story " + std::to_string(storyIdx + 1);
+    story["below_floor_plenum_height"] = 0.0;
+    story["floor_to_ceiling_height"] = 3.0;
+    story["above_ceiling_plenum_height"] = 0.0;
+    story["windows"] = Json::Value(Json::arrayValue);
+    story["shading"] = Json::Value(Json::arrayValue);
+
+    // vertices along the bottom and top of the row of spaces
+    std::vector<std::string> bottomIds;
+    std::vector<std::string> topIds;
+    Json::Value vertices(Json::arrayValue);
+    for (unsigned i = 0; i <= spacesPerStory; ++i){
+      double x = width * i;
+      if ((i == 1) && (storyIdx + 1 == numStories)){
+        x += wallOffset;
+      }
+      for (double y : {0.0, width}){
+        Json::Value vertex(Json::objectValue);
+        vertex["id"] = nextId();
+        vertex["x"] = x;
+        vertex["y"] = y;
+        vertices.append(vertex);
+        (y == 0.0 ? bottomIds : topIds).push_back(vertex["id"].asString());
+      }
+    }
+
+    Json::Value edges(Json::arrayValue);
+    auto addEdge = [&edges, &nextId](const std::string& v1, const std::string& v2) {
+      Json::Value edge(Json::objectValue);
+      edge["id"] = nextId();
+      edge["vertex_ids"].append(v1);
+      edge["vertex_ids"].append(v2);
+      edges.append(edge);
+      return edge["id"].asString();
+    };
+
+    std::vector<std::string> verticalIds;
+    for (unsigned i = 0; i <= spacesPerStory; ++i){
+      verticalIds.push_back(addEdge(bottomIds[i], topIds[i]));
+    }
+
+    Json::Value faces(Json::arrayValue);
+    Json::Value spaces(Json::arrayValue);
+    for (unsigned i = 0; i < spacesPerStory; ++i){
+      std::string bottomId = addEdge(bottomIds[i], bottomIds[i + 1]);
+      std::string topId = addEdge(topIds[i], topIds[i + 1]);
+
+      Json::Value face(Json::objectValue);
+      face["id"] = nextId();
+      for (const auto& edgeId : {bottomId, verticalIds[i + 1], topId, verticalIds[i]}){
+        face["edge_ids"].append(edgeId);
+      }
+      for (unsigned order : {1u, 1u, 0u, 0u}){
+        face["edge_order"].append(order);
+      }
+      faces.append(face);
+
+      Json::Value space(Json::objectValue);
+      space["id"] = nextId();
+      space["name"] = "Space " + std::to_string(storyIdx + 1) + " - " + std::to_string(i + 1);
+      space["type"] = "space";
+      space["face_id"] = face["id"];
+      spaces.append(space);
+    }
+
+    story["geometry"]["id"] = nextId();
+    story["geometry"]["vertices"] = vertices;
+    story["geometry"]["edges"] = edges;
+    story["geometry"]["faces"] = faces;
+    story["spaces"] = spaces;
+    stories.append(story);
+  }
+  floorplan["stories"] = stories;
+
+  Json::FastWriter writer;
+  return writer.write(floorplan);
+}
+
+// range(0) is the number of 10 space stories, range(1) selects full regeneration (0) or an incremental update (1)
+// each iteration moves one wall on the top story back and forth and updates the model to match
+static void BM_FloorplanJS_UpdateModel(benchmark::State& state)
+{
+  unsigned numStories = state.range(0);
+  bool incremental = (state.range(1) != 0);
+
+  FloorplanJS floorplan1(syntheticFloorplan(numStories, 0.0));
+  FloorplanJS floorplan2(syntheticFloorplan(numStories, 2.0));
+
+  model::ThreeJSReverseTranslator rt;
+  model::Model model;
+  {
+    boost::optional<model::Model> newModel = rt.modelFromThreeJS(floorplan1.toThreeScene(true));
+    model::ModelMerger merger;
+    merger.mergeModels(model, *newModel, rt.handleMapping());
+  }
+
+  const FloorplanJS* currentFloorplan = &floorplan1;
+  const FloorplanJS* nextFloorplan = &floorplan2;
+  size_t numRegenerated = 0;
+  while (state.KeepRunning()){
+    model::ModelMerger merger;
+    if (incremental){
+      FloorplanChangeSet changeSet = currentFloorplan->diff(*nextFloorplan);
+      numRegenerated = changeSet.affectedIds().size();
+      boost::optional<model::Model> newModel = rt.modelFromThreeJS(nextFloorplan->toThreeScene(true, changeSet.affectedIds()));
+      merger.mergeModelChanges(model, *newModel, rt.handleMapping(), changeSet);
+    } else{
+      boost::optional<model::Model> newModel = rt.modelFromThreeJS(nextFloorplan->toThreeScene(true));
+      numRegenerated = newModel->getConcreteModelObjects<model::Space>().size();
+      merger.mergeModels(model, *newModel, merger.suggestHandleMapping(model, *newModel));
+    }
+    std::swap(currentFloorplan, nextFloorplan);
+  }
+
+  state.SetLabel(std::to_string(numRegenerated) + " spaces regenerated");
+}
+BENCHMARK(BM_FloorplanJS_UpdateModel)->RangeMultiplier(4)->Ranges({{1, 40}, {0, 1}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,117 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+#include <benchmark/benchmark.h>
+
+#include "../isomodel/SimModelBatch.hpp"
+#include "../isomodel/UserModel.hpp"
+
+#include <resources.hxx>
+
+using namespace openstudio;
+using namespace openstudio::isomodel;
+
+/// Returns numVariants SimModels of the example ISO model with varied floor area, setpoints and glazing
+static std::vector<SimModel> isoModelVariants(int64_t numVariants)
+{
+  UserModel userModel;
+  userModel.load(resourcesPath() / toPath("isomodel/exampleModel.ISO"));
+  std::vector<SimModel> simModels;
+  if (!userModel.valid()){
+    return simModels;
+  }
+  for (int64_t i = 0; i < numVariants; ++i){
+    UserModel variant = userModel;
+    double scale = 0.5 + static_cast<double>(i % 100) / 100.0;
+    variant.setFloorArea(userModel.floorArea() * scale);
+    variant.setHeatingOccupiedSetpoint(userModel.heatingOccupiedSetpoint() * scale);
+    variant.setCoolingOccupiedSetpoint(userModel.coolingOccupiedSetpoint() * scale);
+    variant.setWindowAreaS(userModel.windowAreaS() * scale);
+    simModels.push_back(variant.toSimModel());
+  }
+  return simModels;
+}
+
+// state.range(0) is the number of variants simulated one at a time with SimModel::simulate
+static void BM_ISOModel_SimModel(benchmark::State& state)
+{
+  std::vector<SimModel> simModels = isoModelVariants(state.range(0));
+  if (simModels.empty()){
+    state.SkipWithError("Unable to load ISO model");
+    return;
+  }
+
+  while (state.KeepRunning()){
+    for (const SimModel& simModel : simModels){
+      ISOResults results = simModel.simulate();
+      benchmark::DoNotOptimize(results);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ISOModel_SimModel)->Arg(1)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+// state.range(0) is the number of variants simulated by SimModelBatch, state.range(1) is the number of threads
+static void BM_ISOModel_SimModelBatch(benchmark::State& state)
+{
+  std::vector<SimModel> simModels = isoModelVariants(state.range(0));
+  if (simModels.empty()){
+    state.SkipWithError("Unable to load ISO model");
+    return;
+  }
+  SimModelBatch batch(simModels);
+
+  while (state.KeepRunning()){
+    std::vector<ISOResults> results = batch.simulate(static_cast<unsigned>(state.range(1)));
+    benchmark::DoNotOptimize(results.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ISOModel_SimModelBatch)->Args({1, 1})->Args({1000, 1})->Args({1000, 0})->Unit(benchmark::kMillisecond);
+
+// state.range(0) is the number of UserModels loaded, state.range(1) is 0 to clear the weather data cache before each load
+static void BM_ISOModel_LoadUserModels(benchmark::State& state)
+{
+  openstudio::path isoPath = resourcesPath() / toPath("isomodel/exampleModel.ISO");
+
+  while (state.KeepRunning()){
+    for (int64_t i = 0; i < state.range(0); ++i){
+      if (state.range(1) == 0){
+        WeatherData::clearCache();
+      }
+      UserModel userModel;
+      userModel.load(isoPath);
+      benchmark::DoNotOptimize(userModel);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ISOModel_LoadUserModels)->Args({100, 0})->Args({100, 1})->Unit(benchmark::kMillisecond);
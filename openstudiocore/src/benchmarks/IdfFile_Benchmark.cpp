@@ -0,0 +1,161 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkFixture.hpp"
+
+#include "../utilities/idf/IdfFile.hpp"
+#include "../utilities/idf/Workspace.hpp"
+#include "../utilities/idd/IddEnums.hpp"
+
+#include <sstream>
+
+using namespace openstudio;
+using namespace openstudio::benchmarks;
+
+static void BM_IdfFile_Load_EnergyPlus(benchmark::State& state)
+{
+  const std::string& text = syntheticIdf(state.range(0));
+
+  while (state.KeepRunning()){
+    std::stringstream ss(text);
+    boost::optional<IdfFile> idfFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+    benchmark::DoNotOptimize(idfFile);
+  }
+
+  state.SetBytesProcessed(state.iterations() * text.size());
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_IdfFile_Load_EnergyPlus)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+static void BM_IdfFile_Load_OpenStudio(benchmark::State& state)
+{
+  const std::string& text = syntheticOsm(state.range(0));
+
+  while (state.KeepRunning()){
+    std::stringstream ss(text);
+    boost::optional<IdfFile> idfFile = IdfFile::load(ss, IddFileType::OpenStudio);
+    benchmark::DoNotOptimize(idfFile);
+  }
+
+  state.SetBytesProcessed(state.iterations() * text.size());
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_IdfFile_Load_OpenStudio)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+static void BM_Workspace_AddObjects(benchmark::State& state)
+{
+  std::stringstream ss(syntheticIdf(state.range(0)));
+  boost::optional<IdfFile> idfFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+  if (!idfFile){
+    state.SkipWithError("Unable to load synthetic idf");
+    return;
+  }
+  std::vector<IdfObject> objects = idfFile->objects();
+
+  while (state.KeepRunning()){
+    state.PauseTiming();
+    Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+    state.ResumeTiming();
+
+    std::vector<WorkspaceObject> added = workspace.addObjects(objects);
+    benchmark::DoNotOptimize(added);
+
+    // exclude destruction of the workspace
+    state.PauseTiming();
+    added.clear();
+    workspace = Workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * objects.size());
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Workspace_AddObjects)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+// state.range(0) is the size of the synthetic idf, scans every object and looks each one up by handle
+static void BM_Workspace_ScanObjects(benchmark::State& state)
+{
+  std::stringstream ss(syntheticIdf(state.range(0)));
+  boost::optional<IdfFile> idfFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+  if (!idfFile){
+    state.SkipWithError("Unable to load synthetic idf");
+    return;
+  }
+  Workspace workspace(*idfFile, StrictnessLevel::None);
+  std::vector<Handle> handles = workspace.handles();
+
+  while (state.KeepRunning()){
+    std::vector<WorkspaceObject> objects = workspace.objects();
+    benchmark::DoNotOptimize(objects);
+    for (const Handle& handle : handles){
+      boost::optional<WorkspaceObject> object = workspace.getObject(handle);
+      benchmark::DoNotOptimize(object);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * handles.size());
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Workspace_ScanObjects)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+// state.range(0) is the size of the synthetic idf, removes and restores a tenth of the objects so scans cross holes
+static void BM_Workspace_RemoveObjects(benchmark::State& state)
+{
+  std::stringstream ss(syntheticIdf(state.range(0)));
+  boost::optional<IdfFile> idfFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+  if (!idfFile){
+    state.SkipWithError("Unable to load synthetic idf");
+    return;
+  }
+  Workspace workspace(*idfFile, StrictnessLevel::None);
+
+  while (state.KeepRunning()){
+    std::vector<Handle> handles = workspace.handles();
+    std::vector<Handle> toRemove;
+    for (size_t i = 0; i < handles.size(); i += 10){
+      toRemove.push_back(handles[i]);
+    }
+    std::vector<IdfObject> removed;
+    for (const Handle& handle : toRemove){
+      boost::optional<WorkspaceObject> object = workspace.getObject(handle);
+      if (object){
+        removed.push_back(object->idfObject());
+        object->remove();
+      }
+    }
+    std::vector<WorkspaceObject> objects = workspace.objects();
+    benchmark::DoNotOptimize(objects);
+    workspace.addObjects(removed);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Workspace_RemoveObjects)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond)->Complexity();
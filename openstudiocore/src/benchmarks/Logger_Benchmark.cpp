@@ -0,0 +1,75 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+#include <benchmark/benchmark.h>
+
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/StringStreamLogSink.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace openstudio;
+
+// state.range(0) is the number of threads logging 1000 messages each, state.range(1) is 0 for synchronous logging
+// and 1 for asynchronous logging, timed until every message has reached the sink
+static void BM_Logger_LogFromThreads(benchmark::State& state)
+{
+  const int64_t numMessages = 1000;
+  const int64_t numThreads = state.range(0);
+
+  StringStreamLogSink sink;
+  sink.setLogLevel(Warn);
+  if (state.range(1) != 0){
+    Logger::instance().enableAsynchronousLogging();
+  }
+
+  while (state.KeepRunning()){
+    std::vector<std::thread> threads;
+    for (int64_t i = 0; i < numThreads; ++i){
+      threads.emplace_back([i, numMessages](){
+        for (int64_t j = 0; j < numMessages; ++j){
+          LOG_FREE(Warn, "benchmark.logger", i << " " << j);
+        }
+      });
+    }
+    for (auto& thread : threads){
+      thread.join();
+    }
+    Logger::instance().flush();
+
+    state.PauseTiming();
+    sink.resetStringStream();
+    state.ResumeTiming();
+  }
+
+  Logger::instance().disableAsynchronousLogging();
+
+  state.SetItemsProcessed(state.iterations() * numThreads * numMessages);
+}
+BENCHMARK(BM_Logger_LogFromThreads)->Args({1, 0})->Args({1, 1})->Args({8, 0})->Args({8, 1})->Unit(benchmark::kMillisecond);
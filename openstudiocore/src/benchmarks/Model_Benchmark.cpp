@@ -0,0 +1,77 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkFixture.hpp"
+
+#include "../model/Model.hpp"
+#include "../model/Space.hpp"
+
+#include "../utilities/core/Filesystem.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+using namespace openstudio;
+using namespace openstudio::model;
+using namespace openstudio::benchmarks;
+
+static void BM_Model_Load(benchmark::State& state)
+{
+  unsigned numSpaces = state.range(0);
+  openstudio::path p = benchmarkOutputDir() / toPath("synthetic_" + boost::lexical_cast<std::string>(numSpaces) + ".osm");
+  {
+    openstudio::filesystem::ofstream file(p);
+    file << syntheticOsm(numSpaces);
+  }
+
+  while (state.KeepRunning()){
+    boost::optional<Model> model = Model::load(p);
+    benchmark::DoNotOptimize(model);
+  }
+
+  state.SetComplexityN(numSpaces);
+}
+BENCHMARK(BM_Model_Load)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+static void BM_Model_IntersectSurfaces(benchmark::State& state)
+{
+  while (state.KeepRunning()){
+    state.PauseTiming();
+    Model model = syntheticModel(state.range(0));
+    std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+    state.ResumeTiming();
+
+    intersectSurfaces(spaces);
+    matchSurfaces(spaces);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Model_IntersectSurfaces)->RangeMultiplier(4)->Range(1, 64)->Unit(benchmark::kMillisecond)->Complexity();
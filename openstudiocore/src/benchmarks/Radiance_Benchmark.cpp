@@ -0,0 +1,114 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkFixture.hpp"
+
+#include "../radiance/ForwardTranslator.hpp"
+#include "../model/DaylightingControl.hpp"
+#include "../model/IlluminanceMap.hpp"
+#include "../model/Model.hpp"
+#include "../model/Space.hpp"
+#include "../model/ThermalZone.hpp"
+
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/geometry/BoundingBox.hpp"
+#include "../utilities/geometry/Point3d.hpp"
+
+using namespace openstudio;
+using namespace openstudio::model;
+using namespace openstudio::benchmarks;
+
+// adds a primary daylighting control and an illuminance map centered in each space
+static Model syntheticDaylightingModel(unsigned numSpaces)
+{
+  Model model = syntheticModel(numSpaces);
+  for (Space space : model.getConcreteModelObjects<Space>()){
+    BoundingBox box = space.boundingBox();
+    if (box.isEmpty()){
+      continue;
+    }
+    double x = 0.5 * (*box.minX() + *box.maxX());
+    double y = 0.5 * (*box.minY() + *box.maxY());
+    double z = *box.minZ() + 0.8;
+
+    DaylightingControl control(model);
+    control.setSpace(space);
+    control.setPosition(Point3d(x, y, z));
+
+    IlluminanceMap map(model);
+    map.setSpace(space);
+    map.setOriginXCoordinate(*box.minX() + 1.0);
+    map.setOriginYCoordinate(*box.minY() + 1.0);
+    map.setOriginZCoordinate(z);
+    map.setXLength(*box.maxX() - *box.minX() - 2.0);
+    map.setYLength(*box.maxY() - *box.minY() - 2.0);
+    map.setNumberofXGridPoints(10);
+    map.setNumberofYGridPoints(10);
+
+    ThermalZone thermalZone = space.thermalZone().get();
+    thermalZone.setPrimaryDaylightingControl(control);
+    thermalZone.setIlluminanceMap(map);
+  }
+  return model;
+}
+
+static void BM_RadianceForwardTranslator_TranslateModel(benchmark::State& state)
+{
+  Model model = syntheticDaylightingModel(state.range(0));
+  openstudio::path outPath = benchmarkOutputDir() / toPath("radiance");
+
+  while (state.KeepRunning()){
+    radiance::ForwardTranslator forwardTranslator;
+    std::vector<openstudio::path> outFiles = forwardTranslator.translateModel(outPath, model);
+    benchmark::DoNotOptimize(outFiles);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_RadianceForwardTranslator_TranslateModel)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+static void BM_Radiance_FormatString(benchmark::State& state)
+{
+  std::vector<double> values;
+  for (int i = 0; i < 1000; ++i){
+    values.push_back(0.001 * i * i - 17.5);
+  }
+
+  while (state.KeepRunning()){
+    for (double value : values){
+      std::string s = radiance::formatString(value, 3);
+      benchmark::DoNotOptimize(s);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_Radiance_FormatString);
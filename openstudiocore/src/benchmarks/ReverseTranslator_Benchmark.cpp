@@ -0,0 +1,77 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkFixture.hpp"
+
+#include "../energyplus/ReverseTranslator.hpp"
+#include "../model/Model.hpp"
+#include "../utilities/idf/IdfFile.hpp"
+#include "../utilities/idf/Workspace.hpp"
+#include "../utilities/idd/IddEnums.hpp"
+
+#include <sstream>
+
+using namespace openstudio;
+using namespace openstudio::benchmarks;
+
+// range(0) is the number of spaces, range(1) is whether the input workspace is cloned
+static void BM_ReverseTranslator_TranslateWorkspace(benchmark::State& state)
+{
+  std::stringstream ss(syntheticIdf(state.range(0)));
+  boost::optional<IdfFile> idfFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+  if (!idfFile){
+    state.SkipWithError("Unable to load synthetic idf");
+    return;
+  }
+  std::vector<IdfObject> objects = idfFile->objects();
+  bool cloneWorkspace = (state.range(1) != 0);
+
+  while (state.KeepRunning()){
+    // translating in place modifies the workspace, give each iteration a fresh one
+    state.PauseTiming();
+    Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+    workspace.addObjects(objects);
+    state.ResumeTiming();
+
+    energyplus::ReverseTranslator reverseTranslator;
+    if (cloneWorkspace){
+      model::Model model = reverseTranslator.translateWorkspace(workspace);
+      benchmark::DoNotOptimize(model);
+    }else{
+      model::Model model = reverseTranslator.translateWorkspaceInPlace(workspace);
+      benchmark::DoNotOptimize(model);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * objects.size());
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ReverseTranslator_TranslateWorkspace)->RangeMultiplier(4)->Ranges({{1, 256}, {0, 1}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,126 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkFixture.hpp"
+
+#include "../sdd/ReverseTranslator.hpp"
+#include "../model/Model.hpp"
+
+#include "../utilities/core/Filesystem.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <map>
+
+using namespace openstudio;
+using namespace openstudio::benchmarks;
+
+// Simulation SDD with numObjects each of materials, layered constructions, and day, week, and year schedules.
+// Every construction and schedule refers to others by name, so import time is dominated by name lookups.
+static openstudio::path syntheticSDD(unsigned numObjects)
+{
+  static std::map<unsigned, openstudio::path> cache;
+  auto it = cache.find(numObjects);
+  if (it != cache.end()){
+    return it->second;
+  }
+
+  openstudio::path result = benchmarkOutputDir() / toPath("synthetic_" + boost::lexical_cast<std::string>(numObjects) + ".sdd.xml");
+  openstudio::filesystem::ofstream file(result);
+
+  file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+  file << "<SDDXML>\n<Proj>\n<Name>Synthetic</Name>\n<SimFlag>1</SimFlag>\n";
+
+  for (unsigned i = 0; i < numObjects; ++i){
+    file << "<Mat><Name>Material " << i << "</Name><Thkns>4</Thkns><ThrmlCndct>0.5</ThrmlCndct>"
+         << "<Dens>100</Dens><SpecHt>0.2</SpecHt></Mat>\n";
+  }
+
+  for (unsigned i = 0; i < numObjects; ++i){
+    file << "<ConsAssm><Name>Construction " << i << "</Name><SpecMthd>Layers</SpecMthd>";
+    for (unsigned j = 0; j < 3; ++j){
+      file << "<MatRef>Material " << (i + j) % numObjects << "</MatRef>";
+    }
+    file << "</ConsAssm>\n";
+  }
+
+  for (unsigned i = 0; i < numObjects; ++i){
+    file << "<SchDay><Name>Day Schedule " << i << "</Name><Type>Fraction</Type>";
+    for (unsigned hour = 0; hour < 24; ++hour){
+      file << "<Hr>" << ((hour + i) % 24) / 24.0 << "</Hr>";
+    }
+    file << "</SchDay>\n";
+  }
+
+  const char* dayRefs[] = {"SchDaySunRef", "SchDayMonRef", "SchDayTueRef", "SchDayWedRef", "SchDayThuRef",
+                           "SchDayFriRef", "SchDaySatRef", "SchDayHolRef", "SchDayClgDDRef", "SchDayHtgDDRef"};
+  for (unsigned i = 0; i < numObjects; ++i){
+    file << "<SchWeek><Name>Week Schedule " << i << "</Name><Type>Fraction</Type>";
+    for (unsigned j = 0; j < 10; ++j){
+      file << "<" << dayRefs[j] << ">Day Schedule " << (i + j) % numObjects << "</" << dayRefs[j] << ">";
+    }
+    file << "</SchWeek>\n";
+  }
+
+  for (unsigned i = 0; i < numObjects; ++i){
+    file << "<Sch><Name>Schedule " << i << "</Name><Type>Fraction</Type>"
+         << "<EndMonth>6</EndMonth><EndDay>30</EndDay><SchWeekRef>Week Schedule " << i << "</SchWeekRef>"
+         << "<EndMonth>12</EndMonth><EndDay>31</EndDay><SchWeekRef>Week Schedule " << (i + 1) % numObjects << "</SchWeekRef></Sch>\n";
+  }
+
+  file << "<Bldg><Name>Building</Name></Bldg>\n</Proj>\n</SDDXML>\n";
+  file.close();
+
+  if (!file){
+    result = openstudio::path();
+  }
+  cache[numObjects] = result;
+  return result;
+}
+
+static void BM_SDDReverseTranslator_LoadModel(benchmark::State& state)
+{
+  openstudio::path path = syntheticSDD(state.range(0));
+  if (path.empty()){
+    state.SkipWithError("Unable to write SDD file");
+    return;
+  }
+
+  while (state.KeepRunning()){
+    sdd::ReverseTranslator reverseTranslator;
+    boost::optional<model::Model> model = reverseTranslator.loadModel(path);
+    benchmark::DoNotOptimize(model);
+  }
+
+  state.SetBytesProcessed(state.iterations() * openstudio::filesystem::file_size(path));
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_SDDReverseTranslator_LoadModel)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond)->Complexity();
@@ -0,0 +1,135 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../utilities/sql/SqlFile.hpp"
+#include "../utilities/data/TimeSeries.hpp"
+
+#include <resources.hxx>
+
+using namespace openstudio;
+
+static openstudio::path sqlFilePath()
+{
+  return resourcesPath() / toPath("utilities/SqlFile/1ZoneEvapCooler-V8-4-0.sql");
+}
+
+// reads every time series in the file, state.range(0) times per iteration
+static void BM_SqlFile_TimeSeries(benchmark::State& state)
+{
+  SqlFile sqlFile(sqlFilePath());
+  if (!sqlFile.connectionOpen()){
+    state.SkipWithError("Unable to open sql file");
+    return;
+  }
+
+  struct Query
+  {
+    std::string envPeriod;
+    std::string reportingFrequency;
+    std::string name;
+  };
+  std::vector<Query> queries;
+  for (const std::string& envPeriod : sqlFile.availableEnvPeriods()){
+    for (const std::string& reportingFrequency : sqlFile.availableReportingFrequencies(envPeriod)){
+      for (const std::string& name : sqlFile.availableVariableNames(envPeriod, reportingFrequency)){
+        queries.push_back(Query{envPeriod, reportingFrequency, name});
+      }
+    }
+  }
+
+  int64_t numSeries = 0;
+  while (state.KeepRunning()){
+    for (int64_t i = 0; i < state.range(0); ++i){
+      for (const Query& query : queries){
+        std::vector<TimeSeries> timeSeries = sqlFile.timeSeries(query.envPeriod, query.reportingFrequency, query.name);
+        numSeries += timeSeries.size();
+        benchmark::DoNotOptimize(timeSeries);
+      }
+    }
+  }
+
+  state.SetItemsProcessed(numSeries);
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_SqlFile_TimeSeries)->RangeMultiplier(4)->Range(1, 16)->Unit(benchmark::kMillisecond)->Complexity();
+
+// looks up every Component Sizing Information row of a large HVAC model, state.range(0) is 0 to query the rows one
+// at a time as ModelObject::getAutosizedValue used to, 1 to use the component sizing index
+static void BM_SqlFile_ComponentSizing(benchmark::State& state)
+{
+  openstudio::path path = resourcesPath() / toPath("energyplus/Office_With_Many_HVAC_Types/eplusout.sql");
+  std::string table = "FROM tabulardatawithstrings WHERE ReportName='Initialization Summary' AND ReportForString='Entire Facility' "
+                      "AND TableName='Component Sizing Information' ";
+
+  std::vector<std::pair<std::string, std::string> > lookups;
+  {
+    SqlFile sqlFile(path);
+    if (!sqlFile.connectionOpen()){
+      state.SkipWithError("Unable to open sql file");
+      return;
+    }
+    boost::optional<std::vector<std::string> > rowNames = sqlFile.execAndReturnVectorOfString("SELECT DISTINCT RowName " + table);
+    for (const std::string& rowName : rowNames.get_value_or(std::vector<std::string>())){
+      std::string row = "AND RowName='" + rowName + "'";
+      boost::optional<std::string> componentName = sqlFile.execAndReturnFirstString("SELECT Value " + table + row + " AND ColumnName='Component Name'");
+      boost::optional<std::string> description = sqlFile.execAndReturnFirstString("SELECT Value " + table + row + " AND ColumnName='Description'");
+      if (componentName && description){
+        lookups.push_back(std::make_pair(componentName.get(), description.get()));
+      }
+    }
+  }
+
+  while (state.KeepRunning()){
+    SqlFile sqlFile(path);
+    for (const auto& lookup : lookups){
+      boost::optional<double> value;
+      if (state.range(0) == 0){
+        boost::optional<std::vector<std::string> > rowNames = sqlFile.execAndReturnVectorOfString("SELECT RowName " + table + "AND Value='" + lookup.first + "'");
+        for (const std::string& rowName : rowNames.get_value_or(std::vector<std::string>())){
+          std::string row = "AND RowName='" + rowName + "' ";
+          if (!sqlFile.execAndReturnFirstString("SELECT Value " + table + row + "AND Value='" + lookup.second + "'")){
+            continue;
+          }
+          value = sqlFile.execAndReturnFirstDouble("SELECT Value " + table + "AND ColumnName='Value' " + row);
+          if (value){
+            break;
+          }
+        }
+      } else {
+        value = sqlFile.componentSizingValue(lookup.first, lookup.second);
+      }
+      benchmark::DoNotOptimize(value);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * lookups.size());
+}
+BENCHMARK(BM_SqlFile_ComponentSizing)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
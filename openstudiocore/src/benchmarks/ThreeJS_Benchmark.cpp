@@ -0,0 +1,78 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkFixture.hpp"
+
+#include "../model/Model.hpp"
+#include "../model/ThreeJSForwardTranslator.hpp"
+#include "../utilities/geometry/ThreeJS.hpp"
+
+using namespace openstudio;
+using namespace openstudio::benchmarks;
+
+static void BM_ThreeJSForwardTranslator_ModelToThreeJS(benchmark::State& state)
+{
+  model::Model model = syntheticModel(state.range(0));
+
+  while (state.KeepRunning()){
+    model::ThreeJSForwardTranslator translator;
+    ThreeScene scene = translator.modelToThreeJS(model, true);
+    benchmark::DoNotOptimize(scene);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ThreeJSForwardTranslator_ModelToThreeJS)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+// range(1) selects JSON number arrays (0) or a binary geometry buffer (1), bytes processed is the output size
+static void BM_ThreeScene_ToJSON(benchmark::State& state)
+{
+  model::Model model = syntheticModel(state.range(0));
+  model::ThreeJSForwardTranslator translator;
+  ThreeScene scene = translator.modelToThreeJS(model, true);
+  bool binary = (state.range(1) != 0);
+
+  size_t outputSize = 0;
+  while (state.KeepRunning()){
+    if (binary){
+      std::vector<unsigned char> buffer;
+      std::string json = scene.toJSON(buffer);
+      outputSize = json.size() + buffer.size();
+    } else{
+      std::string json = scene.toJSON();
+      outputSize = json.size();
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * outputSize);
+  state.SetLabel(std::to_string(outputSize) + " bytes");
+}
+BENCHMARK(BM_ThreeScene_ToJSON)->RangeMultiplier(4)->Ranges({{1, 256}, {0, 1}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,69 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../utilities/units/QuantityConverter.hpp"
+#include "../utilities/units/Quantity.hpp"
+#include "../utilities/units/UnitFactory.hpp"
+
+#include <vector>
+
+using namespace openstudio;
+
+// state.range(0) is 0 to build units and quantities for every value, 1 to call the cached scalar
+// convert, 2 to call the vector convert; state.range(1) is the number of values
+static void BM_Units_Convert(benchmark::State& state)
+{
+  std::vector<double> values(state.range(1));
+  for (size_t i = 0; i < values.size(); ++i){
+    values[i] = -20.0 + 0.01 * i;
+  }
+  std::vector<double> result(values.size());
+
+  while (state.KeepRunning()){
+    if (state.range(0) == 0){
+      for (size_t i = 0; i < values.size(); ++i){
+        Unit c = createUnit("C").get();
+        Unit f = createUnit("F").get();
+        result[i] = QuantityConverter::instance().convert(Quantity(values[i], c), f)->value();
+      }
+    } else if (state.range(0) == 1){
+      for (size_t i = 0; i < values.size(); ++i){
+        result[i] = convert(values[i], "C", "F").get();
+      }
+    } else {
+      result = convert(values, "C", "F").get();
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_Units_Convert)->Args({0, 8760})->Args({1, 8760})->Args({2, 8760})->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,116 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkFixture.hpp"
+
+#include "../gbxml/ForwardTranslator.hpp"
+#include "../gbxml/ReverseTranslator.hpp"
+#include "../gbxml/Test/DomForwardTranslator.hpp"
+#include "../model/Model.hpp"
+
+#include "../utilities/core/Filesystem.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <map>
+
+using namespace openstudio;
+using namespace openstudio::benchmarks;
+
+// gbXML export of the synthetic model, written once per size
+static openstudio::path syntheticGbXML(unsigned numSpaces)
+{
+  static std::map<unsigned, openstudio::path> cache;
+  auto it = cache.find(numSpaces);
+  if (it != cache.end()){
+    return it->second;
+  }
+
+  openstudio::path result = benchmarkOutputDir() / toPath("synthetic_" + boost::lexical_cast<std::string>(numSpaces) + ".xml");
+  gbxml::ForwardTranslator forwardTranslator;
+  if (!forwardTranslator.modelToGbXML(syntheticModel(numSpaces), result)){
+    result = openstudio::path();
+  }
+  cache[numSpaces] = result;
+  return result;
+}
+
+static void BM_gbXMLReverseTranslator_LoadModel(benchmark::State& state)
+{
+  openstudio::path path = syntheticGbXML(state.range(0));
+  if (path.empty()){
+    state.SkipWithError("Unable to write gbXML file");
+    return;
+  }
+
+  while (state.KeepRunning()){
+    gbxml::ReverseTranslator reverseTranslator;
+    boost::optional<model::Model> model = reverseTranslator.loadModel(path);
+    benchmark::DoNotOptimize(model);
+  }
+
+  state.SetBytesProcessed(state.iterations() * openstudio::filesystem::file_size(path));
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_gbXMLReverseTranslator_LoadModel)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond)->Complexity();
+
+static void BM_gbXMLForwardTranslator_ModelToGbXML(benchmark::State& state)
+{
+  model::Model model = syntheticModel(state.range(0));
+  openstudio::path path = benchmarkOutputDir() / toPath("forward_" + boost::lexical_cast<std::string>(state.range(0)) + ".xml");
+
+  while (state.KeepRunning()){
+    gbxml::ForwardTranslator forwardTranslator;
+    bool result = forwardTranslator.modelToGbXML(model, path);
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetBytesProcessed(state.iterations() * openstudio::filesystem::file_size(path));
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_gbXMLForwardTranslator_ModelToGbXML)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond)->Complexity();
+
+// the DOM based translator that modelToGbXML replaced, for comparison
+static void BM_gbXMLDomForwardTranslator_ModelToGbXML(benchmark::State& state)
+{
+  model::Model model = syntheticModel(state.range(0));
+  openstudio::path path = benchmarkOutputDir() / toPath("forward_dom_" + boost::lexical_cast<std::string>(state.range(0)) + ".xml");
+
+  while (state.KeepRunning()){
+    gbxml::DomForwardTranslator forwardTranslator;
+    bool result = forwardTranslator.modelToGbXML(model, path);
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetBytesProcessed(state.iterations() * openstudio::filesystem::file_size(path));
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_gbXMLDomForwardTranslator_ModelToGbXML)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond)->Complexity();
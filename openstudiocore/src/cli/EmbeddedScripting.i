@@ -11,11 +11,13 @@
 
 %include <embedded_files.hxx>
 %include "EmbeddedHelp.hpp"
+%include "MeasureManagerCommand.hpp"
 
 
 %{
 #include <embedded_files.hxx>
 #include "EmbeddedHelp.hpp"
+#include "MeasureManagerCommand.hpp"
 
 %}
 
@@ -0,0 +1,700 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "MeasureManager.hpp"
+
+#include "../energyplus/ForwardTranslator.hpp"
+#include "../measure/OSArgument.hpp"
+#include "../osversion/VersionTranslator.hpp"
+
+#include "../utilities/bcl/BCLMeasureArgument.hpp"
+#include "../utilities/bcl/BCLMeasureOutput.hpp"
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/data/Attribute.hpp"
+#include "../utilities/idd/IddEnums.hpp"
+#include "../utilities/time/DateTime.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace openstudio {
+namespace cli {
+
+  namespace {
+
+    // same leniency as Ruby's String#to_f and String#to_i, which measure_manager.rb used
+    double toDouble(const std::string& s)
+    {
+      return std::strtod(s.c_str(), nullptr);
+    }
+
+    int toInt(const std::string& s)
+    {
+      return static_cast<int>(std::strtol(s.c_str(), nullptr, 10));
+    }
+
+    Json::Value argumentsFromMeasure(const BCLMeasure& measure)
+    {
+      Json::Value result(Json::arrayValue);
+
+      for (const BCLMeasureArgument& argument : measure.arguments()){
+        const std::string type = argument.type();
+
+        Json::Value arg(Json::objectValue);
+        arg["name"] = argument.name();
+        arg["display_name"] = argument.displayName();
+        arg["description"] = argument.description().get_value_or("");
+        arg["type"] = type;
+        arg["required"] = argument.required();
+        arg["model_dependent"] = argument.modelDependent();
+
+        boost::optional<std::string> defaultValue = argument.defaultValue();
+        if (type == "Boolean"){
+          if (defaultValue){
+            arg["default_value"] = (boost::algorithm::to_lower_copy(*defaultValue) == "true");
+          }
+        } else if (type == "Double"){
+          if (argument.units()){
+            arg["units"] = *argument.units();
+          }
+          if (defaultValue){
+            arg["default_value"] = toDouble(*defaultValue);
+          }
+          if (argument.minValue()){
+            arg["min_value"] = toDouble(*argument.minValue());
+          }
+          if (argument.maxValue()){
+            arg["max_value"] = toDouble(*argument.maxValue());
+          }
+        } else if (type == "Integer"){
+          if (argument.units()){
+            arg["units"] = *argument.units();
+          }
+          if (defaultValue){
+            arg["default_value"] = toInt(*defaultValue);
+          }
+        } else if (type == "String" || type == "Path"){
+          if (defaultValue){
+            arg["default_value"] = *defaultValue;
+          }
+        } else if (type == "Choice"){
+          if (defaultValue){
+            arg["default_value"] = *defaultValue;
+          }
+          Json::Value choiceValues(Json::arrayValue);
+          for (const std::string& value : argument.choiceValues()){
+            choiceValues.append(value);
+          }
+          arg["choice_values"] = choiceValues;
+          Json::Value choiceDisplayNames(Json::arrayValue);
+          for (const std::string& value : argument.choiceDisplayNames()){
+            choiceDisplayNames.append(value);
+          }
+          arg["choice_display_names"] = choiceDisplayNames;
+        }
+
+        result.append(arg);
+      }
+
+      return result;
+    }
+
+    Json::Value argumentsFromMeasureInfo(const measure::OSMeasureInfo& info)
+    {
+      Json::Value result(Json::arrayValue);
+
+      for (const measure::OSArgument& argument : info.arguments()){
+        const measure::OSArgumentType type = argument.type();
+
+        Json::Value arg(Json::objectValue);
+        arg["name"] = argument.name();
+        arg["display_name"] = argument.displayName();
+        arg["description"] = argument.description().get_value_or("");
+        arg["type"] = type.valueName();
+        arg["required"] = argument.required();
+        arg["model_dependent"] = argument.modelDependent();
+
+        if (type == measure::OSArgumentType::Boolean){
+          if (argument.hasDefaultValue()){
+            arg["default_value"] = argument.defaultValueAsBool();
+          }
+        } else if (type == measure::OSArgumentType::Double){
+          if (argument.units()){
+            arg["units"] = *argument.units();
+          }
+          if (argument.hasDefaultValue()){
+            arg["default_value"] = argument.defaultValueAsDouble();
+          }
+        } else if (type == measure::OSArgumentType::Quantity){
+          if (argument.units()){
+            arg["units"] = *argument.units();
+          }
+          if (argument.hasDefaultValue()){
+            arg["default_value"] = argument.defaultValueAsQuantity().value();
+          }
+        } else if (type == measure::OSArgumentType::Integer){
+          if (argument.units()){
+            arg["units"] = *argument.units();
+          }
+          if (argument.hasDefaultValue()){
+            arg["default_value"] = argument.defaultValueAsInteger();
+          }
+        } else if (type == measure::OSArgumentType::String){
+          if (argument.hasDefaultValue()){
+            arg["default_value"] = argument.defaultValueAsString();
+          }
+        } else if (type == measure::OSArgumentType::Choice){
+          if (argument.hasDefaultValue()){
+            arg["default_value"] = argument.defaultValueAsString();
+          }
+          Json::Value choiceValues(Json::arrayValue);
+          for (const std::string& value : argument.choiceValues()){
+            choiceValues.append(value);
+          }
+          arg["choice_values"] = choiceValues;
+          Json::Value choiceDisplayNames(Json::arrayValue);
+          for (const std::string& value : argument.choiceValueDisplayNames()){
+            choiceDisplayNames.append(value);
+          }
+          arg["choice_display_names"] = choiceDisplayNames;
+        } else if (type == measure::OSArgumentType::Path){
+          if (argument.hasDefaultValue()){
+            arg["default_value"] = toString(argument.defaultValueAsPath());
+          }
+        }
+
+        result.append(arg);
+      }
+
+      return result;
+    }
+
+  }
+
+  MeasureManager::MeasureManager(InterpreterThread& interpreterThread, unsigned maxCachedModels)
+    : m_interpreterThread(interpreterThread), m_maxCachedModels(std::max(maxCachedModels, 1u)), m_modelGeneration(0)
+  {
+  }
+
+  void MeasureManager::reset()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_modelMutex);
+      m_models.clear();
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_measureMutex);
+      m_measures.clear();
+    }
+  }
+
+  boost::optional<std::pair<model::Model, Workspace> > MeasureManager::getModel(const openstudio::path& osmPath, bool forceReload)
+  {
+    std::shared_ptr<ModelEntry> entry = modelEntry(osmPath, false, forceReload);
+    if (!entry){
+      return boost::none;
+    }
+
+    std::lock_guard<std::mutex> lock(entry->cloneMutex);
+    return std::make_pair(entry->model->clone(true).cast<model::Model>(), entry->workspace->clone(true));
+  }
+
+  boost::optional<Workspace> MeasureManager::getIdf(const openstudio::path& idfPath, bool forceReload)
+  {
+    std::shared_ptr<ModelEntry> entry = modelEntry(idfPath, true, forceReload);
+    if (!entry){
+      return boost::none;
+    }
+
+    std::lock_guard<std::mutex> lock(entry->cloneMutex);
+    return entry->workspace->clone(true);
+  }
+
+  std::shared_ptr<MeasureManager::ModelEntry> MeasureManager::modelEntry(const openstudio::path& p, bool isIdf, bool forceReload)
+  {
+    const std::string key = toString(p);
+
+    auto matches = [&](const std::shared_ptr<ModelEntry>& entry, std::time_t lastWriteTime, uintmax_t fileSize) {
+      return (entry->isIdf == isIdf) && (entry->lastWriteTime == lastWriteTime) && (entry->fileSize == fileSize);
+    };
+
+    boost::system::error_code ec;
+    std::time_t lastWriteTime = openstudio::filesystem::last_write_time(p, ec);
+    uintmax_t fileSize = 0;
+    if (!ec){
+      fileSize = openstudio::filesystem::file_size(p, ec);
+    }
+    if (ec){
+      LOG(Debug, "'" << key << "' does not exist");
+      std::lock_guard<std::mutex> lock(m_modelMutex);
+      m_models.remove_if([&](const std::shared_ptr<ModelEntry>& entry) { return entry->path == key; });
+      return nullptr;
+    }
+
+    std::shared_ptr<ModelEntry> stale;
+    if (!forceReload){
+      std::shared_ptr<ModelEntry> cached;
+      {
+        std::lock_guard<std::mutex> lock(m_modelMutex);
+        for (auto it = m_models.begin(); it != m_models.end(); ++it){
+          if ((*it)->path == key){
+            if (matches(*it, lastWriteTime, fileSize)){
+              cached = *it;
+              m_models.splice(m_models.begin(), m_models, it);
+            }
+            break;
+          }
+        }
+      }
+
+      if (cached){
+        // waits if another request is still loading this file
+        if (!cached->loaded.get()){
+          return nullptr;
+        }
+        if (cached->metadataTrusted || (checksum(p) == cached->checksum)){
+          LOG(Debug, "Using cached '" << key << "'");
+          return cached;
+        }
+        stale = cached;
+      }
+    }
+
+    std::promise<bool> loaded;
+    std::shared_ptr<ModelEntry> entry = std::make_shared<ModelEntry>();
+    entry->path = key;
+    entry->isIdf = isIdf;
+    entry->lastWriteTime = lastWriteTime;
+    entry->fileSize = fileSize;
+    entry->metadataTrusted = false;
+    entry->loaded = loaded.get_future().share();
+
+    bool loadHere = true;
+    {
+      std::lock_guard<std::mutex> lock(m_modelMutex);
+      auto it = std::find_if(m_models.begin(), m_models.end(), [&](const std::shared_ptr<ModelEntry>& other) { return other->path == key; });
+      if (it != m_models.end()){
+        if (!forceReload && (*it != stale) && matches(*it, lastWriteTime, fileSize)){
+          // another request started loading the same file in the meantime
+          entry = *it;
+          loadHere = false;
+          m_models.splice(m_models.begin(), m_models, it);
+        } else {
+          LOG(Debug, "Cached '" << key << "' is out of date");
+          m_models.erase(it);
+        }
+      }
+
+      if (loadHere){
+        entry->generation = ++m_modelGeneration;
+        m_models.push_front(entry);
+        while (m_models.size() > m_maxCachedModels){
+          LOG(Debug, "Evicting '" << m_models.back()->path << "' from the model cache");
+          m_models.pop_back();
+        }
+      }
+    }
+
+    if (!loadHere){
+      return entry->loaded.get() ? entry : nullptr;
+    }
+
+    bool result = false;
+    try {
+      result = loadModelEntry(*entry);
+    } catch (const std::exception& e) {
+      LOG(Error, "Failed to load '" << key << "': " << e.what());
+    }
+    loaded.set_value(result);
+
+    if (!result){
+      removeModelEntry(entry);
+      return nullptr;
+    }
+
+    return entry;
+  }
+
+  bool MeasureManager::loadModelEntry(ModelEntry& entry)
+  {
+    const openstudio::path p = toPath(entry.path);
+
+    // modification times have a resolution of a second on some file systems, a file written during that
+    // second may change again without changing its modification time
+    std::time_t loadStart = std::time(nullptr);
+    entry.metadataTrusted = (entry.lastWriteTime + 1 < loadStart);
+    entry.checksum = checksum(p);
+
+    if (entry.isIdf){
+      LOG(Debug, "Attempting to load idf '" << entry.path << "'");
+      OptionalWorkspace workspace = Workspace::load(p, IddFileType::EnergyPlus);
+      if (!workspace){
+        LOG(Debug, "Failed to load idf '" << entry.path << "'");
+        return false;
+      }
+      if (!workspace->isValid(StrictnessLevel::Draft)){
+        LOG(Debug, "Workspace loaded from '" << entry.path << "' is not valid");
+        return false;
+      }
+      LOG(Debug, "Successfully loaded idf '" << entry.path << "'");
+      entry.workspace = workspace;
+    } else {
+      LOG(Debug, "Attempting to load model '" << entry.path << "'");
+      osversion::VersionTranslator vt;
+      model::OptionalModel model = vt.loadModel(p);
+      if (!model){
+        LOG(Debug, "Failed to load model '" << entry.path << "'");
+        return false;
+      }
+      LOG(Debug, "Successfully loaded model '" << entry.path << "'");
+      energyplus::ForwardTranslator ft;
+      entry.workspace = ft.translateModel(*model);
+      entry.model = model;
+    }
+
+    return true;
+  }
+
+  void MeasureManager::removeModelEntry(const std::shared_ptr<ModelEntry>& entry)
+  {
+    std::lock_guard<std::mutex> lock(m_modelMutex);
+    m_models.remove(entry);
+  }
+
+  std::shared_ptr<MeasureManager::MeasureEntry> MeasureManager::measureEntry(const std::string& measureDir)
+  {
+    std::lock_guard<std::mutex> lock(m_measureMutex);
+    std::shared_ptr<MeasureEntry>& result = m_measures[measureDir];
+    if (!result){
+      result = std::make_shared<MeasureEntry>();
+    }
+    return result;
+  }
+
+  boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& measureDir, bool forceReload)
+  {
+    std::shared_ptr<MeasureEntry> entry = measureEntry(toString(measureDir));
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    return getMeasure(*entry, measureDir, forceReload);
+  }
+
+  boost::optional<BCLMeasure> MeasureManager::getMeasure(MeasureEntry& entry, const openstudio::path& measureDir, bool forceReload)
+  {
+    const std::string key = toString(measureDir);
+
+    if (!openstudio::filesystem::exists(measureDir) || !openstudio::filesystem::exists(measureDir / toPath("measure.xml"))){
+      LOG(Debug, "Measure '" << key << "' does not exist");
+      entry.measure.reset();
+      entry.info.clear();
+      forceReload = true;
+    }
+
+    boost::optional<BCLMeasure> result;
+    if (!forceReload){
+      result = entry.measure;
+      if (result){
+        LOG(Debug, "Using cached measure '" << key << "'");
+      }
+    }
+
+    if (!result){
+      LOG(Debug, "Attempting to load measure '" << key << "'");
+      result = BCLMeasure::load(measureDir);
+      if (result){
+        LOG(Debug, "Successfully loaded measure '" << key << "'");
+      } else {
+        LOG(Debug, "Failed to load measure '" << key << "'");
+      }
+      entry.measure = result;
+      entry.info.clear();
+    }
+
+    if (result){
+      // see if there are updates, want to make sure to perform both checks
+      bool fileUpdates = result->checkForUpdatesFiles();
+      bool xmlUpdates = result->checkForUpdatesXML();
+
+      openstudio::path readmeInPath = measureDir / toPath("README.md.erb");
+      openstudio::path readmeOutPath = measureDir / toPath("README.md");
+      bool readmeOutOfDate = openstudio::filesystem::exists(readmeInPath) && !openstudio::filesystem::exists(readmeOutPath);
+
+      bool missingFields = false;
+      try {
+        missingFields = result->missingRequiredFields();
+      } catch (const std::exception&) {
+      }
+
+      if (fileUpdates || xmlUpdates || missingFields || readmeOutOfDate){
+        LOG(Debug, "Changes detected, updating '" << key << "'");
+
+        entry.info.clear();
+
+        measure::OSMeasureInfo info = getMeasureInfo(entry, *result, nullptr);
+        info.update(*result);
+
+        if (openstudio::filesystem::exists(readmeInPath)){
+          try {
+            openstudio::filesystem::remove(readmeOutPath);
+
+            Json::FastWriter writer;
+            m_interpreterThread.renderReadme(info, readmeInPath, writer.write(measureHash(measureDir, *result, info)));
+          } catch (const std::exception& e) {
+            info = measure::OSMeasureInfo(e.what());
+            info.update(*result);
+          }
+
+          result->checkForUpdatesFiles();
+        }
+
+        result->save();
+        entry.measure = result;
+      }
+    }
+
+    return result;
+  }
+
+  measure::OSMeasureInfo MeasureManager::getMeasureInfo(MeasureEntry& entry, const BCLMeasure& measure,
+                                                        const std::shared_ptr<ModelEntry>& model)
+  {
+    const std::string osmPath = model ? model->path : std::string();
+    const unsigned generation = model ? model->generation : 0;
+
+    auto it = entry.info.find(osmPath);
+    if ((it != entry.info.end()) && (it->second.modelGeneration == generation)){
+      LOG(Debug, "Using cached measure info for '" << toString(measure.directory()) << "', '" << osmPath << "'");
+      return it->second.info;
+    }
+
+    LOG(Debug, "Loading measure info for '" << toString(measure.directory()) << "', '" << osmPath << "'");
+
+    // the measure may modify the model it is given, it gets its own copy
+    model::OptionalModel modelCopy;
+    OptionalWorkspace workspaceCopy;
+    if (model && model->model){
+      std::lock_guard<std::mutex> lock(model->cloneMutex);
+      modelCopy = model->model->clone(true).cast<model::Model>();
+      workspaceCopy = model->workspace->clone(true);
+    }
+
+    measure::OSMeasureInfo result = m_interpreterThread.getInfo(measure, modelCopy, workspaceCopy);
+
+    if (it != entry.info.end()){
+      entry.info.erase(it);
+    }
+    MeasureInfoEntry infoEntry = {generation, result};
+    entry.info.insert(std::make_pair(osmPath, infoEntry));
+
+    return result;
+  }
+
+  Json::Value MeasureManager::computeArguments(const openstudio::path& measureDir, const boost::optional<openstudio::path>& osmPath,
+                                               bool forceReload)
+  {
+    boost::optional<BCLMeasure> measure = getMeasure(measureDir, forceReload);
+    if (!measure){
+      throw std::runtime_error("Cannot load measure at '" + toString(measureDir) + "'");
+    }
+
+    // loading the model does not block requests for other models or measures
+    std::shared_ptr<ModelEntry> model;
+    if (osmPath){
+      model = modelEntry(*osmPath, false, forceReload);
+      if (!model){
+        throw std::runtime_error("Cannot load model at '" + toString(*osmPath) + "'");
+      }
+    }
+
+    std::shared_ptr<MeasureEntry> entry = measureEntry(toString(measureDir));
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    measure::OSMeasureInfo info = getMeasureInfo(*entry, *measure, model);
+
+    return measureHash(measureDir, *measure, info);
+  }
+
+  Json::Value MeasureManager::measureHash(const openstudio::path& measureDir, const BCLMeasure& measure,
+                                          const boost::optional<measure::OSMeasureInfo>& info) const
+  {
+    Json::Value result(Json::objectValue);
+    result["measure_dir"] = toString(measureDir);
+    result["directory"] = toString(measure.directory());
+    if (measure.error()){
+      result["error"] = *measure.error();
+    }
+    result["uid"] = measure.uid();
+    result["uuid"] = toString(measure.uuid());
+    result["version_id"] = measure.versionId();
+    result["version_uuid"] = toString(measure.versionUUID());
+    if (boost::optional<DateTime> versionModified = measure.versionModified()){
+      result["version_modified"] = versionModified->toISO8601();
+    } else {
+      result["version_modified"] = Json::Value(Json::nullValue);
+    }
+    result["xml_checksum"] = measure.xmlChecksum();
+    result["name"] = measure.name();
+    result["display_name"] = measure.displayName();
+    result["class_name"] = measure.className();
+    result["description"] = measure.description();
+    result["modeler_description"] = measure.modelerDescription();
+
+    Json::Value tags(Json::arrayValue);
+    for (const std::string& tag : measure.tags()){
+      tags.append(tag);
+    }
+    result["tags"] = tags;
+
+    Json::Value outputs(Json::arrayValue);
+    for (const BCLMeasureOutput& output : measure.outputs()){
+      Json::Value out(Json::objectValue);
+      out["name"] = output.name();
+      out["display_name"] = output.displayName();
+      if (output.shortName()){
+        out["short_name"] = *output.shortName();
+      }
+      if (output.description()){
+        out["description"] = *output.description();
+      } else {
+        out["description"] = Json::Value(Json::nullValue);
+      }
+      out["type"] = output.type();
+      if (output.units()){
+        out["units"] = *output.units();
+      }
+      out["model_dependent"] = output.modelDependent();
+      outputs.append(out);
+    }
+    result["outputs"] = outputs;
+
+    Json::Value attributes(Json::arrayValue);
+    for (const Attribute& attribute : measure.attributes()){
+      Json::Value value;
+      switch (attribute.valueType().value()){
+        case AttributeValueType::Boolean:
+          value = attribute.valueAsBoolean();
+          break;
+        case AttributeValueType::Double:
+          value = attribute.valueAsDouble();
+          break;
+        case AttributeValueType::Integer:
+          value = attribute.valueAsInteger();
+          break;
+        case AttributeValueType::Unsigned:
+          value = attribute.valueAsUnsigned();
+          break;
+        case AttributeValueType::String:
+          value = attribute.valueAsString();
+          break;
+        default:
+          continue;
+      }
+
+      Json::Value a(Json::objectValue);
+      a["name"] = attribute.name();
+      a["display_name"] = attribute.displayName(true).get();
+      a["value"] = value;
+      attributes.append(a);
+    }
+    result["attributes"] = attributes;
+
+    if (info){
+      result["arguments"] = argumentsFromMeasureInfo(*info);
+    } else {
+      result["arguments"] = argumentsFromMeasure(measure);
+    }
+
+    return result;
+  }
+
+  Json::Value MeasureManager::internalState()
+  {
+    Json::Value osms(Json::arrayValue);
+    std::map<std::string, unsigned> liveGenerations;
+    {
+      std::lock_guard<std::mutex> lock(m_modelMutex);
+      for (const std::shared_ptr<ModelEntry>& entry : m_models){
+        bool ready = (entry->loaded.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        if (ready && entry->loaded.get() && !entry->isIdf){
+          Json::Value osm(Json::objectValue);
+          osm["osm_path"] = entry->path;
+          osm["checksum"] = entry->checksum;
+          osms.append(osm);
+          liveGenerations[entry->path] = entry->generation;
+        }
+      }
+    }
+
+    std::map<std::string, std::shared_ptr<MeasureEntry> > measureEntries;
+    {
+      std::lock_guard<std::mutex> lock(m_measureMutex);
+      measureEntries = m_measures;
+    }
+
+    Json::Value measures(Json::arrayValue);
+    Json::Value measureInfo(Json::arrayValue);
+    for (const auto& measureEntry : measureEntries){
+      std::lock_guard<std::mutex> lock(measureEntry.second->mutex);
+
+      const boost::optional<BCLMeasure>& measure = measureEntry.second->measure;
+      if (!measure){
+        continue;
+      }
+
+      const openstudio::path measureDir = toPath(measureEntry.first);
+      measures.append(measureHash(measureDir, *measure));
+
+      for (const auto& infoEntry : measureEntry.second->info){
+        if (!infoEntry.first.empty()){
+          auto it = liveGenerations.find(infoEntry.first);
+          if ((it == liveGenerations.end()) || (it->second != infoEntry.second.modelGeneration)){
+            continue;
+          }
+        }
+
+        Json::Value info(Json::objectValue);
+        info["measure_dir"] = measureEntry.first;
+        info["osm_path"] = infoEntry.first;
+        info["arguments"] = measureHash(measureDir, *measure, infoEntry.second.info)["arguments"];
+        measureInfo.append(info);
+      }
+    }
+
+    Json::Value result(Json::objectValue);
+    result["osms"] = osms;
+    result["measures"] = measures;
+    result["measure_info"] = measureInfo;
+    return result;
+  }
+
+} // cli
+} // openstudio
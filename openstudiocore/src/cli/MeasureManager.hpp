@@ -0,0 +1,172 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef CLI_MEASUREMANAGER_HPP
+#define CLI_MEASUREMANAGER_HPP
+
+#include "../measure/OSMeasureInfoGetter.hpp"
+#include "../model/Model.hpp"
+#include "../utilities/bcl/BCLMeasure.hpp"
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Path.hpp"
+#include "../utilities/idf/Workspace.hpp"
+
+#include <jsoncpp/json.h>
+
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace openstudio {
+namespace cli {
+
+  /** Work that has to run on the thread which owns the embedded Ruby interpreter: user measure
+   *  code, README.md.erb templates and the local BCL database connection. Calls may come from any
+   *  thread and block until the work is done, exceptions thrown by the work are rethrown. */
+  class InterpreterThread {
+   public:
+    virtual ~InterpreterThread() {}
+
+    /// runs task on the interpreter thread
+    virtual void run(const std::function<void ()>& task) = 0;
+
+    /// runs the measure's arguments and outputs methods, never throws
+    virtual measure::OSMeasureInfo getInfo(const BCLMeasure& measure,
+                                           const model::OptionalModel& model,
+                                           const OptionalWorkspace& workspace) = 0;
+
+    /// renders readmeInPath (a README.md.erb) to README.md next to it, throws on failure
+    virtual void renderReadme(const measure::OSMeasureInfo& info,
+                              const openstudio::path& readmeInPath,
+                              const std::string& measureHashJSON) = 0;
+  };
+
+  /** MeasureManager is the native counterpart of measure_manager.rb. It caches measures, measure
+   *  information and a bounded number of loaded models so that the measure manager server can answer
+   *  requests from several threads at once. Models are keyed by path and validated against the file's
+   *  modification time and size, each path is only loaded once even if several requests ask for it.
+   *  All public methods are thread safe. */
+  class MeasureManager {
+   public:
+
+    MeasureManager(InterpreterThread& interpreterThread, unsigned maxCachedModels = 8);
+
+    /// forget all cached models, workspaces, measures and measure information
+    void reset();
+
+    /// returns a private copy of the model at osmPath and of its translation to EnergyPlus
+    boost::optional<std::pair<model::Model, Workspace> > getModel(const openstudio::path& osmPath, bool forceReload);
+
+    /// returns a private copy of the idf at idfPath
+    boost::optional<Workspace> getIdf(const openstudio::path& idfPath, bool forceReload);
+
+    /// returns the measure in measureDir, updating measure.xml and README.md if the measure has changed
+    boost::optional<BCLMeasure> getMeasure(const openstudio::path& measureDir, bool forceReload);
+
+    /// returns the hash for the measure, arguments are computed with the model at osmPath if given
+    Json::Value computeArguments(const openstudio::path& measureDir, const boost::optional<openstudio::path>& osmPath,
+                                 bool forceReload);
+
+    /// returns the hash describing measure, arguments come from info if given or from measure.xml otherwise
+    Json::Value measureHash(const openstudio::path& measureDir, const BCLMeasure& measure,
+                            const boost::optional<measure::OSMeasureInfo>& info = boost::none) const;
+
+    /// returns the cached models, measures and measure information
+    Json::Value internalState();
+
+   private:
+    REGISTER_LOGGER("openstudio.cli.MeasureManager");
+
+    struct ModelEntry {
+      std::string path;
+      bool isIdf;
+      std::time_t lastWriteTime;
+      uintmax_t fileSize;
+      // false if the file was written too close to the load for its modification time to be conclusive
+      bool metadataTrusted;
+      unsigned generation;
+      std::string checksum;
+      boost::optional<model::Model> model;
+      boost::optional<Workspace> workspace;
+      std::shared_future<bool> loaded;
+      // loaded objects are shared, copies are made one at a time
+      std::mutex cloneMutex;
+    };
+
+    struct MeasureInfoEntry {
+      unsigned modelGeneration;
+      measure::OSMeasureInfo info;
+    };
+
+    struct MeasureEntry {
+      std::mutex mutex;
+      boost::optional<BCLMeasure> measure;
+      // osm path or empty string => info
+      std::map<std::string, MeasureInfoEntry> info;
+    };
+
+    std::shared_ptr<ModelEntry> modelEntry(const openstudio::path& p, bool isIdf, bool forceReload);
+
+    bool loadModelEntry(ModelEntry& entry);
+
+    void removeModelEntry(const std::shared_ptr<ModelEntry>& entry);
+
+    std::shared_ptr<MeasureEntry> measureEntry(const std::string& measureDir);
+
+    // entry.mutex must be held
+    boost::optional<BCLMeasure> getMeasure(MeasureEntry& entry, const openstudio::path& measureDir, bool forceReload);
+
+    // entry.mutex must be held
+    measure::OSMeasureInfo getMeasureInfo(MeasureEntry& entry, const BCLMeasure& measure,
+                                          const std::shared_ptr<ModelEntry>& model);
+
+    InterpreterThread& m_interpreterThread;
+    unsigned m_maxCachedModels;
+
+    std::mutex m_modelMutex;
+    unsigned m_modelGeneration;
+    // most recently used first
+    std::list<std::shared_ptr<ModelEntry> > m_models;
+
+    std::mutex m_measureMutex;
+    std::map<std::string, std::shared_ptr<MeasureEntry> > m_measures;
+  };
+
+} // cli
+} // openstudio
+
+#endif // CLI_MEASUREMANAGER_HPP
@@ -0,0 +1,248 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "MeasureManagerCommand.hpp"
+#include "MeasureManager.hpp"
+#include "MeasureManagerServer.hpp"
+#include "RubyInterpreter.hpp"
+
+#include "../measure/EmbeddedRubyMeasureInfoGetter.hpp"
+
+#include <ruby/thread.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace openstudio {
+namespace cli {
+
+  namespace {
+
+    /** Runs tasks posted by the server's worker threads on the Ruby main thread. While waiting for work
+     *  the global VM lock is released, so Ruby can still deliver signals to the main thread. */
+    class RubyInterpreterThread : public InterpreterThread {
+     public:
+
+      RubyInterpreterThread()
+        : m_rubyInterpreter(std::make_shared<RubyInterpreter>(std::vector<std::string>())),
+          m_infoGetter(m_rubyInterpreter),
+          m_threadId(std::this_thread::get_id()),
+          m_woken(false),
+          m_stopped(false)
+      {
+      }
+
+      virtual ~RubyInterpreterThread()
+      {
+        stop();
+      }
+
+      void run(const std::function<void ()>& task) override
+      {
+        if (std::this_thread::get_id() == m_threadId){
+          task();
+          return;
+        }
+
+        std::packaged_task<void ()> packagedTask(task);
+        std::future<void> result = packagedTask.get_future();
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          if (m_stopped){
+            throw std::runtime_error("Measure manager server is shutting down");
+          }
+          m_tasks.push_back(std::move(packagedTask));
+        }
+        m_condition.notify_one();
+
+        // rethrows anything thrown by the task, or broken_promise if the server stopped first
+        result.get();
+      }
+
+      measure::OSMeasureInfo getInfo(const BCLMeasure& measure,
+                                     const model::OptionalModel& model,
+                                     const OptionalWorkspace& workspace) override
+      {
+        boost::optional<measure::OSMeasureInfo> result;
+        try {
+          run([&]() {
+            if (model && workspace){
+              result = m_infoGetter.getInfo(measure, *model, *workspace);
+            } else if (workspace){
+              result = m_infoGetter.getInfo(measure, *workspace);
+            } else {
+              result = m_infoGetter.getInfo(measure);
+            }
+          });
+        } catch (const std::exception& e) {
+          result = measure::OSMeasureInfo(e.what());
+        }
+        return *result;
+      }
+
+      void renderReadme(const measure::OSMeasureInfo& info,
+                        const openstudio::path& readmeInPath,
+                        const std::string& measureHashJSON) override
+      {
+        run([&]() {
+          m_rubyInterpreter->exec<void>("MeasureInfoBinding.render_readme_json", info, toString(readmeInPath), measureHashJSON);
+        });
+      }
+
+      /// runs posted tasks until the Ruby main thread is interrupted
+      void exec()
+      {
+        for (;;){
+          std::packaged_task<void ()> task;
+          WaitData data = {this, &task, false};
+
+          // a pending interrupt may raise as soon as the lock is released or reacquired, the jump must not
+          // cross any C++ frames
+          int state = 0;
+          rb_protect(waitProtected, reinterpret_cast<VALUE>(&data), &state);
+          if ((state == 0) && !data.hasTask){
+            rb_protect(checkInterruptsProtected, Qnil, &state);
+          }
+          if (state != 0){
+            rb_set_errinfo(Qnil);
+            break;
+          }
+
+          if (data.hasTask){
+            // exceptions are passed on to the waiting worker thread
+            task();
+          }
+        }
+
+        stop();
+      }
+
+      /// rejects all pending and future tasks
+      void stop()
+      {
+        std::deque<std::packaged_task<void ()> > tasks;
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          m_stopped = true;
+          tasks.swap(m_tasks);
+        }
+      }
+
+     private:
+
+      struct WaitData {
+        RubyInterpreterThread* self;
+        std::packaged_task<void ()>* task;
+        bool hasTask;
+      };
+
+      static VALUE waitProtected(VALUE arg)
+      {
+        WaitData* data = reinterpret_cast<WaitData*>(arg);
+        rb_thread_call_without_gvl(waitWithoutGVL, data, wake, data->self);
+        return Qnil;
+      }
+
+      static void* waitWithoutGVL(void* arg)
+      {
+        WaitData* data = static_cast<WaitData*>(arg);
+        data->hasTask = data->self->waitForTask(*data->task);
+        return nullptr;
+      }
+
+      // called by Ruby from another thread when the main thread has to handle an interrupt
+      static void wake(void* arg)
+      {
+        RubyInterpreterThread* self = static_cast<RubyInterpreterThread*>(arg);
+        {
+          std::lock_guard<std::mutex> lock(self->m_mutex);
+          self->m_woken = true;
+        }
+        self->m_condition.notify_all();
+      }
+
+      static VALUE checkInterruptsProtected(VALUE)
+      {
+        rb_thread_check_ints();
+        return Qnil;
+      }
+
+      bool waitForTask(std::packaged_task<void ()>& task)
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_woken || !m_tasks.empty(); });
+        if (!m_tasks.empty()){
+          task = std::move(m_tasks.front());
+          m_tasks.pop_front();
+          return true;
+        }
+        m_woken = false;
+        return false;
+      }
+
+      std::shared_ptr<RubyInterpreter> m_rubyInterpreter;
+      measure::EmbeddedRubyMeasureInfoGetter<RubyInterpreter> m_infoGetter;
+      std::thread::id m_threadId;
+
+      std::mutex m_mutex;
+      std::condition_variable m_condition;
+      std::deque<std::packaged_task<void ()> > m_tasks;
+      bool m_woken;
+      bool m_stopped;
+    };
+
+  }
+
+  int runMeasureManagerServer(int port, int numThreads)
+  {
+    RubyInterpreterThread interpreterThread;
+    MeasureManager measureManager(interpreterThread);
+    MeasureManagerServer server(measureManager, interpreterThread, static_cast<unsigned short>(port),
+                                static_cast<unsigned>(std::max(numThreads, 0)));
+
+    try {
+      server.start();
+    } catch (const std::exception& e) {
+      LOG_FREE(Error, "openstudio.cli.MeasureManagerServer", e.what());
+      return 1;
+    }
+
+    // returns on Ctrl-C
+    interpreterThread.exec();
+
+    // worker threads waiting on the interpreter thread have been released by now
+    server.stop();
+
+    return 0;
+  }
+
+} // cli
+} // openstudio
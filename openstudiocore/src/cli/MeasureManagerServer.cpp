@@ -0,0 +1,686 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "MeasureManagerServer.hpp"
+#include "MeasureManager.hpp"
+#include "RubyException.hpp"
+
+#include "../utilities/bcl/BCLMeasure.hpp"
+#include "../utilities/bcl/LocalBCL.hpp"
+#include "../utilities/bcl/RemoteBCL.hpp"
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/PathHelpers.hpp"
+#include "../utilities/core/StringHelpers.hpp"
+
+#include <jsoncpp/json.h>
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/asio.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/shared_mutex.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace openstudio {
+namespace cli {
+
+  namespace {
+
+    // requests are small JSON documents, anything larger is refused
+    const std::size_t maxRequestSize = 16 * 1024 * 1024;
+
+    struct Response {
+      unsigned status;
+      std::string body;
+    };
+
+    const char* statusText(unsigned status)
+    {
+      switch (status){
+        case 200: return "OK";
+        case 400: return "Bad Request";
+        case 405: return "Method Not Allowed";
+        case 413: return "Payload Too Large";
+        default: return "Internal Server Error";
+      }
+    }
+
+    std::string toJSON(const Json::Value& value)
+    {
+      Json::FastWriter writer;
+      return writer.write(value);
+    }
+
+    Json::Value parseRequest(const std::string& body)
+    {
+      Json::Value result;
+      Json::Reader reader;
+      if (!reader.parse(body, result)){
+        throw std::runtime_error("Cannot parse request: " + reader.getFormattedErrorMessages());
+      }
+      if (!result.isObject()){
+        throw std::runtime_error("Request must be a JSON object");
+      }
+      return result;
+    }
+
+    boost::optional<std::string> optionalString(const Json::Value& data, const std::string& key)
+    {
+      const Json::Value& value = data[key];
+      if (value.isNull()){
+        return boost::none;
+      }
+      return value.asString();
+    }
+
+    std::string requiredString(const Json::Value& data, const std::string& key)
+    {
+      boost::optional<std::string> result = optionalString(data, key);
+      if (!result){
+        throw std::runtime_error("Missing required argument '" + key + "'");
+      }
+      return *result;
+    }
+
+    bool optionalBool(const Json::Value& data, const std::string& key)
+    {
+      const Json::Value& value = data[key];
+      return !value.isNull() && value.asBool();
+    }
+
+    // equivalent of Ruby's File.expand_path
+    openstudio::path expandPath(const std::string& p)
+    {
+      return completeAndNormalize(toPath(p));
+    }
+
+  }
+
+  namespace detail {
+
+    class MeasureManagerServer_Impl {
+     public:
+
+      MeasureManagerServer_Impl(MeasureManager& measureManager, InterpreterThread& interpreterThread,
+                                unsigned short port, unsigned numThreads);
+
+      ~MeasureManagerServer_Impl();
+
+      void start();
+
+      void stop();
+
+      unsigned short port() const;
+
+      Response handle(const std::string& method, const std::string& target, const std::string& body);
+
+     private:
+      REGISTER_LOGGER("openstudio.cli.MeasureManagerServer");
+
+      void accept();
+
+      Response handleGet(const std::string& target);
+
+      Response handlePost(const std::string& target, const std::string& body);
+
+      Json::Value bclMeasures(bool forceReload);
+
+      Json::Value updateMeasures(const openstudio::path& measuresDir, bool forceReload);
+
+      Json::Value createMeasure(const Json::Value& data);
+
+      Json::Value duplicateMeasure(const Json::Value& data);
+
+      MeasureManager& m_measureManager;
+      InterpreterThread& m_interpreterThread;
+      unsigned short m_port;
+      unsigned m_numThreads;
+
+      boost::asio::io_service m_ioService;
+      std::unique_ptr<boost::asio::io_service::work> m_work;
+      boost::asio::ip::tcp::acceptor m_acceptor;
+      std::vector<std::thread> m_threads;
+
+      // requests that replace the server's state are exclusive, all others run concurrently
+      boost::shared_mutex m_stateMutex;
+    };
+
+  }
+
+  namespace {
+
+    /// One HTTP/1.1 request and its response, the connection is closed after the response is written
+    class Connection : public std::enable_shared_from_this<Connection> {
+     public:
+
+      Connection(boost::asio::io_service& ioService, detail::MeasureManagerServer_Impl& server)
+        : m_socket(ioService), m_buffer(maxRequestSize), m_server(server), m_contentLength(0)
+      {}
+
+      boost::asio::ip::tcp::socket& socket()
+      {
+        return m_socket;
+      }
+
+      void start()
+      {
+        std::shared_ptr<Connection> self = shared_from_this();
+        boost::asio::async_read_until(m_socket, m_buffer, "\r\n\r\n",
+          [self](const boost::system::error_code& ec, std::size_t headerSize) { self->onHeaders(ec, headerSize); });
+      }
+
+     private:
+
+      void onHeaders(const boost::system::error_code& ec, std::size_t headerSize)
+      {
+        if (ec == boost::asio::error::not_found){
+          respond(Response{413, "Error, request headers are too large"});
+          return;
+        } else if (ec){
+          return;
+        }
+
+        std::string headers(boost::asio::buffers_begin(m_buffer.data()), boost::asio::buffers_begin(m_buffer.data()) + headerSize);
+        m_buffer.consume(headerSize);
+
+        std::istringstream is(headers);
+        std::string line;
+        std::getline(is, line);
+        std::istringstream requestLine(line);
+        requestLine >> m_method >> m_target;
+
+        // the measure manager API does not use query strings
+        m_target = m_target.substr(0, m_target.find('?'));
+
+        bool expectContinue = false;
+        while (std::getline(is, line)){
+          std::string::size_type colon = line.find(':');
+          if (colon == std::string::npos){
+            continue;
+          }
+          std::string name = boost::algorithm::to_lower_copy(line.substr(0, colon));
+          std::string value = boost::algorithm::trim_copy(line.substr(colon + 1));
+          if (name == "content-length"){
+            m_contentLength = std::strtoul(value.c_str(), nullptr, 10);
+          } else if (name == "expect"){
+            expectContinue = boost::algorithm::iequals(value, "100-continue");
+          }
+        }
+
+        if (m_contentLength > maxRequestSize){
+          respond(Response{413, "Error, request body is too large"});
+          return;
+        }
+
+        if (m_buffer.size() >= m_contentLength){
+          onBody(boost::system::error_code());
+          return;
+        }
+
+        if (expectContinue){
+          boost::system::error_code writeError;
+          boost::asio::write(m_socket, boost::asio::buffer(std::string("HTTP/1.1 100 Continue\r\n\r\n")), writeError);
+          if (writeError){
+            return;
+          }
+        }
+
+        std::shared_ptr<Connection> self = shared_from_this();
+        boost::asio::async_read(m_socket, m_buffer, boost::asio::transfer_exactly(m_contentLength - m_buffer.size()),
+          [self](const boost::system::error_code& ec, std::size_t) { self->onBody(ec); });
+      }
+
+      void onBody(const boost::system::error_code& ec)
+      {
+        if (ec){
+          return;
+        }
+
+        std::string body(boost::asio::buffers_begin(m_buffer.data()), boost::asio::buffers_begin(m_buffer.data()) + m_contentLength);
+        m_buffer.consume(m_contentLength);
+
+        respond(m_server.handle(m_method, m_target, body));
+      }
+
+      void respond(const Response& response)
+      {
+        std::ostringstream ss;
+        ss << "HTTP/1.1 " << response.status << " " << statusText(response.status) << "\r\n"
+           << "Content-Type: application/json\r\n"
+           << "Content-Length: " << response.body.size() << "\r\n"
+           << "Connection: close\r\n"
+           << "\r\n"
+           << response.body;
+        m_response = ss.str();
+
+        std::shared_ptr<Connection> self = shared_from_this();
+        boost::asio::async_write(m_socket, boost::asio::buffer(m_response),
+          [self](const boost::system::error_code&, std::size_t) {
+            boost::system::error_code ignored;
+            self->m_socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored);
+            self->m_socket.close(ignored);
+          });
+      }
+
+      boost::asio::ip::tcp::socket m_socket;
+      boost::asio::streambuf m_buffer;
+      detail::MeasureManagerServer_Impl& m_server;
+      std::string m_method;
+      std::string m_target;
+      std::size_t m_contentLength;
+      std::string m_response;
+    };
+
+  }
+
+  namespace detail {
+
+    MeasureManagerServer_Impl::MeasureManagerServer_Impl(MeasureManager& measureManager, InterpreterThread& interpreterThread,
+                                                         unsigned short port, unsigned numThreads)
+      : m_measureManager(measureManager), m_interpreterThread(interpreterThread), m_port(port),
+        m_numThreads(numThreads > 0 ? numThreads : std::max(2u, std::thread::hardware_concurrency())),
+        m_acceptor(m_ioService)
+    {
+    }
+
+    MeasureManagerServer_Impl::~MeasureManagerServer_Impl()
+    {
+      stop();
+    }
+
+    void MeasureManagerServer_Impl::start()
+    {
+      using boost::asio::ip::tcp;
+
+      try {
+        // accept IPv4 and IPv6 connections where the platform allows it, clients often resolve localhost to ::1
+        boost::system::error_code ec;
+        m_acceptor.open(tcp::v6(), ec);
+        if (!ec){
+          m_acceptor.set_option(boost::asio::ip::v6_only(false), ec);
+        }
+        tcp::endpoint endpoint(ec ? tcp::v4() : tcp::v6(), m_port);
+        if (ec){
+          boost::system::error_code ignored;
+          m_acceptor.close(ignored);
+          m_acceptor.open(tcp::v4());
+        }
+        m_acceptor.set_option(tcp::acceptor::reuse_address(true));
+        m_acceptor.bind(endpoint);
+        m_acceptor.listen();
+      } catch (const boost::system::system_error& e) {
+        throw std::runtime_error("Cannot start measure manager server on port " + std::to_string(m_port) + ": " + e.what());
+      }
+
+      m_work.reset(new boost::asio::io_service::work(m_ioService));
+      accept();
+
+      for (unsigned i = 0; i < m_numThreads; ++i){
+        m_threads.emplace_back([this]() { m_ioService.run(); });
+      }
+
+      LOG(Info, "Measure manager server listening on port " << m_port << " with " << m_numThreads << " worker threads");
+    }
+
+    void MeasureManagerServer_Impl::stop()
+    {
+      if (m_threads.empty()){
+        return;
+      }
+
+      boost::system::error_code ignored;
+      m_acceptor.close(ignored);
+      m_work.reset();
+      m_ioService.stop();
+
+      for (std::thread& thread : m_threads){
+        thread.join();
+      }
+      m_threads.clear();
+    }
+
+    unsigned short MeasureManagerServer_Impl::port() const
+    {
+      return m_port;
+    }
+
+    void MeasureManagerServer_Impl::accept()
+    {
+      std::shared_ptr<Connection> connection = std::make_shared<Connection>(m_ioService, *this);
+      m_acceptor.async_accept(connection->socket(), [this, connection](const boost::system::error_code& ec) {
+        if (!m_acceptor.is_open()){
+          return;
+        }
+        accept();
+        if (!ec){
+          connection->start();
+        }
+      });
+    }
+
+    Response MeasureManagerServer_Impl::handle(const std::string& method, const std::string& target, const std::string& body)
+    {
+      Response result{200, std::string()};
+
+      try {
+        if (method == "GET"){
+          result = handleGet(target);
+        } else if (method == "POST"){
+          result = handlePost(target, body);
+        } else {
+          result = Response{405, "Error, unsupported method " + method};
+        }
+      } catch (const RubyException& e) {
+        Json::Value error(Json::objectValue);
+        error["error"] = e.what();
+        error["backtrace"] = e.location();
+        result = Response{400, toJSON(error)};
+        LOG(Error, e.what() << std::endl << e.location());
+      } catch (const std::exception& e) {
+        Json::Value error(Json::objectValue);
+        error["error"] = e.what();
+        error["backtrace"] = "[]";
+        result = Response{400, toJSON(error)};
+        LOG(Error, e.what());
+      }
+
+      LOG(Debug, method << " " << target << " " << result.status);
+
+      return result;
+    }
+
+    Response MeasureManagerServer_Impl::handleGet(const std::string& target)
+    {
+      Json::Value result(Json::objectValue);
+      result["status"] = "running";
+      result["my_measures_dir"] = toString(BCLMeasure::userMeasuresDir());
+
+      if (target == "/"){
+
+        return Response{200, toJSON(result)};
+
+      } else if (target == "/internal_state"){
+
+        boost::shared_lock<boost::shared_mutex> lock(m_stateMutex);
+
+        Json::Value state = m_measureManager.internalState();
+        result["osms"] = state["osms"];
+        result["measures"] = state["measures"];
+        result["measure_info"] = state["measure_info"];
+
+        return Response{200, toJSON(result)};
+      }
+
+      return Response{400, "Error, unknown path " + target};
+    }
+
+    Response MeasureManagerServer_Impl::handlePost(const std::string& target, const std::string& body)
+    {
+      if (target == "/reset"){
+
+        boost::unique_lock<boost::shared_mutex> lock(m_stateMutex);
+
+        m_measureManager.reset();
+        LOG(Info, "Reseting internal state");
+
+        return Response{200, toJSON(Json::Value(Json::objectValue))};
+
+      } else if (target == "/set"){
+
+        Json::Value data = parseRequest(body);
+
+        boost::unique_lock<boost::shared_mutex> lock(m_stateMutex);
+
+        if (boost::optional<std::string> myMeasuresDir = optionalString(data, "my_measures_dir")){
+          if (!BCLMeasure::setUserMeasuresDir(toPath(*myMeasuresDir))){
+            throw std::runtime_error("Failed to set my_measures_dir = '" + *myMeasuresDir + "'");
+          }
+        }
+
+        return Response{200, toJSON(Json::Value(Json::objectValue))};
+      }
+
+      boost::shared_lock<boost::shared_mutex> lock(m_stateMutex);
+
+      if (target == "/download_bcl_measure"){
+
+        Json::Value data = parseRequest(body);
+        std::string uid = requiredString(data, "uid");
+
+        // RemoteBCL stores downloads in the local BCL, whose database connection belongs to the interpreter thread
+        boost::optional<BCLMeasure> measure;
+        m_interpreterThread.run([&]() {
+          RemoteBCL remoteBCL;
+          measure = remoteBCL.getMeasure(uid);
+        });
+        if (!measure){
+          throw std::runtime_error("Failed to download measure '" + uid + "'");
+        }
+
+        Json::Value result(Json::arrayValue);
+        result.append(m_measureManager.measureHash(measure->directory(), *measure));
+        return Response{200, toJSON(result)};
+
+      } else if (target == "/bcl_measures"){
+
+        parseRequest(body);
+        return Response{200, toJSON(bclMeasures(false))};
+
+      } else if (target == "/update_measures"){
+
+        Json::Value data = parseRequest(body);
+        boost::optional<std::string> measuresDir = optionalString(data, "measures_dir");
+        bool forceReload = optionalBool(data, "force_reload");
+
+        openstudio::path dir = measuresDir ? toPath(*measuresDir) : BCLMeasure::userMeasuresDir();
+        return Response{200, toJSON(updateMeasures(dir, forceReload))};
+
+      } else if (target == "/compute_arguments"){
+
+        Json::Value data = parseRequest(body);
+        openstudio::path measureDir = expandPath(requiredString(data, "measure_dir"));
+        bool forceReload = optionalBool(data, "force_reload");
+
+        boost::optional<openstudio::path> osmPath;
+        if (boost::optional<std::string> osm = optionalString(data, "osm_path")){
+          osmPath = expandPath(*osm);
+        }
+
+        return Response{200, toJSON(m_measureManager.computeArguments(measureDir, osmPath, forceReload))};
+
+      } else if (target == "/create_measure"){
+
+        return Response{200, toJSON(createMeasure(parseRequest(body)))};
+
+      } else if (target == "/duplicate_measure"){
+
+        return Response{200, toJSON(duplicateMeasure(parseRequest(body)))};
+      }
+
+      return Response{400, "Error, unknown path " + target};
+    }
+
+    Json::Value MeasureManagerServer_Impl::bclMeasures(bool forceReload)
+    {
+      std::vector<openstudio::path> measureDirs;
+      m_interpreterThread.run([&]() {
+        for (const BCLMeasure& localMeasure : LocalBCL::instance().measures()){
+          measureDirs.push_back(localMeasure.directory());
+        }
+      });
+
+      Json::Value result(Json::arrayValue);
+      for (const openstudio::path& dir : measureDirs){
+        openstudio::path measureDir = completeAndNormalize(dir);
+        if (openstudio::filesystem::is_directory(measureDir)){
+          boost::optional<BCLMeasure> measure = m_measureManager.getMeasure(measureDir, forceReload);
+          if (measure){
+            result.append(m_measureManager.measureHash(measureDir, *measure));
+          } else {
+            LOG(Info, "Directory " << toString(measureDir) << " is not a measure");
+          }
+        }
+      }
+      return result;
+    }
+
+    Json::Value MeasureManagerServer_Impl::updateMeasures(const openstudio::path& measuresDir, bool forceReload)
+    {
+      std::vector<openstudio::path> measureDirs;
+      boost::system::error_code ec;
+      for (openstudio::filesystem::directory_iterator it(measuresDir, ec), end; !ec && it != end; it.increment(ec)){
+        // hidden directories were never picked up by the Ruby server's Dir.glob
+        if (boost::algorithm::starts_with(toString(it->path().filename()), ".")){
+          continue;
+        }
+        if (openstudio::filesystem::is_directory(it->path())){
+          measureDirs.push_back(completeAndNormalize(it->path()));
+        }
+      }
+      std::sort(measureDirs.begin(), measureDirs.end());
+
+      Json::Value result(Json::arrayValue);
+      for (const openstudio::path& measureDir : measureDirs){
+        boost::optional<BCLMeasure> measure = m_measureManager.getMeasure(measureDir, forceReload);
+        if (measure){
+          result.append(m_measureManager.measureHash(measureDir, *measure));
+        } else {
+          LOG(Info, "Directory " << toString(measureDir) << " is not a measure");
+        }
+      }
+      return result;
+    }
+
+    Json::Value MeasureManagerServer_Impl::createMeasure(const Json::Value& data)
+    {
+      openstudio::path measureDir = expandPath(requiredString(data, "measure_dir"));
+
+      // the measure's name method actually maps to display name, name is not taken as input
+      std::string displayName = requiredString(data, "display_name");
+      std::string className = requiredString(data, "class_name");
+      std::string taxonomyTag = requiredString(data, "taxonomy_tag");
+      std::string measureType = requiredString(data, "measure_type");
+      std::string description = requiredString(data, "description");
+      std::string modelerDescription = requiredString(data, "modeler_description");
+
+      // throws if the directory exists but is not empty
+      BCLMeasure(displayName, className, measureDir, taxonomyTag, MeasureType(measureType), description, modelerDescription);
+
+      boost::optional<BCLMeasure> measure = m_measureManager.getMeasure(measureDir, true);
+      if (!measure){
+        throw std::runtime_error("Cannot load measure at '" + toString(measureDir) + "'");
+      }
+      return m_measureManager.measureHash(measureDir, *measure);
+    }
+
+    Json::Value MeasureManagerServer_Impl::duplicateMeasure(const Json::Value& data)
+    {
+      openstudio::path oldMeasureDir = expandPath(requiredString(data, "old_measure_dir"));
+      openstudio::path measureDir = expandPath(requiredString(data, "measure_dir"));
+      bool forceReload = optionalBool(data, "force_reload");
+
+      boost::optional<BCLMeasure> oldMeasure = m_measureManager.getMeasure(oldMeasureDir, forceReload);
+      if (!oldMeasure){
+        throw std::runtime_error("Cannot load measure at '" + toString(oldMeasureDir) + "'");
+      }
+
+      // the measure's name method actually maps to display name, name is not taken as input
+      std::string displayName = optionalString(data, "display_name").get_value_or(oldMeasure->displayName());
+      std::string className = optionalString(data, "class_name").get_value_or(oldMeasure->className());
+      std::string taxonomyTag = optionalString(data, "taxonomy_tag").get_value_or(oldMeasure->taxonomyTag());
+      MeasureType measureType(optionalString(data, "measure_type").get_value_or(oldMeasure->measureType().valueName()));
+      std::string description = optionalString(data, "description").get_value_or(oldMeasure->description());
+      std::string modelerDescription = optionalString(data, "modeler_description").get_value_or(oldMeasure->modelerDescription());
+      std::string name = toUnderscoreCase(className);
+
+      boost::optional<BCLMeasure> newMeasure = oldMeasure->clone(measureDir);
+      if (!newMeasure){
+        throw std::runtime_error("Cannot copy measure from '" + toString(oldMeasureDir) + "' to '" + toString(measureDir) + "'");
+      }
+
+      newMeasure->changeUID();
+      newMeasure->incrementVersionId();
+
+      newMeasure->setName(name);
+      newMeasure->setDisplayName(displayName);
+      newMeasure->setClassName(className);
+      newMeasure->setTaxonomyTag(taxonomyTag);
+      newMeasure->setMeasureType(measureType);
+      newMeasure->setDescription(description);
+      newMeasure->setModelerDescription(modelerDescription);
+
+      newMeasure->updateMeasureScript(oldMeasure->measureType(), measureType,
+                                      oldMeasure->className(), className,
+                                      displayName, description, modelerDescription);
+      newMeasure->updateMeasureTests(oldMeasure->className(), className);
+
+      newMeasure->save();
+
+      boost::optional<BCLMeasure> measure = m_measureManager.getMeasure(measureDir, true);
+      if (!measure){
+        throw std::runtime_error("Cannot load measure at '" + toString(measureDir) + "'");
+      }
+      return m_measureManager.measureHash(measureDir, *measure);
+    }
+
+  } // detail
+
+  MeasureManagerServer::MeasureManagerServer(MeasureManager& measureManager, InterpreterThread& interpreterThread,
+                                             unsigned short port, unsigned numThreads)
+    : m_impl(std::make_shared<detail::MeasureManagerServer_Impl>(measureManager, interpreterThread, port, numThreads))
+  {
+  }
+
+  MeasureManagerServer::~MeasureManagerServer()
+  {
+  }
+
+  void MeasureManagerServer::start()
+  {
+    m_impl->start();
+  }
+
+  void MeasureManagerServer::stop()
+  {
+    m_impl->stop();
+  }
+
+  unsigned short MeasureManagerServer::port() const
+  {
+    return m_impl->port();
+  }
+
+} // cli
+} // openstudio
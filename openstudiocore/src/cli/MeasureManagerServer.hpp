@@ -0,0 +1,73 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef CLI_MEASUREMANAGERSERVER_HPP
+#define CLI_MEASUREMANAGERSERVER_HPP
+
+#include <memory>
+
+namespace openstudio {
+namespace cli {
+
+  class InterpreterThread;
+  class MeasureManager;
+
+  namespace detail {
+    class MeasureManagerServer_Impl;
+  }
+
+  /** MeasureManagerServer serves the measure manager JSON API over HTTP. Requests are handled by a pool
+   *  of worker threads, so long model loads do not hold up other requests. Requests that change the
+   *  server's state (/reset and /set) wait for all other requests to finish. */
+  class MeasureManagerServer {
+   public:
+
+    /// numThreads is the number of worker threads, 0 uses one per core
+    MeasureManagerServer(MeasureManager& measureManager, InterpreterThread& interpreterThread,
+                         unsigned short port, unsigned numThreads = 0);
+
+    /// stops the server
+    ~MeasureManagerServer();
+
+    /// starts listening on all interfaces, throws if the port cannot be bound
+    void start();
+
+    /// stops accepting requests and waits for the worker threads to finish
+    void stop();
+
+    unsigned short port() const;
+
+   private:
+    std::shared_ptr<detail::MeasureManagerServer_Impl> m_impl;
+  };
+
+} // cli
+} // openstudio
+
+#endif // CLI_MEASUREMANAGERSERVER_HPP
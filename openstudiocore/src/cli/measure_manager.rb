@@ -73,6 +73,39 @@ class MeasureInfoBinding
     result = binding()
     return result
   end
+
+  # renders the README.md.erb at readme_in_path to README.md in the same directory
+  def self.render_readme(info, readme_in_path, result_hash)
+    readme_out_path = File.join(File.dirname(readme_in_path), "README.md")
+
+    # delete README.md if it exists
+    File.delete(readme_out_path) if File.exists?(readme_out_path)
+
+    readme_in = nil
+    File.open(readme_in_path, 'r') do |file|
+      readme_in = file.read
+    end
+
+    renderer = ERB.new(readme_in)
+    result_binding = MeasureInfoBinding.new(info, result_hash)
+    readme_out = renderer.result(result_binding.get_binding)
+
+    # write README.me file
+    File.open(readme_out_path, 'w') do |file|
+      file << readme_out
+      # make sure data is written to the disk one way or the other
+      begin
+        file.fsync
+      rescue StandardError
+        file.flush
+      end
+    end
+  end
+
+  # called by the native measure manager server, which passes the measure hash as JSON
+  def self.render_readme_json(info, readme_in_path, result_json)
+    render_readme(info, readme_in_path, JSON.parse(result_json, {:symbolize_names=>true}))
+  end
 end
           
 class MeasureManager
@@ -312,30 +345,8 @@ class MeasureManager
         if File.exists?(readme_in_path)
           
           begin
-            # delete README.md if it exists
-            File.delete(readme_out_path) if File.exists?(readme_out_path)
-
-            readme_in = nil
-            File.open(readme_in_path, 'r') do |file|
-              readme_in = file.read
-            end
-            
             result_hash = measure_hash(measure_dir, result, info)
-            
-            renderer = ERB.new(readme_in)
-            result_binding = MeasureInfoBinding.new(info, result_hash)
-            readme_out = renderer.result(result_binding.get_binding)
-
-            # write README.me file
-            File.open(readme_out_path, 'w') do |file|
-              file << readme_out
-              # make sure data is written to the disk one way or the other
-              begin
-                file.fsync
-              rescue StandardError
-                file.flush
-              end
-            end
+            MeasureInfoBinding.render_readme(info, readme_in_path, result_hash)
             
             # update the files
             result.checkForUpdatesFiles
@@ -274,6 +274,44 @@ def parse_main_args(main_args)
   # verbose already handled
   main_args.delete('--verbose')
 
+  # Operate on the trace options to collect timing of instrumented OpenStudio scopes
+  trace_file = nil
+  if main_args.include? '--trace'
+    option_index = main_args.index '--trace'
+    path_index = option_index + 1
+    trace_file = main_args[path_index]
+    if trace_file.nil?
+      $logger.error "--trace requires second argument FILE"
+      return false
+    end
+    main_args.slice! path_index
+    main_args.slice! main_args.index '--trace'
+  end
+
+  trace_summary = false
+  if main_args.include? '--trace_summary'
+    main_args.slice! main_args.index '--trace_summary'
+    trace_summary = true
+  end
+
+  if trace_file || trace_summary
+    $logger.info "Enabling tracing"
+    OpenStudio::enableTracing
+    at_exit do
+      OpenStudio::disableTracing
+      if trace_file
+        if OpenStudio::writeChromeTrace(OpenStudio::toPath(trace_file))
+          $logger.info "Wrote trace to '#{trace_file}'"
+        else
+          $logger.error "Unable to write trace to '#{trace_file}'"
+        end
+      end
+      if trace_summary
+        safe_puts OpenStudio::traceSummary
+      end
+    end
+  end
+
   # Operate on the include option to add to $LOAD_PATH
   remove_indices = []
   new_path = []
@@ -748,7 +786,8 @@ class CLI
                   '--no-ssl',
                   '-i', '--include',
                   '-e', '--execute',
-                  '--gem_path', '--gem_home', '--bundle', '--bundle_path']
+                  '--gem_path', '--gem_home', '--bundle', '--bundle_path',
+                  '--trace', '--trace_summary']
       command_list.each do |key, data|
         # Skip non-primary commands. These only show up in extended
         # help output.
@@ -770,6 +809,8 @@ class CLI
         o.on('--gem_home DIR', 'Set GEM_HOME environment variable')
         o.on('--bundle GEMFILE', 'Use bundler for GEMFILE')
         o.on('--bundle_path BUNDLE_PATH', 'Use bundler installed gems in BUNDLE_PATH')
+        o.on('--trace FILE', 'Write timing of instrumented OpenStudio scopes to FILE in Chrome trace event format')
+        o.on('--trace_summary', 'Print a summary table of timing of instrumented OpenStudio scopes on exit')
         o.separator ''
         o.separator 'Common commands:'
 
@@ -1309,13 +1350,19 @@ class Measure
     
     elsif options[:start_server]
 
-      require_relative 'measure_manager_server'
-
       port = options[:start_server_port]
       if port.nil?
         port = 1234
       end
 
+      if defined?(EmbeddedScripting) && EmbeddedScripting.respond_to?(:runMeasureManagerServer)
+        # native server handles requests concurrently, measure code is still run on this thread
+        require_relative 'measure_manager'
+        return EmbeddedScripting::runMeasureManagerServer(port.to_i)
+      end
+
+      require_relative 'measure_manager_server'
+
       server = WEBrick::HTTPServer.new(:Port => port)
 
       server.mount "/", MeasureManagerServlet
@@ -0,0 +1,155 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "MeasureManagerFixture.hpp"
+
+#include "../../measure/OSArgument.hpp"
+#include "../../measure/OSOutput.hpp"
+#include "../../model/Model.hpp"
+#include "../../model/Space.hpp"
+#include "../../utilities/bcl/BCLMeasure.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
+
+#include <resources.hxx>
+
+#include <ctime>
+
+using namespace openstudio;
+
+FakeInterpreterThread::FakeInterpreterThread()
+  : m_numGetInfo(0)
+{
+}
+
+void FakeInterpreterThread::run(const std::function<void ()>& task)
+{
+  task();
+}
+
+measure::OSMeasureInfo FakeInterpreterThread::getInfo(const BCLMeasure& measure,
+                                                      const model::OptionalModel& model,
+                                                      const OptionalWorkspace& workspace)
+{
+  ++m_numGetInfo;
+
+  std::vector<measure::OSArgument> arguments;
+  measure::OSArgument numSpaces = measure::OSArgument::makeIntegerArgument("num_spaces", true, true);
+  numSpaces.setDefaultValue(model ? static_cast<int>(model->getConcreteModelObjects<model::Space>().size()) : 0);
+  arguments.push_back(numSpaces);
+
+  return measure::OSMeasureInfo(measure.measureType(), measure.className(), measure.displayName(), measure.description(),
+                                measure.taxonomyTag(), measure.modelerDescription(), arguments, std::vector<measure::OSOutput>());
+}
+
+void FakeInterpreterThread::renderReadme(const measure::OSMeasureInfo& info,
+                                         const openstudio::path& readmeInPath,
+                                         const std::string& measureHashJSON)
+{
+  openstudio::filesystem::ofstream file(readmeInPath.parent_path() / toPath("README.md"));
+  file << "# " << info.name() << "\n";
+}
+
+unsigned FakeInterpreterThread::numGetInfo() const
+{
+  return m_numGetInfo;
+}
+
+void MeasureManagerFixture::SetUp()
+{
+  const ::testing::TestInfo* testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+  testDir = openstudio::filesystem::system_complete(toPath("./MeasureManagerFixture") / toPath(testInfo->name()));
+  if (openstudio::filesystem::exists(testDir)){
+    removeDirectory(testDir);
+  }
+  openstudio::filesystem::create_directories(testDir);
+
+  measureManagerLog = std::make_shared<StringStreamLogSink>();
+  measureManagerLog->setLogLevel(Debug);
+  measureManagerLog->setChannelRegex(boost::regex("openstudio\\.cli\\.MeasureManager"));
+}
+
+void MeasureManagerFixture::TearDown()
+{
+  measureManagerLog->disable();
+  measureManagerLog.reset();
+}
+
+void MeasureManagerFixture::SetUpTestCase()
+{
+  // set up logging
+  openstudio::Logger::instance().standardOutLogger().disable();
+  logFile = std::shared_ptr<openstudio::FileLogSink>(new openstudio::FileLogSink(openstudio::toPath("./MeasureManagerFixture.log")));
+}
+
+void MeasureManagerFixture::TearDownTestCase()
+{
+  logFile->disable();
+}
+
+openstudio::path MeasureManagerFixture::saveModel(const std::string& name, unsigned numSpaces)
+{
+  model::Model model;
+  for (unsigned i = 0; i < numSpaces; ++i){
+    model::Space space(model);
+  }
+
+  openstudio::path result = testDir / toPath(name + ".osm");
+  EXPECT_TRUE(model.save(result, true));
+  openstudio::filesystem::last_write_time(result, std::time(nullptr) - 3600);
+  return result;
+}
+
+openstudio::path MeasureManagerFixture::copyMeasure()
+{
+  openstudio::path dir = resourcesPath() / toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/");
+  boost::optional<BCLMeasure> measure = BCLMeasure::load(dir);
+  EXPECT_TRUE(measure);
+
+  openstudio::path result = testDir / toPath("SetWindowToWallRatioByFacade");
+  if (measure){
+    EXPECT_TRUE(measure->clone(result));
+  }
+  return result;
+}
+
+unsigned MeasureManagerFixture::numModelLoads() const
+{
+  Logger::instance().flush();
+
+  unsigned result = 0;
+  for (const LogMessage& message : measureManagerLog->logMessages()){
+    if (message.logMessage().find("Attempting to load model") == 0){
+      ++result;
+    }
+  }
+  return result;
+}
+
+std::shared_ptr<openstudio::FileLogSink> MeasureManagerFixture::logFile;
@@ -0,0 +1,107 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef CLI_TEST_MEASUREMANAGERFIXTURE_HPP
+#define CLI_TEST_MEASUREMANAGERFIXTURE_HPP
+
+#include <gtest/gtest.h>
+
+#include "../MeasureManager.hpp"
+
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/FileLogSink.hpp"
+#include "../../utilities/core/StringStreamLogSink.hpp"
+#include "../../utilities/core/Path.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+/// Runs work on the calling thread instead of an embedded Ruby interpreter. Measure information has a
+/// single model dependent argument whose default is the number of spaces in the model.
+class FakeInterpreterThread : public openstudio::cli::InterpreterThread {
+ public:
+
+  FakeInterpreterThread();
+
+  virtual void run(const std::function<void ()>& task) override;
+
+  virtual openstudio::measure::OSMeasureInfo getInfo(const openstudio::BCLMeasure& measure,
+                                                     const openstudio::model::OptionalModel& model,
+                                                     const openstudio::OptionalWorkspace& workspace) override;
+
+  virtual void renderReadme(const openstudio::measure::OSMeasureInfo& info,
+                            const openstudio::path& readmeInPath,
+                            const std::string& measureHashJSON) override;
+
+  /// number of calls to getInfo
+  unsigned numGetInfo() const;
+
+ private:
+
+  std::atomic<unsigned> m_numGetInfo;
+};
+
+class MeasureManagerFixture : public ::testing::Test {
+ protected:
+  /// initialize for each test
+  virtual void SetUp() override;
+
+  /// tear down after each test
+  virtual void TearDown() override;
+
+  /// initialize static members
+  static void SetUpTestCase();
+
+  /// tear down static members
+  static void TearDownTestCase();
+
+  /// saves a model with numSpaces spaces to the test directory, its modification time is an hour ago
+  /// so that the measure manager trusts it
+  openstudio::path saveModel(const std::string& name, unsigned numSpaces);
+
+  /// copies a measure from the test resources to the test directory
+  openstudio::path copyMeasure();
+
+  /// number of times the measure manager loaded a model from disk since the test started
+  unsigned numModelLoads() const;
+
+  FakeInterpreterThread interpreterThread;
+
+  // per test directory for models and measures
+  openstudio::path testDir;
+
+  std::shared_ptr<openstudio::StringStreamLogSink> measureManagerLog;
+
+  static std::shared_ptr<openstudio::FileLogSink> logFile;
+
+  REGISTER_LOGGER("MeasureManagerFixture");
+};
+
+#endif // CLI_TEST_MEASUREMANAGERFIXTURE_HPP
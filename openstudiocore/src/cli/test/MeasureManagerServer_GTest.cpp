@@ -0,0 +1,163 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "MeasureManagerFixture.hpp"
+
+#include "../MeasureManager.hpp"
+#include "../MeasureManagerServer.hpp"
+
+#include <jsoncpp/json.h>
+
+#include <boost/asio.hpp>
+
+#include <sstream>
+
+using namespace openstudio;
+using namespace openstudio::cli;
+
+namespace {
+
+  struct HttpResponse {
+    unsigned status;
+    std::string body;
+  };
+
+  unsigned short freePort()
+  {
+    boost::asio::io_service ioService;
+    boost::asio::ip::tcp::acceptor acceptor(ioService, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), 0));
+    return acceptor.local_endpoint().port();
+  }
+
+  HttpResponse request(unsigned short port, const std::string& method, const std::string& target, const std::string& body)
+  {
+    boost::asio::io_service ioService;
+    boost::asio::ip::tcp::socket socket(ioService);
+    socket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+
+    std::ostringstream ss;
+    ss << method << " " << target << " HTTP/1.1\r\n"
+       << "Host: localhost\r\n"
+       << "Content-Type: application/json\r\n"
+       << "Content-Length: " << body.size() << "\r\n"
+       << "Connection: close\r\n"
+       << "\r\n"
+       << body;
+    boost::asio::write(socket, boost::asio::buffer(ss.str()));
+
+    // the server closes the connection after each response
+    boost::asio::streambuf buffer;
+    boost::system::error_code ec;
+    boost::asio::read(socket, buffer, boost::asio::transfer_all(), ec);
+    EXPECT_TRUE(ec == boost::asio::error::eof) << ec.message();
+
+    std::string response(boost::asio::buffers_begin(buffer.data()), boost::asio::buffers_end(buffer.data()));
+
+    HttpResponse result{0, ""};
+    std::istringstream statusLine(response.substr(0, response.find("\r\n")));
+    std::string version;
+    statusLine >> version >> result.status;
+    EXPECT_EQ("HTTP/1.1", version);
+
+    std::string::size_type bodyStart = response.find("\r\n\r\n");
+    EXPECT_NE(std::string::npos, bodyStart);
+    if (bodyStart != std::string::npos){
+      result.body = response.substr(bodyStart + 4);
+    }
+    return result;
+  }
+
+  Json::Value parse(const std::string& body)
+  {
+    Json::Value result;
+    Json::Reader reader;
+    EXPECT_TRUE(reader.parse(body, result)) << body;
+    return result;
+  }
+
+} // anonymous namespace
+
+TEST_F(MeasureManagerFixture, MeasureManagerServer_RoundTrip)
+{
+  openstudio::path measureDir = copyMeasure();
+  openstudio::path osmPath = saveModel("A", 3);
+
+  MeasureManager measureManager(interpreterThread);
+  MeasureManagerServer server(measureManager, interpreterThread, freePort(), 2);
+  ASSERT_NO_THROW(server.start());
+
+  // GET / matches the ruby servlet's status hash
+  HttpResponse response = request(server.port(), "GET", "/", "");
+  EXPECT_EQ(200u, response.status);
+  Json::Value status = parse(response.body);
+  ASSERT_TRUE(status.isObject());
+  EXPECT_EQ(2u, status.size());
+  EXPECT_EQ("running", status["status"].asString());
+  EXPECT_TRUE(status["my_measures_dir"].isString());
+
+  // POST /compute_arguments returns the measure hash with arguments computed against the model
+  Json::Value data(Json::objectValue);
+  data["measure_dir"] = toString(measureDir);
+  data["osm_path"] = toString(osmPath);
+  response = request(server.port(), "POST", "/compute_arguments", Json::FastWriter().write(data));
+  EXPECT_EQ(200u, response.status);
+  Json::Value measure = parse(response.body);
+  ASSERT_TRUE(measure.isObject());
+  for (const std::string& key : {"measure_dir", "name", "directory", "uid", "uuid", "version_id", "version_uuid",
+                                 "version_modified", "xml_checksum", "display_name", "class_name", "description",
+                                 "modeler_description", "tags", "outputs", "attributes", "arguments"}){
+    EXPECT_TRUE(measure.isMember(key)) << key;
+  }
+  EXPECT_FALSE(measure.isMember("error"));
+  EXPECT_EQ(toString(measureDir), measure["measure_dir"].asString());
+  EXPECT_TRUE(measure["tags"].isArray());
+  EXPECT_TRUE(measure["outputs"].isArray());
+  EXPECT_TRUE(measure["attributes"].isArray());
+  ASSERT_TRUE(measure["arguments"].isArray());
+  ASSERT_EQ(1u, measure["arguments"].size());
+  EXPECT_EQ("num_spaces", measure["arguments"][0]["name"].asString());
+  EXPECT_EQ("Integer", measure["arguments"][0]["type"].asString());
+  EXPECT_TRUE(measure["arguments"][0]["model_dependent"].asBool());
+  EXPECT_EQ(3, measure["arguments"][0]["default_value"].asInt());
+
+  // errors are reported like the ruby servlet reports exceptions
+  response = request(server.port(), "POST", "/compute_arguments", "{}");
+  EXPECT_EQ(400u, response.status);
+  Json::Value error = parse(response.body);
+  ASSERT_TRUE(error.isObject());
+  EXPECT_TRUE(error["error"].isString());
+  EXPECT_TRUE(error.isMember("backtrace"));
+
+  response = request(server.port(), "GET", "/unknown", "");
+  EXPECT_EQ(400u, response.status);
+  EXPECT_EQ("Error, unknown path /unknown", response.body);
+
+  server.stop();
+}
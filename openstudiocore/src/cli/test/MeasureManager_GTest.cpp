@@ -0,0 +1,182 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "MeasureManagerFixture.hpp"
+
+#include "../MeasureManager.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Space.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <ctime>
+#include <thread>
+#include <vector>
+
+using namespace openstudio;
+using namespace openstudio::cli;
+
+namespace {
+
+  std::vector<std::string> osmPaths(const Json::Value& state)
+  {
+    std::vector<std::string> result;
+    for (const Json::Value& osm : state["osms"]){
+      result.push_back(osm["osm_path"].asString());
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+TEST_F(MeasureManagerFixture, MeasureManager_EvictsLeastRecentlyUsed)
+{
+  openstudio::path a = saveModel("A", 1);
+  openstudio::path b = saveModel("B", 1);
+  openstudio::path c = saveModel("C", 1);
+
+  MeasureManager measureManager(interpreterThread, 2);
+
+  ASSERT_TRUE(measureManager.getModel(a, false));
+  ASSERT_TRUE(measureManager.getModel(b, false));
+  EXPECT_EQ(2u, numModelLoads());
+
+  // A is now the most recently used model, loading C evicts B
+  ASSERT_TRUE(measureManager.getModel(a, false));
+  EXPECT_EQ(2u, numModelLoads());
+  ASSERT_TRUE(measureManager.getModel(c, false));
+  EXPECT_EQ(3u, numModelLoads());
+
+  std::vector<std::string> expected{toString(c), toString(a)};
+  EXPECT_EQ(expected, osmPaths(measureManager.internalState()));
+
+  ASSERT_TRUE(measureManager.getModel(a, false));
+  EXPECT_EQ(3u, numModelLoads());
+  ASSERT_TRUE(measureManager.getModel(b, false));
+  EXPECT_EQ(4u, numModelLoads());
+}
+
+TEST_F(MeasureManagerFixture, MeasureManager_ReloadsChangedModel)
+{
+  openstudio::path p = saveModel("A", 1);
+
+  MeasureManager measureManager(interpreterThread);
+
+  boost::optional<std::pair<model::Model, Workspace> > result = measureManager.getModel(p, false);
+  ASSERT_TRUE(result);
+  EXPECT_EQ(1u, result->first.getConcreteModelObjects<model::Space>().size());
+  ASSERT_TRUE(measureManager.getModel(p, false));
+  EXPECT_EQ(1u, numModelLoads());
+
+  // both the size and the modification time change
+  p = saveModel("A", 2);
+  openstudio::filesystem::last_write_time(p, std::time(nullptr) - 3600 + 60);
+
+  result = measureManager.getModel(p, false);
+  ASSERT_TRUE(result);
+  EXPECT_EQ(2u, result->first.getConcreteModelObjects<model::Space>().size());
+  EXPECT_EQ(2u, numModelLoads());
+
+  ASSERT_TRUE(measureManager.getModel(p, false));
+  EXPECT_EQ(2u, numModelLoads());
+}
+
+TEST_F(MeasureManagerFixture, MeasureManager_ConcurrentGetModelLoadsOnce)
+{
+  openstudio::path p = saveModel("A", 1);
+
+  MeasureManager measureManager(interpreterThread);
+
+  const unsigned numThreads = 8;
+  std::vector<int> succeeded(numThreads, 0);
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < numThreads; ++i){
+    threads.emplace_back([&measureManager, &p, &succeeded, i]() {
+      succeeded[i] = measureManager.getModel(p, false) ? 1 : 0;
+    });
+  }
+  for (std::thread& thread : threads){
+    thread.join();
+  }
+
+  for (unsigned i = 0; i < numThreads; ++i){
+    EXPECT_EQ(1, succeeded[i]) << "thread " << i;
+  }
+  EXPECT_EQ(1u, numModelLoads());
+}
+
+TEST_F(MeasureManagerFixture, MeasureManager_ForceReload)
+{
+  openstudio::path p = saveModel("A", 1);
+
+  MeasureManager measureManager(interpreterThread);
+
+  ASSERT_TRUE(measureManager.getModel(p, true));
+  EXPECT_EQ(1u, numModelLoads());
+  ASSERT_TRUE(measureManager.getModel(p, true));
+  EXPECT_EQ(2u, numModelLoads());
+  ASSERT_TRUE(measureManager.getModel(p, false));
+  EXPECT_EQ(2u, numModelLoads());
+
+  std::vector<std::string> expected{toString(p)};
+  EXPECT_EQ(expected, osmPaths(measureManager.internalState()));
+}
+
+TEST_F(MeasureManagerFixture, MeasureManager_InternalStateDropsEvictedModels)
+{
+  openstudio::path measureDir = copyMeasure();
+  openstudio::path a = saveModel("A", 1);
+  openstudio::path b = saveModel("B", 2);
+
+  MeasureManager measureManager(interpreterThread, 1);
+
+  Json::Value result = measureManager.computeArguments(measureDir, a, false);
+  ASSERT_EQ(1u, result["arguments"].size());
+  EXPECT_EQ(1, result["arguments"][0]["default_value"].asInt());
+
+  result = measureManager.computeArguments(measureDir, b, false);
+  ASSERT_EQ(1u, result["arguments"].size());
+  EXPECT_EQ(2, result["arguments"][0]["default_value"].asInt());
+
+  // measure information for the cached model is reused
+  unsigned numGetInfo = interpreterThread.numGetInfo();
+  measureManager.computeArguments(measureDir, b, false);
+  EXPECT_EQ(numGetInfo, interpreterThread.numGetInfo());
+
+  Json::Value state = measureManager.internalState();
+
+  std::vector<std::string> expected{toString(b)};
+  EXPECT_EQ(expected, osmPaths(state));
+
+  EXPECT_EQ(1u, state["measures"].size());
+  ASSERT_EQ(1u, state["measure_info"].size());
+  EXPECT_EQ(toString(measureDir), state["measure_info"][0]["measure_dir"].asString());
+  EXPECT_EQ(toString(b), state["measure_info"][0]["osm_path"].asString());
+}
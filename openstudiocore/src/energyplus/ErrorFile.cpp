@@ -29,39 +29,191 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
-#include <boost/algorithm/string.hpp>
+#include <QFile>
+#include <QByteArray>
+
+#include <cstring>
 
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    inline bool isSpace(char c)
+    {
+      return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n') || (c == '\f') || (c == '\v');
+    }
+
+    inline const char* skipSpace(const char* p, const char* end)
+    {
+      while ((p != end) && isSpace(*p)){
+        ++p;
+      }
+      return p;
+    }
+
+    inline const char* skipStars(const char* p, const char* end)
+    {
+      while ((p != end) && (*p == '*')){
+        ++p;
+      }
+      return p;
+    }
+
+    inline bool startsWith(const char* p, const char* end, const char* prefix, size_t n)
+    {
+      return (static_cast<size_t>(end - p) >= n) && (std::memcmp(p, prefix, n) == 0);
+    }
+
+    /** Parses the part of a message line after the leading '**', i.e. 'Warning ** text'.
+     *  On success sets type to the level token and text to the remainder of the line. */
+    bool parseMessageBody(const char* p, const char* end,
+                          const char*& typeBegin, const char*& typeEnd, const char*& text)
+    {
+      p = skipSpace(p, end);
+      typeBegin = p;
+      while ((p != end) && !isSpace(*p) && (*p != '*')){
+        ++p;
+      }
+      typeEnd = p;
+      if (typeBegin == typeEnd){
+        return false;
+      }
+      p = skipSpace(p, end);
+      if (!startsWith(p, end, "**", 2)){
+        return false;
+      }
+      text = p + 2;
+      return true;
+    }
+
+    /** Classifies lines of the form '   ** Warning ** text' and '   **   ~~~   ** text', equivalent to the
+     *  regex ^\s*\**\s+\*\*\s*([^\s\*]+)\s*\*\*(.*)$ */
+    bool parseMessageLine(const char* begin, const char* end,
+                          const char*& typeBegin, const char*& typeEnd, const char*& text)
+    {
+      const char* p = skipSpace(begin, end);
+      bool leadingSpace = (p != begin);
+
+      // leading run of stars, e.g. '   ************* ** Warning **'
+      const char* q = skipStars(p, end);
+      if (q != p){
+        const char* r = skipSpace(q, end);
+        if ((r != q) && startsWith(r, end, "**", 2) && parseMessageBody(r + 2, end, typeBegin, typeEnd, text)){
+          return true;
+        }
+      }
+
+      return leadingSpace && startsWith(p, end, "**", 2) && parseMessageBody(p + 2, end, typeBegin, typeEnd, text);
+    }
+
+    /// Matches lines of the form '   ************* EnergyPlus Completed Successfully...'
+    bool isStarredLine(const char* begin, const char* end, const char*& text)
+    {
+      const char* p = skipSpace(begin, end);
+      const char* q = skipStars(p, end);
+      if ((q == p) || (q == end) || (*q != ' ')){
+        return false;
+      }
+      text = q + 1;
+      return true;
+    }
+
+    bool isGroundTempCompletedSuccessfully(const char* p, const char* end)
+    {
+      static const char groundTemp[] = "GroundTempCalc";
+      static const char completed[] = " Completed Successfully";
+      if (!startsWith(p, end, groundTemp, sizeof(groundTemp) - 1)){
+        return false;
+      }
+      p += sizeof(groundTemp) - 1;
+      while ((p != end) && !isSpace(*p)){
+        ++p;
+      }
+      return startsWith(p, end, completed, sizeof(completed) - 1);
+    }
+
+    std::string trimmed(const char* begin, const char* end)
+    {
+      begin = skipSpace(begin, end);
+      while ((end != begin) && isSpace(*(end - 1))){
+        --end;
+      }
+      return std::string(begin, end);
+    }
+
+    std::string trimmedRight(const char* begin, const char* end)
+    {
+      while ((end != begin) && isSpace(*(end - 1))){
+        --end;
+      }
+      return std::string(begin, end);
+    }
+
+  }
+
   /// constructor
-  ErrorFile::ErrorFile(const openstudio::path& errPath)
-    : m_completed(false), m_completedSuccessfully(false)
+  ErrorFile::ErrorFile(const openstudio::path& errPath, bool keepRepeatedMessages)
+    : m_keepRepeatedMessages(keepRepeatedMessages), m_completed(false), m_completedSuccessfully(false)
   {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
-    ifs.close();
+    QFile file(toQString(errPath));
+    if (!file.open(QIODevice::ReadOnly)){
+      return;
+    }
+
+    qint64 size = file.size();
+    if (size <= 0){
+      return;
+    }
+
+    // err files from annual runs can be tens of MB, map rather than copy when possible
+    if (uchar* data = file.map(0, size)){
+      const char* begin = reinterpret_cast<const char*>(data);
+      parse(begin, begin + size);
+      file.unmap(data);
+    }else{
+      QByteArray bytes = file.readAll();
+      parse(bytes.constData(), bytes.constData() + bytes.size());
+    }
   }
 
   /// get warnings
   std::vector<std::string> ErrorFile::warnings() const
   {
-    return m_warnings;
+    return m_warnings.messages;
   }
 
   /// get severe errors
   std::vector<std::string> ErrorFile::severeErrors() const
   {
-    return m_severeErrors;
+    return m_severeErrors.messages;
   }
 
   /// get fatal errors
   std::vector<std::string> ErrorFile::fatalErrors() const
   {
-    return m_fatalErrors;
+    return m_fatalErrors.messages;
   }
 
+  std::vector<std::string> ErrorFile::messageKeys(const ErrorLevel& level) const
+  {
+    return messages(level).keys;
+  }
+
+  unsigned ErrorFile::messageCount(const ErrorLevel& level, const std::string& key) const
+  {
+    const Messages& m = messages(level);
+    auto it = m.counts.find(key);
+    if (it == m.counts.end()){
+      return 0;
+    }
+    return it->second;
+  }
+
+  unsigned ErrorFile::numMessages(const ErrorLevel& level) const
+  {
+    return messages(level).numMessages;
+  }
 
   /// did EnergyPlus complete or crash
   bool ErrorFile::completed() const
@@ -75,94 +227,123 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is)
+  ErrorFile::Messages& ErrorFile::messages(const ErrorLevel& level)
   {
-    std::string line;
-
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([^\\s\\*]+)\\s*\\*\\*(.*)$");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
-
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
-
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
-
-    // repeat count
-
-
-    // read the file line by line using regexes
-    while(std::getline(is, line)){
+    switch(level.value()){
+      case ErrorLevel::Warning:
+        return m_warnings;
+      case ErrorLevel::Severe:
+        return m_severeErrors;
+      default:
+        return m_fatalErrors;
+    }
+  }
 
-      boost::smatch matches;
+  const ErrorFile::Messages& ErrorFile::messages(const ErrorLevel& level) const
+  {
+    return const_cast<ErrorFile*>(this)->messages(level);
+  }
 
-//      LOG(Debug, "Parsing ErrorFile Line: " << line);
+  void ErrorFile::addMessage(const std::string& type, std::string&& message, std::string&& key)
+  {
+    LOG(Trace, "Error parsed: " << message);
+
+    // correctly sort warnings and errors, avoid enum lookup for the usual spellings
+    Messages* m = nullptr;
+    if (type == "Warning"){
+      m = &m_warnings;
+    }else if (type == "Severe"){
+      m = &m_severeErrors;
+    }else if (type == "Fatal"){
+      m = &m_fatalErrors;
+    }else{
+      try{
+        m = &messages(ErrorLevel(type));
+      }catch(...){
+        LOG(Error, "Unknown warning or error level '" << type << "'");
+        return;
+      }
+    }
 
+    ++m->numMessages;
+    auto inserted = m->counts.insert(std::make_pair(key, 0u));
+    ++inserted.first->second;
+    bool firstOccurrence = (inserted.first->second == 1u);
+    if (firstOccurrence){
+      m->keys.push_back(std::move(key));
+    }
+    if (m_keepRepeatedMessages || firstOccurrence){
+      m->messages.push_back(std::move(message));
+    }
+  }
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)){
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second); boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second); boost::trim(warningOrErrorString);
+  void ErrorFile::parse(const char* begin, const char* end)
+  {
+    static const char completedSuccessfully[] = "EnergyPlus Completed Successfully";
+    static const char terminated[] = "EnergyPlus Terminated";
+
+    // message being accumulated from its header and continuation lines
+    bool inMessage = false;
+    std::string type;
+    std::string message;
+    std::string key;
+
+    const char* lineBegin = begin;
+    while (lineBegin != end){
+      const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', end - lineBegin));
+      const char* next = lineEnd ? lineEnd + 1 : end;
+      if (!lineEnd){
+        lineEnd = end;
+      }
+      if ((lineEnd != lineBegin) && (*(lineEnd - 1) == '\r')){
+        --lineEnd;
+      }
 
-        // read the rest of the multi line warning or error
-        while(true){
-          std::streampos pos = is.tellg();
-          if (!std::getline(is, line)){
-            break;
-          }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)){
-            std::string temp = std::string(matches[1].first, matches[1].second); boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          }else{
-            // unget the line
-            is.seekg(pos);
-            break;
+      const char* typeBegin;
+      const char* typeEnd;
+      const char* text;
+      if (parseMessageLine(lineBegin, lineEnd, typeBegin, typeEnd, text)){
+        bool isContinuation = ((typeEnd - typeBegin) == 3) && (std::memcmp(typeBegin, "~~~", 3) == 0);
+        if (isContinuation && inMessage){
+          message += "\n";
+          message += trimmedRight(text, lineEnd);
+        }else{
+          if (inMessage){
+            addMessage(type, std::move(message), std::move(key));
           }
+          type.assign(typeBegin, typeEnd);
+          message = trimmed(text, lineEnd);
+          key = message;
+          inMessage = true;
         }
+        lineBegin = next;
+        continue;
+      }
 
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
-
-
-        // correctly sort warnings and errors
-        try{
-          ErrorLevel level(warningOrErrorType);
-
-          switch(level.value()){
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
+      if (inMessage){
+        addMessage(type, std::move(message), std::move(key));
+        inMessage = false;
+      }
 
-        }catch(...){
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
+      if (isStarredLine(lineBegin, lineEnd, text)){
+        if (startsWith(text, lineEnd, completedSuccessfully, sizeof(completedSuccessfully) - 1)
+            || isGroundTempCompletedSuccessfully(text, lineEnd)){
+          m_completed = true;
+          m_completedSuccessfully = true;
+          return;
+        }else if (startsWith(text, lineEnd, terminated, sizeof(terminated) - 1)){
+          m_completed = true;
+          m_completedSuccessfully = false;
+          return;
         }
-
-      }else if (boost::regex_match(line, completedSuccessful)
-                || boost::regex_match(line, groundTempCompletedSuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = true;
-        break;
-      }else if (boost::regex_match(line, completedUnsuccessful)){
-        m_completed = true;
-        m_completedSuccessfully = false;
-        break;
       }
+
+      lineBegin = next;
     }
 
+    if (inMessage){
+      addMessage(type, std::move(message), std::move(key));
+    }
   }
 
 } // energyplus
@@ -38,6 +38,7 @@
 
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio {
@@ -53,8 +54,10 @@ namespace energyplus {
   class ENERGYPLUS_API ErrorFile {
    public:
 
-    /// constructor
-    ErrorFile(const openstudio::path& errPath);
+    /** Constructor, parses the file at errPath.  If keepRepeatedMessages is false only the first message
+     *  for each distinct first line is stored, later messages with the same first line are only counted.
+     *  This bounds memory for err files with millions of repeated warnings. */
+    ErrorFile(const openstudio::path& errPath, bool keepRepeatedMessages = true);
 
     /// get warnings
     std::vector<std::string> warnings() const;
@@ -65,6 +68,15 @@ namespace energyplus {
     /// get fatal errors
     std::vector<std::string> fatalErrors() const;
 
+    /// get the distinct first lines of messages at level, in order of first occurrence
+    std::vector<std::string> messageKeys(const ErrorLevel& level) const;
+
+    /// get the number of messages at level whose first line is key
+    unsigned messageCount(const ErrorLevel& level, const std::string& key) const;
+
+    /// get the total number of messages at level, including those not stored
+    unsigned numMessages(const ErrorLevel& level) const;
+
     /// did EnergyPlus complete or crash
     bool completed() const;
 
@@ -75,11 +87,26 @@ namespace energyplus {
 
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
+    struct Messages {
+      Messages() : numMessages(0) {}
+      std::vector<std::string> messages;
+      std::vector<std::string> keys;
+      std::unordered_map<std::string, unsigned> counts;
+      unsigned numMessages;
+    };
+
+    void parse(const char* begin, const char* end);
+
+    void addMessage(const std::string& type, std::string&& message, std::string&& key);
+
+    Messages& messages(const ErrorLevel& level);
+
+    const Messages& messages(const ErrorLevel& level) const;
 
-    std::vector<std::string> m_warnings;
-    std::vector<std::string> m_severeErrors;
-    std::vector<std::string> m_fatalErrors;
+    Messages m_warnings;
+    Messages m_severeErrors;
+    Messages m_fatalErrors;
+    bool m_keepRepeatedMessages;
     bool m_completed;
     bool m_completedSuccessfully;
 
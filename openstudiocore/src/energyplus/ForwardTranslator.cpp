@@ -83,6 +83,7 @@
 #include <utilities/idd/SetpointManager_MixedAir_FieldEnums.hxx>
 
 #include "../utilities/idd/IddEnums.hpp"
+#include "../utilities/core/Trace.hpp"
 
 #include <QFile>
 #include <QThread>
@@ -177,6 +178,8 @@ void ForwardTranslator::setExcludeLCCObjects(bool excludeLCCObjects)
 
 Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
 {
+  OS_TRACE_SCOPE("energyplus", "ForwardTranslator::translateModelPrivate");
+
   reset();
 
   // translate Version first
@@ -189,8 +192,11 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
 
   // resolve surface marching conflicts before combining thermal zones or removing spaces
   // as those operations may change search distances
-  resolveMatchedSurfaceConstructionConflicts(model);
-  resolveMatchedSubSurfaceConstructionConflicts(model);
+  {
+    OS_TRACE_SCOPE("energyplus", "resolveMatchedConstructionConflicts");
+    resolveMatchedSurfaceConstructionConflicts(model);
+    resolveMatchedSubSurfaceConstructionConflicts(model);
+  }
 
   // check for spaces not in a thermal zone
   for (Space space : model.getConcreteModelObjects<Space>()){
@@ -517,8 +523,14 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     }
   }
 
-  translateConstructions(model);
-  translateSchedules(model);
+  {
+    OS_TRACE_SCOPE("energyplus", "translateConstructions");
+    translateConstructions(model);
+  }
+  {
+    OS_TRACE_SCOPE("energyplus", "translateSchedules");
+    translateSchedules(model);
+  }
 
   // Translate the Outdoor Air Node
   {
@@ -530,39 +542,54 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
   }
 
   // get air loops in sorted order
-  std::vector<AirLoopHVAC> airLoops = model.getConcreteModelObjects<AirLoopHVAC>();
-  std::sort(airLoops.begin(), airLoops.end(), WorkspaceObjectNameLess());
-  for (AirLoopHVAC airLoop : airLoops){
-    translateAndMapModelObject(airLoop);
+  {
+    OS_TRACE_SCOPE("energyplus", "translateAirLoops");
+    std::vector<AirLoopHVAC> airLoops = model.getConcreteModelObjects<AirLoopHVAC>();
+    std::sort(airLoops.begin(), airLoops.end(), WorkspaceObjectNameLess());
+    for (AirLoopHVAC airLoop : airLoops){
+      translateAndMapModelObject(airLoop);
+    }
   }
 
   // get AirConditionerVariableRefrigerantFlow objects in sorted order
-  std::vector<AirConditionerVariableRefrigerantFlow> vrfs = model.getConcreteModelObjects<AirConditionerVariableRefrigerantFlow>();
-  std::sort(vrfs.begin(), vrfs.end(), WorkspaceObjectNameLess());
-  for (AirConditionerVariableRefrigerantFlow vrf : vrfs){
-    translateAndMapModelObject(vrf);
+  {
+    OS_TRACE_SCOPE("energyplus", "translateVRFs");
+    std::vector<AirConditionerVariableRefrigerantFlow> vrfs = model.getConcreteModelObjects<AirConditionerVariableRefrigerantFlow>();
+    std::sort(vrfs.begin(), vrfs.end(), WorkspaceObjectNameLess());
+    for (AirConditionerVariableRefrigerantFlow vrf : vrfs){
+      translateAndMapModelObject(vrf);
+    }
   }
 
   // get plant loops in sorted order
-  std::vector<PlantLoop> plantLoops = model.getConcreteModelObjects<PlantLoop>();
-  std::sort(plantLoops.begin(), plantLoops.end(), WorkspaceObjectNameLess());
-  for (PlantLoop plantLoop : plantLoops){
-    translateAndMapModelObject(plantLoop);
+  {
+    OS_TRACE_SCOPE("energyplus", "translatePlantLoops");
+    std::vector<PlantLoop> plantLoops = model.getConcreteModelObjects<PlantLoop>();
+    std::sort(plantLoops.begin(), plantLoops.end(), WorkspaceObjectNameLess());
+    for (PlantLoop plantLoop : plantLoops){
+      translateAndMapModelObject(plantLoop);
+    }
   }
 
   // translate AFN
-  translateAirflowNetwork(model);
+  {
+    OS_TRACE_SCOPE("energyplus", "translateAirflowNetwork");
+    translateAirflowNetwork(model);
+  }
 
   // now loop over all objects
-  for (const IddObjectType& iddObjectType : iddObjectsToTranslate()){
+  {
+    OS_TRACE_SCOPE("energyplus", "translateRemainingObjects");
+    for (const IddObjectType& iddObjectType : iddObjectsToTranslate()){
 
-    // get objects by type in sorted order
-    std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
-    std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
+      // get objects by type in sorted order
+      std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
+      std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
 
-    for (const WorkspaceObject& workspaceObject : objects){
-      model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
-      translateAndMapModelObject(modelObject);
+      for (const WorkspaceObject& workspaceObject : objects){
+        model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
+        translateAndMapModelObject(modelObject);
+      }
     }
   }
 
@@ -571,6 +598,7 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     this->createStandardOutputRequests();
   }
 
+  OS_TRACE_SCOPE("energyplus", "createWorkspace");
   Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
   OptionalWorkspaceObject vo = workspace.versionObject();
   OS_ASSERT(vo);
@@ -631,6 +659,9 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
 
   LOG(Trace,"Translating " << modelObject.briefDescription() << ".");
 
+  // scopes nest when translating one object translates its children
+  OS_TRACE_SCOPE_DYNAMIC("energyplus", modelObject.iddObject().type().valueName());
+
   switch(modelObject.iddObject().type().value())
   {
   case openstudio::IddObjectType::OS_AdditionalProperties :
@@ -53,10 +53,29 @@ namespace openstudio {
 
 namespace energyplus {
 
+// log channel filters are compiled once rather than on every translation
+static const boost::regex& idfFileChannelRegex()
+{
+  static const boost::regex result("openstudio\\.IdfFile");
+  return result;
+}
+
+static const boost::regex& reverseTranslatorChannelRegex()
+{
+  static const boost::regex result("openstudio\\.energyplus\\.ReverseTranslator");
+  return result;
+}
+
+static const boost::regex& geometryTranslatorChannelRegex()
+{
+  static const boost::regex result("openstudio\\.energyplus\\.GeometryTranslator");
+  return result;
+}
+
 ReverseTranslator::ReverseTranslator()
 {
   m_logSink.setLogLevel(Warn);
-  m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
+  m_logSink.setChannelRegex(reverseTranslatorChannelRegex());
   m_logSink.setThreadId(QThread::currentThread());
 }
 
@@ -71,19 +90,20 @@ boost::optional<model::Model> ReverseTranslator::loadModel(const openstudio::pat
   m_workspaceToModelMap.clear();
 
   m_untranslatedIdfObjects.clear();
+  m_untranslatedHandles.clear();
 
   m_logSink.resetStringStream();
 
   m_logSink.setThreadId(QThread::currentThread());
 
-  m_logSink.setChannelRegex(boost::regex("openstudio\\.IdfFile"));
+  m_logSink.setChannelRegex(idfFileChannelRegex());
 
   // load idf
   boost::optional<openstudio::IdfFile> idfFile = IdfFile::load(path, IddFileType::EnergyPlus, progressBar);
 
   // change channel after loading file
   // DLM: is this right?  we miss messages from loading idf
-  m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
+  m_logSink.setChannelRegex(reverseTranslatorChannelRegex());
 
   // energyplus idfs may not be draft level strictness, eventually need a fixer
   if (!idfFile){
@@ -133,7 +153,8 @@ boost::optional<model::Model> ReverseTranslator::loadModel(const openstudio::pat
       workspace.disconnectProgressBar(*progressBar);
     }
 
-    return this->translateWorkspace(workspace, progressBar, false);
+    // workspace is not used after translation, no need to clone it
+    return this->translateWorkspaceInPlace(workspace, progressBar, false);
 
   }
 
@@ -141,12 +162,19 @@ boost::optional<model::Model> ReverseTranslator::loadModel(const openstudio::pat
 }
 
 Model ReverseTranslator::translateWorkspace(const Workspace & workspace, ProgressBar* progressBar, bool clearLogSink )
+{
+  // geometry conversion and RunPeriod removal modify the workspace
+  Workspace clone = workspace.clone();
+  return translateWorkspaceInPlace(clone, progressBar, clearLogSink);
+}
+
+Model ReverseTranslator::translateWorkspaceInPlace(Workspace & workspace, ProgressBar* progressBar, bool clearLogSink )
 {
   if (clearLogSink){
     m_logSink.resetStringStream();
   }
 
-  m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
+  m_logSink.setChannelRegex(reverseTranslatorChannelRegex());
 
   // check input
   if (workspace.iddFileType() != IddFileType::EnergyPlus){
@@ -157,11 +185,12 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
   m_model = Model();
   m_model.setFastNaming(true);
 
-  m_workspace = workspace.clone();
+  m_workspace = workspace;
 
   m_workspaceToModelMap.clear();
 
   m_untranslatedIdfObjects.clear();
+  m_untranslatedHandles.clear();
 
   // if multiple runperiod objects in idf, remove them all
   vector<WorkspaceObject> runPeriods = m_workspace.getObjectsByType(IddObjectType::RunPeriod);
@@ -174,7 +203,7 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
   }
 
   // first thing to do is convert geometry system
-  m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.GeometryTranslator"));
+  m_logSink.setChannelRegex(geometryTranslatorChannelRegex());
 
   m_progressBar = progressBar;
   if (m_progressBar){
@@ -186,7 +215,7 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
   GeometryTranslator geometryTranslator(m_workspace);
   geometryTranslator.convert(CoordinateSystem::Relative, CoordinateSystem::Relative);
 
-  m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
+  m_logSink.setChannelRegex(reverseTranslatorChannelRegex());
 
   // look for site object in workspace and translate if found
   LOG(Trace,"Translating Site:Location object.");
@@ -215,10 +244,16 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
 
   // Now loop over all objects to make sure nothing as missed.
   // In the future this might be removed.
+  // Objects already visited, either directly or as a dependency of another object, are skipped.
   LOG(Trace,"Translating remaining objects.");
   vector<WorkspaceObject> all = m_workspace.objects();
   for(auto & elem : all)
   {
+    Handle handle = elem.handle();
+    if ((m_workspaceToModelMap.find(handle) != m_workspaceToModelMap.end()) ||
+        (m_untranslatedHandles.find(handle) != m_untranslatedHandles.end())){
+      continue;
+    }
     translateAndMapWorkspaceObject( elem );
   }
 
@@ -258,19 +293,6 @@ std::vector<IdfObject> ReverseTranslator::untranslatedIdfObjects() const
   return m_untranslatedIdfObjects;
 }
 
-struct IdfObjectEqual {
-  explicit IdfObjectEqual(const IdfObject& target)
-    : m_target(target)
-  {}
-
-  bool operator()(const IdfObject& other) const
-  {
-    return (m_target == other);
-  }
-
-  IdfObject m_target;
-};
-
 boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(const WorkspaceObject & workspaceObject)
 {
   auto i = m_workspaceToModelMap.find(workspaceObject.handle());
@@ -1057,7 +1079,8 @@ boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(c
     m_workspaceToModelMap.insert(make_pair(workspaceObject.handle(), modelObject.get()));
   }else{
     if (addToUntranslated){
-      if (std::find_if(m_untranslatedIdfObjects.begin(), m_untranslatedIdfObjects.end(), IdfObjectEqual(workspaceObject.idfObject())) == m_untranslatedIdfObjects.end()){
+      // IdfObject equality is identity of the shared impl, so the handle identifies the object
+      if (m_untranslatedHandles.insert(workspaceObject.handle()).second){
         LOG(Trace,"Ignoring " << workspaceObject.briefDescription() << ".");
         m_untranslatedIdfObjects.push_back(workspaceObject.idfObject());
       }
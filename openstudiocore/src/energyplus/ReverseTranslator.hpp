@@ -35,6 +35,8 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <set>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -48,8 +50,15 @@ class ENERGYPLUS_API ReverseTranslator {
 
   boost::optional<model::Model> loadModel(const openstudio::path& path, ProgressBar* progressBar=nullptr);
 
+  /** Translates workspace to a Model. Geometry conversion and RunPeriod cleanup are done on a clone of
+   *  workspace, which is left unchanged. */
   model::Model translateWorkspace(const Workspace & workspace, ProgressBar* progressBar=nullptr, bool clearLogSink = true );
 
+  /** Translates workspace to a Model without cloning it first. Geometry conversion and RunPeriod cleanup
+   *  modify workspace itself. Use when the caller does not need workspace afterwards to avoid holding two
+   *  copies of a large idf in memory. */
+  model::Model translateWorkspaceInPlace(Workspace & workspace, ProgressBar* progressBar=nullptr, bool clearLogSink = true );
+
   /** Get warning messages generated by the last translation. */
   std::vector<LogMessage> warnings() const;
 
@@ -339,6 +348,9 @@ class ENERGYPLUS_API ReverseTranslator {
 
   std::vector<IdfObject> m_untranslatedIdfObjects;
 
+  // handles of m_untranslatedIdfObjects
+  std::set<openstudio::Handle> m_untranslatedHandles;
+
   StringStreamLogSink m_logSink;
 
   ProgressBar* m_progressBar;
@@ -39,6 +39,7 @@
 #include <sstream>
 
 using openstudio::energyplus::ErrorFile;
+using openstudio::energyplus::ErrorLevel;
 
 TEST_F(EnergyPlusFixture,ErrorFile_NoErrorsNoWarnings)
 {
@@ -115,3 +116,37 @@ TEST_F(EnergyPlusFixture,ErrorFile_WarningsAndCrash)
 }
 
 
+
+TEST_F(EnergyPlusFixture,ErrorFile_AggregateRepeatedMessages)
+{
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/WarningsAndSevere.err");
+
+  ErrorFile allMessages(path);
+  ErrorFile aggregated(path, false);
+
+  EXPECT_EQ(allMessages.completed(), aggregated.completed());
+  EXPECT_EQ(allMessages.completedSuccessfully(), aggregated.completedSuccessfully());
+
+  EXPECT_EQ(46u, allMessages.numMessages(ErrorLevel::Warning));
+  EXPECT_EQ(46u, aggregated.numMessages(ErrorLevel::Warning));
+  EXPECT_EQ(8u, aggregated.numMessages(ErrorLevel::Severe));
+  EXPECT_EQ(1u, aggregated.numMessages(ErrorLevel::Fatal));
+
+  // messages are keyed by their first line
+  std::vector<std::string> keys = aggregated.messageKeys(ErrorLevel::Warning);
+  EXPECT_EQ(keys, allMessages.messageKeys(ErrorLevel::Warning));
+  ASSERT_EQ(keys.size(), aggregated.warnings().size());
+  ASSERT_LT(keys.size(), allMessages.warnings().size());
+  EXPECT_EQ("Output:PreprocessorMessage=\"EPXMLPreProc2\" has the following Warning conditions:", keys[0]);
+  EXPECT_EQ(allMessages.warnings()[0], aggregated.warnings()[0]);
+
+  unsigned total = 0;
+  for (const std::string& key : keys){
+    unsigned count = aggregated.messageCount(ErrorLevel::Warning, key);
+    EXPECT_LT(0u, count);
+    total += count;
+  }
+  EXPECT_EQ(46u, total);
+  EXPECT_LT(1u, aggregated.messageCount(ErrorLevel::Warning, keys[0]));
+  EXPECT_EQ(0u, aggregated.messageCount(ErrorLevel::Warning, "Not a warning"));
+}
@@ -172,6 +172,34 @@ TEST_F(EnergyPlusFixture,ReverseTranslator_SimpleRelativeTest)
   workspace.save( resourcesPath() / toPath("energyplus/SimpleSurfaces/SimpleSurfaces_Relative2.idf"), true);
 }
 
+TEST_F(EnergyPlusFixture,ReverseTranslator_NoCloneWorkspace)
+{
+  openstudio::path idfPath = resourcesPath() / toPath("energyplus/SimpleSurfaces/SimpleSurfaces_Relative.idf");
+  OptionalIdfFile idfFile = IdfFile::load(idfPath, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+
+  Workspace clonedWorkspace(*idfFile);
+  ReverseTranslator reverseTranslator;
+  Model clonedModel = reverseTranslator.translateWorkspace(clonedWorkspace);
+  unsigned numUntranslated = reverseTranslator.untranslatedIdfObjects().size();
+
+  Workspace inPlaceWorkspace(*idfFile);
+  Model inPlaceModel = reverseTranslator.translateWorkspaceInPlace(inPlaceWorkspace);
+  EXPECT_EQ(numUntranslated, reverseTranslator.untranslatedIdfObjects().size());
+
+  EXPECT_EQ(clonedModel.numObjects(), inPlaceModel.numObjects());
+  EXPECT_EQ(clonedModel.getConcreteModelObjects<model::Surface>().size(), inPlaceModel.getConcreteModelObjects<model::Surface>().size());
+  EXPECT_EQ(clonedModel.getConcreteModelObjects<model::SubSurface>().size(), inPlaceModel.getConcreteModelObjects<model::SubSurface>().size());
+  ASSERT_TRUE(clonedModel.getOptionalUniqueModelObject<model::Building>());
+  ASSERT_TRUE(inPlaceModel.getOptionalUniqueModelObject<model::Building>());
+  EXPECT_DOUBLE_EQ(clonedModel.getOptionalUniqueModelObject<model::Building>()->floorArea(),
+                   inPlaceModel.getOptionalUniqueModelObject<model::Building>()->floorArea());
+
+  // translating in place adds detailed geometry for simple surfaces to the input workspace
+  EXPECT_LT(clonedWorkspace.getObjectsByType(IddObjectType::BuildingSurface_Detailed).size(),
+            inPlaceWorkspace.getObjectsByType(IddObjectType::BuildingSurface_Detailed).size());
+}
+
 TEST_F(EnergyPlusFixture,ReverseTranslator_Building)
 {
   Workspace inWorkspace(StrictnessLevel::None, IddFileType::EnergyPlus);
@@ -81,9 +81,9 @@
 
 #include <boost/math/constants/constants.hpp>
 
-#include <QDomDocument>
-#include <QDomElement>
+#include <QFile>
 #include <QThread>
+#include <QXmlStreamWriter>
 
 #include <regex>
 
@@ -109,19 +109,31 @@ namespace gbxml {
 
     m_logSink.resetStringStream();
 
-    boost::optional<QDomDocument> doc = this->translateModel(model);
-    if (!doc){
+    m_translatedObjects.clear();
+    m_materials.clear();
+
+    QFile file(toQString(path));
+    if (!file.open(QFile::WriteOnly)){
+      LOG(Error, "Could not open file '" << toString(path) << "' for writing");
       return false;
     }
 
-    openstudio::filesystem::ofstream file(path, std::ios_base::binary);
-    if (file.is_open()){
-      openstudio::filesystem::write(file, doc->toString(2));
-      file.close();
-      return true;
+    // elements are written as the model is walked rather than assembled into a QDomDocument first,
+    // formatting matches QDomDocument::toString(2)
+    QXmlStreamWriter xmlWriter(&file);
+    xmlWriter.setAutoFormatting(true);
+    xmlWriter.setAutoFormattingIndent(2);
+
+    bool result = this->translateModel(model, xmlWriter);
+
+    file.close();
+
+    if (xmlWriter.hasError()){
+      LOG(Error, "Failed to write file '" << toString(path) << "'");
+      return false;
     }
 
-    return false;
+    return result;
   }
 
   std::vector<LogMessage> ForwardTranslator::warnings() const
@@ -174,32 +186,25 @@ namespace gbxml {
     return result;
   }
 
-  boost::optional<QDomDocument> ForwardTranslator::translateModel(const openstudio::model::Model& model)
+  bool ForwardTranslator::translateModel(const openstudio::model::Model& model, QXmlStreamWriter& xmlWriter)
   {
-    QDomDocument doc;
-    doc.createProcessingInstruction("xml", "version=\"1.0\" encoding=\"utf-8\"");
-
-    QDomElement gbXMLElement = doc.createElement("gbXML");
-    doc.appendChild(gbXMLElement);
-    gbXMLElement.setAttribute("xmlns", "http://www.gbxml.org/schema");
-    gbXMLElement.setAttribute("xmlns:xhtml", "http://www.w3.org/1999/xhtml");
-    gbXMLElement.setAttribute("xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance");
-    gbXMLElement.setAttribute("xmlns:xsd", "http://www.w3.org/2001/XMLSchema");
-    gbXMLElement.setAttribute("xsi:schemaLocation", "http://www.gbxml.org/schema http://gbxml.org/schema/6-01/GreenBuildingXML_Ver6.01.xsd");
-    gbXMLElement.setAttribute("temperatureUnit", "C");
-    gbXMLElement.setAttribute("lengthUnit", "Meters");
-    gbXMLElement.setAttribute("areaUnit", "SquareMeters");
-    gbXMLElement.setAttribute("volumeUnit", "CubicMeters");
-    gbXMLElement.setAttribute("useSIUnitsForResults", "true");
-    gbXMLElement.setAttribute("version", "6.01");
-    gbXMLElement.setAttribute("SurfaceReferenceLocation", "Centerline");
+    xmlWriter.writeStartElement("gbXML");
+    xmlWriter.writeAttribute("xmlns", "http://www.gbxml.org/schema");
+    xmlWriter.writeAttribute("xmlns:xhtml", "http://www.w3.org/1999/xhtml");
+    xmlWriter.writeAttribute("xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance");
+    xmlWriter.writeAttribute("xmlns:xsd", "http://www.w3.org/2001/XMLSchema");
+    xmlWriter.writeAttribute("xsi:schemaLocation", "http://www.gbxml.org/schema http://gbxml.org/schema/6-01/GreenBuildingXML_Ver6.01.xsd");
+    xmlWriter.writeAttribute("temperatureUnit", "C");
+    xmlWriter.writeAttribute("lengthUnit", "Meters");
+    xmlWriter.writeAttribute("areaUnit", "SquareMeters");
+    xmlWriter.writeAttribute("volumeUnit", "CubicMeters");
+    xmlWriter.writeAttribute("useSIUnitsForResults", "true");
+    xmlWriter.writeAttribute("version", "6.01");
+    xmlWriter.writeAttribute("SurfaceReferenceLocation", "Centerline");
 
     boost::optional<model::Facility> facility = model.getOptionalUniqueModelObject<model::Facility>();
     if (facility){
-      boost::optional<QDomElement> campusElement = translateFacility(*facility, doc);
-      if (campusElement){
-        gbXMLElement.appendChild(*campusElement);
-      }
+      translateFacility(*facility, xmlWriter);
     }
 
     // do constructions
@@ -220,17 +225,14 @@ namespace gbxml {
     }
 
     for (const model::ConstructionBase& constructionBase : constructionBases){
-      boost::optional<QDomElement> constructionElement = translateConstructionBase(constructionBase, doc);
-      if (constructionElement){
-        gbXMLElement.appendChild(*constructionElement);
-      }
+      translateConstructionBase(constructionBase, xmlWriter);
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
       }
     }
 
-    // do materials
+    // do materials, collected while translating constructions
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Materials"));
       m_progressBar->setMinimum(0);
@@ -239,20 +241,14 @@ namespace gbxml {
     }
 
     for (const model::Material& material : m_materials){
-      boost::optional<QDomElement> layerElement = translateLayer(material, doc);
-      if (layerElement){
-        gbXMLElement.appendChild(*layerElement);
-      }
+      translateLayer(material, xmlWriter);
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
       }
     }
     for (const model::Material& material : m_materials){
-      boost::optional<QDomElement> materialElement = translateMaterial(material, doc);
-      if (materialElement){
-        gbXMLElement.appendChild(*materialElement);
-      }
+      translateMaterial(material, xmlWriter);
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
@@ -269,10 +265,7 @@ namespace gbxml {
     }
 
     for (const model::ThermalZone& thermalZone : thermalZones){
-      boost::optional<QDomElement> zoneElement = translateThermalZone(thermalZone, doc);
-      if (zoneElement){
-        gbXMLElement.appendChild(*zoneElement);
-      }
+      translateThermalZone(thermalZone, xmlWriter);
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
@@ -280,51 +273,35 @@ namespace gbxml {
     }
 
     // Document History
-    QDomElement documentHistoryElement = doc.createElement("DocumentHistory");
-    gbXMLElement.appendChild(documentHistoryElement);
-
-    QDomElement createdByElement = doc.createElement("CreatedBy");
-    documentHistoryElement.appendChild(createdByElement);
-    createdByElement.setAttribute("programId", "openstudio");
-    createdByElement.setAttribute("date",  toQString(DateTime::now().toXsdDateTime()));
-    createdByElement.setAttribute("personId", "unknown");
-
-    QDomElement programInfoElement = doc.createElement("ProgramInfo");
-    documentHistoryElement.appendChild(programInfoElement);
-    programInfoElement.setAttribute("id", "openstudio");
-
-    QDomElement productNameElement = doc.createElement("ProductName");
-    programInfoElement.appendChild(productNameElement);
-    productNameElement.appendChild(doc.createTextNode("OpenStudio"));
-
-    QDomElement versionElement = doc.createElement("Version");
-    programInfoElement.appendChild(versionElement);
-    versionElement.appendChild(doc.createTextNode(QString::fromStdString(openStudioVersion())));
-
-    QDomElement platformElement = doc.createElement("Platform");
-    programInfoElement.appendChild(platformElement);
+    xmlWriter.writeStartElement("DocumentHistory");
+
+    xmlWriter.writeStartElement("CreatedBy");
+    xmlWriter.writeAttribute("programId", "openstudio");
+    xmlWriter.writeAttribute("date",  toQString(DateTime::now().toXsdDateTime()));
+    xmlWriter.writeAttribute("personId", "unknown");
+    xmlWriter.writeEndElement(); // CreatedBy
+
+    xmlWriter.writeStartElement("ProgramInfo");
+    xmlWriter.writeAttribute("id", "openstudio");
+    xmlWriter.writeTextElement("ProductName", "OpenStudio");
+    xmlWriter.writeTextElement("Version", QString::fromStdString(openStudioVersion()));
     #if _WIN32 || _MSC_VER
-      platformElement.appendChild(doc.createTextNode("Windows"));
+      xmlWriter.writeTextElement("Platform", "Windows");
     #elif __APPLE__
-      platformElement.appendChild(doc.createTextNode("Apple"));
+      xmlWriter.writeTextElement("Platform", "Apple");
     #else
-      platformElement.appendChild(doc.createTextNode("Linux"));
+      xmlWriter.writeTextElement("Platform", "Linux");
     #endif
+    xmlWriter.writeEmptyElement("ProjectEntity");
+    xmlWriter.writeEndElement(); // ProgramInfo
 
-    QDomElement projectEntityElement = doc.createElement("ProjectEntity");
-    programInfoElement.appendChild(projectEntityElement);
+    xmlWriter.writeStartElement("PersonInfo");
+    xmlWriter.writeAttribute("id", "unknown");
+    xmlWriter.writeTextElement("FirstName", "Unknown");
+    xmlWriter.writeTextElement("LastName", "Unknown");
+    xmlWriter.writeEndElement(); // PersonInfo
 
-    QDomElement personInfoElement = doc.createElement("PersonInfo");
-    documentHistoryElement.appendChild(personInfoElement);
-    personInfoElement.setAttribute("id", "unknown");
-
-    QDomElement firstNameElement = doc.createElement("FirstName");
-    personInfoElement.appendChild(firstNameElement);
-    firstNameElement.appendChild(doc.createTextNode("Unknown"));
-
-    QDomElement lastNameElement = doc.createElement("LastName");
-    personInfoElement.appendChild(lastNameElement);
-    lastNameElement.appendChild(doc.createTextNode("Unknown"));
+    xmlWriter.writeEndElement(); // DocumentHistory
 
     // translate results
     boost::optional<SqlFile> sqlFile = model.sqlFile();
@@ -395,51 +372,33 @@ namespace gbxml {
         }
 
         if (heatLoad){
-          QDomElement resultsElement = doc.createElement("Results");
-          gbXMLElement.appendChild(resultsElement);
-          resultsElement.setAttribute("id", thermalZoneId + "HeatLoad");
-          resultsElement.setAttribute("resultsType", "HeatLoad");
-          resultsElement.setAttribute("unit", "Kilowatt");
-
-          QDomElement objectIdElement = doc.createElement("ObjectId");
-          resultsElement.appendChild(objectIdElement);
-          objectIdElement.appendChild(doc.createTextNode(thermalZoneId));
-
-          QDomElement valueElement = doc.createElement("Value");
-          resultsElement.appendChild(valueElement);
-          valueElement.appendChild(doc.createTextNode(QString::number(*heatLoad/1000.0, 'f')));
+          xmlWriter.writeStartElement("Results");
+          xmlWriter.writeAttribute("id", thermalZoneId + "HeatLoad");
+          xmlWriter.writeAttribute("resultsType", "HeatLoad");
+          xmlWriter.writeAttribute("unit", "Kilowatt");
+          xmlWriter.writeTextElement("ObjectId", thermalZoneId);
+          xmlWriter.writeTextElement("Value", QString::number(*heatLoad/1000.0, 'f'));
+          xmlWriter.writeEndElement(); // Results
         }
 
         if (coolingLoad){
-          QDomElement resultsElement = doc.createElement("Results");
-          gbXMLElement.appendChild(resultsElement);
-          resultsElement.setAttribute("id", thermalZoneId + "CoolingLoad");
-          resultsElement.setAttribute("resultsType", "CoolingLoad");
-          resultsElement.setAttribute("unit", "Kilowatt");
-
-          QDomElement objectIdElement = doc.createElement("ObjectId");
-          resultsElement.appendChild(objectIdElement);
-          objectIdElement.appendChild(doc.createTextNode(thermalZoneId));
-
-          QDomElement valueElement = doc.createElement("Value");
-          resultsElement.appendChild(valueElement);
-          valueElement.appendChild(doc.createTextNode(QString::number(*coolingLoad/1000.0, 'f')));
+          xmlWriter.writeStartElement("Results");
+          xmlWriter.writeAttribute("id", thermalZoneId + "CoolingLoad");
+          xmlWriter.writeAttribute("resultsType", "CoolingLoad");
+          xmlWriter.writeAttribute("unit", "Kilowatt");
+          xmlWriter.writeTextElement("ObjectId", thermalZoneId);
+          xmlWriter.writeTextElement("Value", QString::number(*coolingLoad/1000.0, 'f'));
+          xmlWriter.writeEndElement(); // Results
         }
 
         if (flow){
-          QDomElement resultsElement = doc.createElement("Results");
-          gbXMLElement.appendChild(resultsElement);
-          resultsElement.setAttribute("id", thermalZoneId + "Flow");
-          resultsElement.setAttribute("resultsType", "Flow");
-          resultsElement.setAttribute("unit", "CubicMPerHr");
-
-          QDomElement objectIdElement = doc.createElement("ObjectId");
-          resultsElement.appendChild(objectIdElement);
-          objectIdElement.appendChild(doc.createTextNode(thermalZoneId));
-
-          QDomElement valueElement = doc.createElement("Value");
-          resultsElement.appendChild(valueElement);
-          valueElement.appendChild(doc.createTextNode(QString::number(*flow*3600, 'f')));
+          xmlWriter.writeStartElement("Results");
+          xmlWriter.writeAttribute("id", thermalZoneId + "Flow");
+          xmlWriter.writeAttribute("resultsType", "Flow");
+          xmlWriter.writeAttribute("unit", "CubicMPerHr");
+          xmlWriter.writeTextElement("ObjectId", thermalZoneId);
+          xmlWriter.writeTextElement("Value", QString::number(*flow*3600, 'f'));
+          xmlWriter.writeEndElement(); // Results
         }
 
         if (m_progressBar){
@@ -448,26 +407,28 @@ namespace gbxml {
       }
     }
 
-    return doc;
+    xmlWriter.writeEndElement(); // gbXML
+    xmlWriter.writeEndDocument();
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateFacility(const openstudio::model::Facility& facility, QDomDocument& doc)
+  bool ForwardTranslator::translateFacility(const openstudio::model::Facility& facility, QXmlStreamWriter& xmlWriter)
   {
-    QDomElement result = doc.createElement("Campus");
-    m_translatedObjects[facility.handle()] = result;
+    m_translatedObjects.insert(facility.handle());
 
     boost::optional<std::string> name = facility.name();
 
+    xmlWriter.writeStartElement("Campus");
+
     // id
-    result.setAttribute("id", "Facility");
+    xmlWriter.writeAttribute("id", "Facility");
 
     // name
-    QDomElement nameElement = doc.createElement("Name");
-    result.appendChild(nameElement);
     if (name){
-      nameElement.appendChild(doc.createTextNode(QString::fromStdString(name.get())));
+      xmlWriter.writeTextElement("Name", QString::fromStdString(name.get()));
     }else{
-      nameElement.appendChild(doc.createTextNode("Facility"));
+      xmlWriter.writeTextElement("Name", "Facility");
     }
 
     model::Model model = facility.model();
@@ -477,10 +438,7 @@ namespace gbxml {
     // translate building
     boost::optional<model::Building> building = model.getOptionalUniqueModelObject<model::Building>();
     if (building){
-      boost::optional<QDomElement> buildingElement = translateBuilding(*building, doc);
-      if (buildingElement){
-        result.appendChild(*buildingElement);
-      }
+      translateBuilding(*building, xmlWriter);
     }
 
     // translate surfaces
@@ -493,10 +451,7 @@ namespace gbxml {
     }
 
     for (const model::Surface& surface : surfaces){
-      boost::optional<QDomElement> surfaceElement = translateSurface(surface, doc);
-      if (surfaceElement){
-        result.appendChild(*surfaceElement);
-      }
+      translateSurface(surface, xmlWriter);
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
@@ -513,36 +468,36 @@ namespace gbxml {
     }
 
     for (const model::ShadingSurface& shadingSurface : shadingSurfaces){
-      boost::optional<QDomElement> shadingSurfaceElement = translateShadingSurface(shadingSurface, doc);
-      if (shadingSurfaceElement){
-        result.appendChild(*shadingSurfaceElement);
-      }
+      translateShadingSurface(shadingSurface, xmlWriter);
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
       }
     }
 
-    return result;
+    xmlWriter.writeEndElement(); // Campus
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateBuilding(const openstudio::model::Building& building, QDomDocument& doc)
+  bool ForwardTranslator::translateBuilding(const openstudio::model::Building& building, QXmlStreamWriter& xmlWriter)
   {
-    QDomElement result = doc.createElement("Building");
-    m_translatedObjects[building.handle()] = result;
+    m_translatedObjects.insert(building.handle());
+
+    xmlWriter.writeStartElement("Building");
 
     // id
     std::string name = building.name().get();
-    result.setAttribute("id", escapeName(name));
+    xmlWriter.writeAttribute("id", escapeName(name));
 
     // building type
-    //result.setAttribute("buildingType", "Office");
-    result.setAttribute("buildingType", "Unknown");
+    //xmlWriter.writeAttribute("buildingType", "Office");
+    xmlWriter.writeAttribute("buildingType", "Unknown");
 
     boost::optional<std::string> standardsBuildingType = building.standardsBuildingType();
     if (standardsBuildingType){
       // todo: map to gbXML types
-      //result.setAttribute("buildingType", escapeName(spaceTypeName));
+      //xmlWriter.writeAttribute("buildingType", escapeName(spaceTypeName));
     }
 
     // space type
@@ -550,17 +505,13 @@ namespace gbxml {
     if (spaceType){
       //std::string spaceTypeName = spaceType->name().get();
       // todo: map to gbXML types
-      //result.setAttribute("buildingType", escapeName(spaceTypeName));
+      //xmlWriter.writeAttribute("buildingType", escapeName(spaceTypeName));
     }
 
     // name
-    QDomElement nameElement = doc.createElement("Name");
-    result.appendChild(nameElement);
-    nameElement.appendChild(doc.createTextNode(QString::fromStdString(name)));
+    xmlWriter.writeTextElement("Name", QString::fromStdString(name));
 
     // area
-    QDomElement areaElement = doc.createElement("Area");
-    result.appendChild(areaElement);
 
     // DLM: we want to use gbXML's definition of floor area which includes area from all spaces with people in them
     //double floorArea = building.floorArea();
@@ -575,7 +526,7 @@ namespace gbxml {
       }
     }
 
-    areaElement.appendChild(doc.createTextNode(QString::number(floorArea, 'f')));
+    xmlWriter.writeTextElement("Area", QString::number(floorArea, 'f'));
 
     // translate spaces
     if (m_progressBar){
@@ -586,10 +537,7 @@ namespace gbxml {
     }
 
     for (const model::Space& space : spaces){
-      boost::optional<QDomElement> spaceElement = translateSpace(space, doc);
-      if (spaceElement){
-        result.appendChild(*spaceElement);
-      }
+      translateSpace(space, xmlWriter);
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
@@ -606,10 +554,7 @@ namespace gbxml {
     }
 
     for (const model::ShadingSurfaceGroup& shadingSurfaceGroup : shadingSurfaceGroups){
-      boost::optional<QDomElement> shadingSurfaceGroupElement = translateShadingSurfaceGroup(shadingSurfaceGroup, doc);
-      if (shadingSurfaceGroupElement){
-        result.appendChild(*shadingSurfaceGroupElement);
-      }
+      translateShadingSurfaceGroup(shadingSurfaceGroup, xmlWriter);
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
@@ -626,66 +571,60 @@ namespace gbxml {
     }
 
     for (const model::BuildingStory& story : stories){
-      boost::optional<QDomElement> storyElement = translateBuildingStory(story, doc);
-      if (storyElement){
-        result.appendChild(*storyElement);
-      }
+      translateBuildingStory(story, xmlWriter);
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
       }
     }
 
-    return result;
+    xmlWriter.writeEndElement(); // Building
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateSpace(const openstudio::model::Space& space, QDomDocument& doc)
+  bool ForwardTranslator::translateSpace(const openstudio::model::Space& space, QXmlStreamWriter& xmlWriter)
   {
-    QDomElement result = doc.createElement("Space");
-    m_translatedObjects[space.handle()] = result;
+    m_translatedObjects.insert(space.handle());
+
+    xmlWriter.writeStartElement("Space");
 
     // id
     std::string name = space.name().get();
-    result.setAttribute("id", escapeName(name));
+    xmlWriter.writeAttribute("id", escapeName(name));
 
     // space type
     boost::optional<model::SpaceType> spaceType = space.spaceType();
     if (spaceType){
       //std::string spaceTypeName = spaceType->name().get();
       // todo: map to gbXML types
-      //result.setAttribute("spaceType", escapeName(spaceTypeName));
+      //xmlWriter.writeAttribute("spaceType", escapeName(spaceTypeName));
     }
 
     // thermal zone
     boost::optional<model::ThermalZone> thermalZone = space.thermalZone();
     if (thermalZone){
       std::string thermalZoneName = thermalZone->name().get();
-      result.setAttribute("zoneIdRef", escapeName(thermalZoneName));
+      xmlWriter.writeAttribute("zoneIdRef", escapeName(thermalZoneName));
     }
 
     // building story
     boost::optional<model::BuildingStory> story = space.buildingStory();
     if (story){
       std::string storyName = story->name().get();
-      result.setAttribute("buildingStoreyIdRef", escapeName(storyName));
+      xmlWriter.writeAttribute("buildingStoreyIdRef", escapeName(storyName));
     }
 
     // name
-    QDomElement nameElement = doc.createElement("Name");
-    result.appendChild(nameElement);
-    nameElement.appendChild(doc.createTextNode(QString::fromStdString(name)));
+    xmlWriter.writeTextElement("Name", QString::fromStdString(name));
 
     // append floor area
     double area = space.floorArea();
-    QDomElement areaElement = doc.createElement("Area");
-    areaElement.appendChild(doc.createTextNode(QString::number(area, 'f')));
-    result.appendChild(areaElement);
+    xmlWriter.writeTextElement("Area", QString::number(area, 'f'));
 
     // append volume
     double volume = space.volume();
-    QDomElement volumeElement = doc.createElement("Volume");
-    volumeElement.appendChild(doc.createTextNode(QString::number(volume, 'f')));
-    result.appendChild(volumeElement);
+    xmlWriter.writeTextElement("Volume", QString::number(volume, 'f'));
 
     // Lighting
 
@@ -697,10 +636,10 @@ namespace gbxml {
     double numberOfPeople = space.numberOfPeople();
     if (numberOfPeople > 0){
       double floorAreaPerPerson = space.floorAreaPerPerson();
-      QDomElement peopleNumberElement = doc.createElement("PeopleNumber");
-      peopleNumberElement.setAttribute("unit", "SquareMPerPerson");
-      peopleNumberElement.appendChild(doc.createTextNode(QString::number(floorAreaPerPerson, 'f')));
-      result.appendChild(peopleNumberElement);
+      xmlWriter.writeStartElement("PeopleNumber");
+      xmlWriter.writeAttribute("unit", "SquareMPerPerson");
+      xmlWriter.writeCharacters(QString::number(floorAreaPerPerson, 'f'));
+      xmlWriter.writeEndElement();
     }
 
     // PeopleHeatGain
@@ -710,52 +649,55 @@ namespace gbxml {
     // LightPowerPerArea
     double lightingPowerPerFloorArea = space.lightingPowerPerFloorArea();
     if (lightingPowerPerFloorArea > 0){
-      QDomElement lightPowerPerAreaElement = doc.createElement("LightPowerPerArea");
-      lightPowerPerAreaElement.setAttribute("unit", "WattPerSquareMeter");
-      lightPowerPerAreaElement.appendChild(doc.createTextNode(QString::number(lightingPowerPerFloorArea, 'f')));
-      result.appendChild(lightPowerPerAreaElement);
+      xmlWriter.writeStartElement("LightPowerPerArea");
+      xmlWriter.writeAttribute("unit", "WattPerSquareMeter");
+      xmlWriter.writeCharacters(QString::number(lightingPowerPerFloorArea, 'f'));
+      xmlWriter.writeEndElement();
     }
 
     // EquipPowerPerArea
     double electricEquipmentPowerPerFloorArea = space.electricEquipmentPowerPerFloorArea();
     if (electricEquipmentPowerPerFloorArea > 0){
-      QDomElement equipPowerPerAreaElement = doc.createElement("EquipPowerPerArea");
-      equipPowerPerAreaElement.setAttribute("unit", "WattPerSquareMeter");
-      equipPowerPerAreaElement.appendChild(doc.createTextNode(QString::number(electricEquipmentPowerPerFloorArea, 'f')));
-      result.appendChild(equipPowerPerAreaElement);
+      xmlWriter.writeStartElement("EquipPowerPerArea");
+      xmlWriter.writeAttribute("unit", "WattPerSquareMeter");
+      xmlWriter.writeCharacters(QString::number(electricEquipmentPowerPerFloorArea, 'f'));
+      xmlWriter.writeEndElement();
     }
 
     //  Temperature
     // unit "F", "C", "K", "R"
 
     // export CADObjectId if present
-    translateCADObjectId(space, result, doc);
+    translateCADObjectId(space, xmlWriter);
 
-    return result;
+    xmlWriter.writeEndElement(); // Space
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateShadingSurfaceGroup(const openstudio::model::ShadingSurfaceGroup& shadingSurfaceGroup, QDomDocument& doc)
+  bool ForwardTranslator::translateShadingSurfaceGroup(const openstudio::model::ShadingSurfaceGroup& shadingSurfaceGroup, QXmlStreamWriter& xmlWriter)
   {
     if (shadingSurfaceGroup.space()){
-      return boost::none;
+      return false;
     }
 
-    QDomElement result = doc.createElement("Space");
-    m_translatedObjects[shadingSurfaceGroup.handle()] = result;
+    m_translatedObjects.insert(shadingSurfaceGroup.handle());
+
+    xmlWriter.writeStartElement("Space");
 
     // id
     std::string name = shadingSurfaceGroup.name().get();
-    result.setAttribute("id", escapeName(name));
+    xmlWriter.writeAttribute("id", escapeName(name));
 
     // name
-    QDomElement nameElement = doc.createElement("Name");
-    result.appendChild(nameElement);
-    nameElement.appendChild(doc.createTextNode(QString::fromStdString(name)));
+    xmlWriter.writeTextElement("Name", QString::fromStdString(name));
 
-    return result;
+    xmlWriter.writeEndElement(); // Space
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateBuildingStory(const openstudio::model::BuildingStory& story, QDomDocument& doc)
+  bool ForwardTranslator::translateBuildingStory(const openstudio::model::BuildingStory& story, QXmlStreamWriter& xmlWriter)
   {
     boost::optional<double> zLevel = story.nominalZCoordinate();
 
@@ -779,39 +721,33 @@ namespace gbxml {
       zLevel = 0;
     }
 
-    QDomElement result = doc.createElement("BuildingStorey");
-    m_translatedObjects[story.handle()] = result;
+    m_translatedObjects.insert(story.handle());
+
+    xmlWriter.writeStartElement("BuildingStorey");
 
     // id
     std::string name = story.name().get();
-    result.setAttribute("id", escapeName(name));
+    xmlWriter.writeAttribute("id", escapeName(name));
 
     // name
-    QDomElement nameElement = doc.createElement("Name");
-    result.appendChild(nameElement);
-    nameElement.appendChild(doc.createTextNode(QString::fromStdString(name)));
+    xmlWriter.writeTextElement("Name", QString::fromStdString(name));
 
     // append level
-    QDomElement levelElement = doc.createElement("Level");
-    levelElement.appendChild(doc.createTextNode(QString::number(*zLevel, 'f')));
-    result.appendChild(levelElement);
+    xmlWriter.writeTextElement("Level", QString::number(*zLevel, 'f'));
 
-    return result;
+    xmlWriter.writeEndElement(); // BuildingStorey
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateSurface(const openstudio::model::Surface& surface, QDomDocument& doc)
+  bool ForwardTranslator::translateSurface(const openstudio::model::Surface& surface, QXmlStreamWriter& xmlWriter)
   {
     // return if already translated
     if (m_translatedObjects.find(surface.handle()) != m_translatedObjects.end()){
-      return boost::none;
+      return false;
     }
 
-    QDomElement result = doc.createElement("Surface");
-    m_translatedObjects[surface.handle()] = result;
-
-    // id
-    std::string name = surface.name().get();
-    result.setAttribute("id", escapeName(name));
+    m_translatedObjects.insert(surface.handle());
 
     // DLM: currently unhandled
     //FreestandingColumn
@@ -819,66 +755,94 @@ namespace gbxml {
 
     bool checkSlabOnGrade = false;
 
+    QString gbXMLSurfaceType;
     if (surface.isAirWall()){
-      result.setAttribute("surfaceType", "Air");
+      gbXMLSurfaceType = "Air";
     } else{
       std::string surfaceType = surface.surfaceType();
       std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
       if (istringEqual("Wall", surfaceType)){
         if (istringEqual("Outdoors", outsideBoundaryCondition)){
-          result.setAttribute("surfaceType", "ExteriorWall");
+          gbXMLSurfaceType = "ExteriorWall";
         } else if (istringEqual("Surface", outsideBoundaryCondition)){
-          result.setAttribute("surfaceType", "InteriorWall");
+          gbXMLSurfaceType = "InteriorWall";
         } else if (surface.isGroundSurface()){
-          result.setAttribute("surfaceType", "UndergroundWall");
+          gbXMLSurfaceType = "UndergroundWall";
         } else if (istringEqual("Adiabatic", outsideBoundaryCondition)) {
-          result.setAttribute("surfaceType", "InteriorWall");
+          gbXMLSurfaceType = "InteriorWall";
         }
       } else if (istringEqual("RoofCeiling", surfaceType)){
         if (istringEqual("Outdoors", outsideBoundaryCondition)){
-          result.setAttribute("surfaceType", "Roof");
+          gbXMLSurfaceType = "Roof";
         } else if (istringEqual("Surface", outsideBoundaryCondition)){
-          result.setAttribute("surfaceType", "Ceiling");
+          gbXMLSurfaceType = "Ceiling";
         } else if (surface.isGroundSurface()){
-          result.setAttribute("surfaceType", "UndergroundCeiling");
+          gbXMLSurfaceType = "UndergroundCeiling";
         } else if (istringEqual("Adiabatic", outsideBoundaryCondition)) {
-          result.setAttribute("surfaceType", "InteriorWall");
+          gbXMLSurfaceType = "InteriorWall";
         }
       } else if (istringEqual("Floor", surfaceType)){
         if (istringEqual("Outdoors", outsideBoundaryCondition)){
-          result.setAttribute("surfaceType", "RaisedFloor");
+          gbXMLSurfaceType = "RaisedFloor";
         } else if (surface.isGroundSurface()){
           checkSlabOnGrade = true;
-          result.setAttribute("surfaceType", "UndergroundSlab"); // might be SlabOnGrade, check vertices later
+          gbXMLSurfaceType = "UndergroundSlab"; // might be SlabOnGrade, check vertices later
         } else if (istringEqual("Surface", outsideBoundaryCondition)){
-          result.setAttribute("surfaceType", "InteriorFloor");
+          gbXMLSurfaceType = "InteriorFloor";
         } else if (istringEqual("Adiabatic", outsideBoundaryCondition)) {
-          result.setAttribute("surfaceType", "InteriorWall");
+          gbXMLSurfaceType = "InteriorWall";
         }
       }
     }
 
+    // this space
+    Transformation transformation;
+    boost::optional<model::Space> space = surface.space();
+    if (space){
+      transformation = space->siteTransformation();
+    }
+
+    // transform vertices to world coordinates
+    Point3dVector vertices = transformation*surface.vertices();
+
+    if (checkSlabOnGrade){
+      double minZ = std::numeric_limits<double>::max();
+      double maxZ = std::numeric_limits<double>::min();
+      for (const auto& vertex : vertices){
+        minZ = std::min(minZ, vertex.z());
+        maxZ = std::max(maxZ, vertex.z());
+      }
+      if ((maxZ <= 0.01) && (minZ >= -0.01)){
+        gbXMLSurfaceType = "SlabOnGrade";
+      }
+    }
+
+    // attributes are known now, start the element
+    xmlWriter.writeStartElement("Surface");
+
+    // id
+    std::string name = surface.name().get();
+    xmlWriter.writeAttribute("id", escapeName(name));
+
+    if (!gbXMLSurfaceType.isEmpty()){
+      xmlWriter.writeAttribute("surfaceType", gbXMLSurfaceType);
+    }
+
     // construction
     boost::optional<model::ConstructionBase> construction = surface.construction();
     if (construction){
       std::string constructionName = construction->name().get();
       if (construction->isOpaque()){
-        result.setAttribute("constructionIdRef", escapeName(constructionName));
+        xmlWriter.writeAttribute("constructionIdRef", escapeName(constructionName));
       } else{
-        result.setAttribute("constructionIdRef", escapeName(constructionName));
+        xmlWriter.writeAttribute("constructionIdRef", escapeName(constructionName));
       }
     }
 
-    // this space
-    Transformation transformation;
-    boost::optional<model::Space> space = surface.space();
     if (space){
-      transformation = space->siteTransformation();
-
       std::string spaceName = space->name().get();
-      QDomElement adjacentSpaceIdElement = doc.createElement("AdjacentSpaceId");
-      result.appendChild(adjacentSpaceIdElement);
-      adjacentSpaceIdElement.setAttribute("spaceIdRef", escapeName(spaceName));
+      xmlWriter.writeEmptyElement("AdjacentSpaceId");
+      xmlWriter.writeAttribute("spaceIdRef", escapeName(spaceName));
     }
 
     // adjacent surface
@@ -887,31 +851,14 @@ namespace gbxml {
       boost::optional<model::Space> adjacentSpace = adjacentSurface->space();
       if (adjacentSpace){
         std::string adjacentSpaceName = adjacentSpace->name().get();
-        QDomElement adjacentSpaceIdElement = doc.createElement("AdjacentSpaceId");
-        result.appendChild(adjacentSpaceIdElement);
-        adjacentSpaceIdElement.setAttribute("spaceIdRef", escapeName(adjacentSpaceName));
+        xmlWriter.writeEmptyElement("AdjacentSpaceId");
+        xmlWriter.writeAttribute("spaceIdRef", escapeName(adjacentSpaceName));
 
         // count adjacent surface as translated
-        m_translatedObjects[adjacentSurface->handle()] = result;
-      }
-    }
-
-    // transform vertices to world coordinates
-    Point3dVector vertices = transformation*surface.vertices();
-
-    if (checkSlabOnGrade){
-      double minZ = std::numeric_limits<double>::max();
-      double maxZ = std::numeric_limits<double>::min();
-      for (const auto& vertex : vertices){
-        minZ = std::min(minZ, vertex.z());
-        maxZ = std::max(maxZ, vertex.z());
-      }
-      if ((maxZ <= 0.01) && (minZ >= -0.01)){
-        result.setAttribute("surfaceType", "SlabOnGrade");
+        m_translatedObjects.insert(adjacentSurface->handle());
       }
     }
 
-
     // check if we can make rectangular geometry
     OptionalVector3d outwardNormal = getOutwardNormal(vertices);
     double area = surface.grossArea();
@@ -957,105 +904,77 @@ namespace gbxml {
       Point3d vertex = vertices[llcIndex];
 
       // rectangular geometry
-      QDomElement rectangularGeometryElement = doc.createElement("RectangularGeometry");
-      result.appendChild(rectangularGeometryElement);
-
-      QDomElement azimuthElement = doc.createElement("Azimuth");
-      rectangularGeometryElement.appendChild(azimuthElement);
-      azimuthElement.appendChild(doc.createTextNode(QString::number(radToDeg(azimuthRadians), 'g')));
+      xmlWriter.writeStartElement("RectangularGeometry");
 
-      QDomElement cartesianPointElement = doc.createElement("CartesianPoint");
-      rectangularGeometryElement.appendChild(cartesianPointElement);
+      xmlWriter.writeTextElement("Azimuth", QString::number(radToDeg(azimuthRadians), 'g'));
 
-      QDomElement coordinateXElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateXElement);
-      coordinateXElement.appendChild(doc.createTextNode(QString::number(vertex.x(), 'f')));
+      xmlWriter.writeStartElement("CartesianPoint");
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.x(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.y(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.z(), 'f'));
+      xmlWriter.writeEndElement(); // CartesianPoint
 
-      QDomElement coordinateYElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateYElement);
-      coordinateYElement.appendChild(doc.createTextNode(QString::number(vertex.y(), 'f')));
+      xmlWriter.writeTextElement("Tilt", QString::number(radToDeg(tiltRadians), 'g'));
+      xmlWriter.writeTextElement("Width", QString::number(areaCorrection*width, 'f'));
+      xmlWriter.writeTextElement("Height", QString::number(areaCorrection*height, 'f'));
 
-      QDomElement coordinateZElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateZElement);
-      coordinateZElement.appendChild(doc.createTextNode(QString::number(vertex.z(), 'f')));
-
-      QDomElement tiltElement = doc.createElement("Tilt");
-      rectangularGeometryElement.appendChild(tiltElement);
-      tiltElement.appendChild(doc.createTextNode(QString::number(radToDeg(tiltRadians), 'g')));
-
-      QDomElement widthElement = doc.createElement("Width");
-      rectangularGeometryElement.appendChild(widthElement);
-      widthElement.appendChild(doc.createTextNode(QString::number(areaCorrection*width, 'f')));
-
-      QDomElement heightElement = doc.createElement("Height");
-      rectangularGeometryElement.appendChild(heightElement);
-      heightElement.appendChild(doc.createTextNode(QString::number(areaCorrection*height, 'f')));
+      xmlWriter.writeEndElement(); // RectangularGeometry
     }
 
     // planar geometry
-    QDomElement planarGeometryElement = doc.createElement("PlanarGeometry");
-    result.appendChild(planarGeometryElement);
-
-    QDomElement polyLoopElement = doc.createElement("PolyLoop");
-    planarGeometryElement.appendChild(polyLoopElement);
+    xmlWriter.writeStartElement("PlanarGeometry");
+    xmlWriter.writeStartElement("PolyLoop");
     for (const Point3d& vertex : vertices){
-      QDomElement cartesianPointElement = doc.createElement("CartesianPoint");
-      polyLoopElement.appendChild(cartesianPointElement);
-
-      QDomElement coordinateXElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateXElement);
-      coordinateXElement.appendChild(doc.createTextNode(QString::number(vertex.x(), 'f')));
-
-      QDomElement coordinateYElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateYElement);
-      coordinateYElement.appendChild(doc.createTextNode(QString::number(vertex.y(), 'f')));
-
-      QDomElement coordinateZElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateZElement);
-      coordinateZElement.appendChild(doc.createTextNode(QString::number(vertex.z(), 'f')));
+      xmlWriter.writeStartElement("CartesianPoint");
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.x(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.y(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.z(), 'f'));
+      xmlWriter.writeEndElement(); // CartesianPoint
     }
+    xmlWriter.writeEndElement(); // PolyLoop
+    xmlWriter.writeEndElement(); // PlanarGeometry
 
     // export CADObjectId if present
-    if (!translateCADObjectId(surface, result, doc)) {
+    if (!translateCADObjectId(surface, xmlWriter)) {
       boost::optional<model::Surface> otherSurface = surface.adjacentSurface();
       if (otherSurface) {
-        translateCADObjectId(*otherSurface, result, doc);
+        translateCADObjectId(*otherSurface, xmlWriter);
       }
     }
 
     // translate sub surfaces
     for (const model::SubSurface& subSurface : surface.subSurfaces()){
-      boost::optional<QDomElement> openingElement = translateSubSurface(subSurface, transformation, doc);
-      if (openingElement){
-        result.appendChild(*openingElement);
-      }
+      translateSubSurface(subSurface, transformation, xmlWriter);
     }
 
-    return result;
+    xmlWriter.writeEndElement(); // Surface
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateSubSurface(const openstudio::model::SubSurface& subSurface, const openstudio::Transformation& transformation, QDomDocument& doc)
+  bool ForwardTranslator::translateSubSurface(const openstudio::model::SubSurface& subSurface, const openstudio::Transformation& transformation, QXmlStreamWriter& xmlWriter)
   {
     // return if already translated
     if (m_translatedObjects.find(subSurface.handle()) != m_translatedObjects.end()){
-      return boost::none;
+      return false;
     }
 
-    QDomElement result = doc.createElement("Opening");
-    m_translatedObjects[subSurface.handle()] = result;
+    m_translatedObjects.insert(subSurface.handle());
+
+    xmlWriter.writeStartElement("Opening");
 
     // id
     std::string name = subSurface.name().get();
-    result.setAttribute("id", escapeName(name));
+    xmlWriter.writeAttribute("id", escapeName(name));
 
     // construction
     boost::optional<model::ConstructionBase> construction = subSurface.construction();
     if (construction){
       std::string constructionName = construction->name().get();
       if (construction->isOpaque()){
-        result.setAttribute("constructionIdRef", escapeName(constructionName));
+        xmlWriter.writeAttribute("constructionIdRef", escapeName(constructionName));
       } else{
-        result.setAttribute("windowTypeIdRef", escapeName(constructionName));
+        xmlWriter.writeAttribute("windowTypeIdRef", escapeName(constructionName));
       }
     }
 
@@ -1064,25 +983,25 @@ namespace gbxml {
     // SlidingDoor
 
     if (subSurface.isAirWall()){
-      result.setAttribute("openingType", "Air");
+      xmlWriter.writeAttribute("openingType", "Air");
     }else{
       std::string subSurfaceType = subSurface.subSurfaceType();
       if (istringEqual("FixedWindow", subSurfaceType)){
-        result.setAttribute("openingType", "FixedWindow");
+        xmlWriter.writeAttribute("openingType", "FixedWindow");
       }else if(istringEqual("OperableWindow", subSurfaceType)){
-        result.setAttribute("openingType", "OperableWindow");
+        xmlWriter.writeAttribute("openingType", "OperableWindow");
       }else if (istringEqual("Door", subSurfaceType)){
-        result.setAttribute("openingType", "NonSlidingDoor");
+        xmlWriter.writeAttribute("openingType", "NonSlidingDoor");
       }else if (istringEqual("GlassDoor", subSurfaceType)){
-        result.setAttribute("openingType", "SlidingDoor");
+        xmlWriter.writeAttribute("openingType", "SlidingDoor");
       }else if (istringEqual("OverheadDoor", subSurfaceType)){
-        result.setAttribute("openingType", "NonSlidingDoor");
+        xmlWriter.writeAttribute("openingType", "NonSlidingDoor");
       }else if (istringEqual("Skylight", subSurfaceType)){
-        result.setAttribute("openingType", "FixedSkylight");
+        xmlWriter.writeAttribute("openingType", "FixedSkylight");
       }else if (istringEqual("TubularDaylightDome", subSurfaceType)){
-        result.setAttribute("openingType", "FixedSkylight");
+        xmlWriter.writeAttribute("openingType", "FixedSkylight");
       }else if (istringEqual("TubularDaylightDiffuser", subSurfaceType)){
-        result.setAttribute("openingType", "FixedSkylight");
+        xmlWriter.writeAttribute("openingType", "FixedSkylight");
       }
     }
 
@@ -1134,99 +1053,76 @@ namespace gbxml {
       Point3d vertex = vertices[llcIndex];
 
       // rectangular geometry
-      QDomElement rectangularGeometryElement = doc.createElement("RectangularGeometry");
-      result.appendChild(rectangularGeometryElement);
-
-      QDomElement azimuthElement = doc.createElement("Azimuth");
-      rectangularGeometryElement.appendChild(azimuthElement);
-      azimuthElement.appendChild(doc.createTextNode(QString::number(radToDeg(azimuthRadians), 'g')));
+      xmlWriter.writeStartElement("RectangularGeometry");
 
-      QDomElement cartesianPointElement = doc.createElement("CartesianPoint");
-      rectangularGeometryElement.appendChild(cartesianPointElement);
+      xmlWriter.writeTextElement("Azimuth", QString::number(radToDeg(azimuthRadians), 'g'));
 
-      QDomElement coordinateXElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateXElement);
-      coordinateXElement.appendChild(doc.createTextNode(QString::number(vertex.x(), 'f')));
+      xmlWriter.writeStartElement("CartesianPoint");
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.x(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.y(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.z(), 'f'));
+      xmlWriter.writeEndElement(); // CartesianPoint
 
-      QDomElement coordinateYElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateYElement);
-      coordinateYElement.appendChild(doc.createTextNode(QString::number(vertex.y(), 'f')));
+      xmlWriter.writeTextElement("Tilt", QString::number(radToDeg(tiltRadians), 'g'));
+      xmlWriter.writeTextElement("Width", QString::number(areaCorrection*width, 'f'));
+      xmlWriter.writeTextElement("Height", QString::number(areaCorrection*height, 'f'));
 
-      QDomElement coordinateZElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateZElement);
-      coordinateZElement.appendChild(doc.createTextNode(QString::number(vertex.z(), 'f')));
-
-      QDomElement tiltElement = doc.createElement("Tilt");
-      rectangularGeometryElement.appendChild(tiltElement);
-      tiltElement.appendChild(doc.createTextNode(QString::number(radToDeg(tiltRadians), 'g')));
-
-      QDomElement widthElement = doc.createElement("Width");
-      rectangularGeometryElement.appendChild(widthElement);
-      widthElement.appendChild(doc.createTextNode(QString::number(areaCorrection*width, 'f')));
-
-      QDomElement heightElement = doc.createElement("Height");
-      rectangularGeometryElement.appendChild(heightElement);
-      heightElement.appendChild(doc.createTextNode(QString::number(areaCorrection*height, 'f')));
+      xmlWriter.writeEndElement(); // RectangularGeometry
     }
 
     // planar geometry
-    QDomElement planarGeometryElement = doc.createElement("PlanarGeometry");
-    result.appendChild(planarGeometryElement);
+    xmlWriter.writeStartElement("PlanarGeometry");
 
     // translate vertices
-    QDomElement polyLoopElement = doc.createElement("PolyLoop");
-    planarGeometryElement.appendChild(polyLoopElement);
+    xmlWriter.writeStartElement("PolyLoop");
     for (const Point3d& vertex : vertices){
-      QDomElement cartesianPointElement = doc.createElement("CartesianPoint");
-      polyLoopElement.appendChild(cartesianPointElement);
-
-      QDomElement coordinateXElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateXElement);
-      coordinateXElement.appendChild(doc.createTextNode(QString::number(vertex.x(), 'f')));
-
-      QDomElement coordinateYElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateYElement);
-      coordinateYElement.appendChild(doc.createTextNode(QString::number(vertex.y(), 'f')));
-
-      QDomElement coordinateZElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateZElement);
-      coordinateZElement.appendChild(doc.createTextNode(QString::number(vertex.z(), 'f')));
+      xmlWriter.writeStartElement("CartesianPoint");
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.x(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.y(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.z(), 'f'));
+      xmlWriter.writeEndElement(); // CartesianPoint
     }
+    xmlWriter.writeEndElement(); // PolyLoop
+    xmlWriter.writeEndElement(); // PlanarGeometry
 
     // export CADObjectId if present
-    if (!translateCADObjectId(subSurface, result, doc)){
+    if (!translateCADObjectId(subSurface, xmlWriter)){
       boost::optional<model::SubSurface> otherSubSurface = subSurface.adjacentSubSurface();
       if (otherSubSurface) {
-        translateCADObjectId(*otherSubSurface, result, doc);
+        translateCADObjectId(*otherSubSurface, xmlWriter);
       }
     }
-    return result;
+
+    xmlWriter.writeEndElement(); // Opening
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateShadingSurface(const openstudio::model::ShadingSurface& shadingSurface, QDomDocument& doc)
+  bool ForwardTranslator::translateShadingSurface(const openstudio::model::ShadingSurface& shadingSurface, QXmlStreamWriter& xmlWriter)
   {
     // return if already translated
     if (m_translatedObjects.find(shadingSurface.handle()) != m_translatedObjects.end()){
-      return boost::none;
+      return false;
     }
 
-    QDomElement result = doc.createElement("Surface");
-    m_translatedObjects[shadingSurface.handle()] = result;
+    m_translatedObjects.insert(shadingSurface.handle());
+
+    xmlWriter.writeStartElement("Surface");
 
     // id
     std::string name = shadingSurface.name().get();
-    result.setAttribute("id", escapeName(name));
+    xmlWriter.writeAttribute("id", escapeName(name));
 
-    result.setAttribute("surfaceType", "Shade");
+    xmlWriter.writeAttribute("surfaceType", "Shade");
 
     // construction
     boost::optional<model::ConstructionBase> construction = shadingSurface.construction();
     if (construction){
       std::string constructionName = construction->name().get();
       if (construction->isOpaque()){
-        result.setAttribute("constructionIdRef", escapeName(constructionName));
+        xmlWriter.writeAttribute("constructionIdRef", escapeName(constructionName));
       } else{
-        result.setAttribute("windowTypeIdRef", escapeName(constructionName));
+        xmlWriter.writeAttribute("windowTypeIdRef", escapeName(constructionName));
       }
     }
 
@@ -1242,18 +1138,16 @@ namespace gbxml {
       }
 
       std::string spaceName = space->name().get();
-      QDomElement adjacentSpaceIdElement = doc.createElement("AdjacentSpaceId");
-      result.appendChild(adjacentSpaceIdElement);
-      adjacentSpaceIdElement.setAttribute("spaceIdRef", escapeName(spaceName));
+      xmlWriter.writeEmptyElement("AdjacentSpaceId");
+      xmlWriter.writeAttribute("spaceIdRef", escapeName(spaceName));
     } else {
       boost::optional<model::ShadingSurfaceGroup> shadingSurfaceGroup = shadingSurface.shadingSurfaceGroup();
       if (shadingSurfaceGroup){
         transformation = shadingSurfaceGroup->siteTransformation();
 
         std::string spaceName = shadingSurfaceGroup->name().get();
-        QDomElement adjacentSpaceIdElement = doc.createElement("AdjacentSpaceId");
-        result.appendChild(adjacentSpaceIdElement);
-        adjacentSpaceIdElement.setAttribute("spaceIdRef", escapeName(spaceName));
+        xmlWriter.writeEmptyElement("AdjacentSpaceId");
+        xmlWriter.writeAttribute("spaceIdRef", escapeName(spaceName));
       }
     }
 
@@ -1305,83 +1199,56 @@ namespace gbxml {
       Point3d vertex = vertices[llcIndex];
 
       // rectangular geometry
-      QDomElement rectangularGeometryElement = doc.createElement("RectangularGeometry");
-      result.appendChild(rectangularGeometryElement);
-
-      QDomElement azimuthElement = doc.createElement("Azimuth");
-      rectangularGeometryElement.appendChild(azimuthElement);
-      azimuthElement.appendChild(doc.createTextNode(QString::number(radToDeg(azimuthRadians), 'g')));
+      xmlWriter.writeStartElement("RectangularGeometry");
 
-      QDomElement cartesianPointElement = doc.createElement("CartesianPoint");
-      rectangularGeometryElement.appendChild(cartesianPointElement);
+      xmlWriter.writeTextElement("Azimuth", QString::number(radToDeg(azimuthRadians), 'g'));
 
-      QDomElement coordinateXElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateXElement);
-      coordinateXElement.appendChild(doc.createTextNode(QString::number(vertex.x(), 'f')));
+      xmlWriter.writeStartElement("CartesianPoint");
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.x(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.y(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.z(), 'f'));
+      xmlWriter.writeEndElement(); // CartesianPoint
 
-      QDomElement coordinateYElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateYElement);
-      coordinateYElement.appendChild(doc.createTextNode(QString::number(vertex.y(), 'f')));
+      xmlWriter.writeTextElement("Tilt", QString::number(radToDeg(tiltRadians), 'g'));
+      xmlWriter.writeTextElement("Width", QString::number(areaCorrection*width, 'f'));
+      xmlWriter.writeTextElement("Height", QString::number(areaCorrection*height, 'f'));
 
-      QDomElement coordinateZElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateZElement);
-      coordinateZElement.appendChild(doc.createTextNode(QString::number(vertex.z(), 'f')));
-
-      QDomElement tiltElement = doc.createElement("Tilt");
-      rectangularGeometryElement.appendChild(tiltElement);
-      tiltElement.appendChild(doc.createTextNode(QString::number(radToDeg(tiltRadians), 'g')));
-
-      QDomElement widthElement = doc.createElement("Width");
-      rectangularGeometryElement.appendChild(widthElement);
-      widthElement.appendChild(doc.createTextNode(QString::number(areaCorrection*width, 'f')));
-
-      QDomElement heightElement = doc.createElement("Height");
-      rectangularGeometryElement.appendChild(heightElement);
-      heightElement.appendChild(doc.createTextNode(QString::number(areaCorrection*height, 'f')));
+      xmlWriter.writeEndElement(); // RectangularGeometry
     }
 
     // planar geometry
-    QDomElement planarGeometryElement = doc.createElement("PlanarGeometry");
-    result.appendChild(planarGeometryElement);
-
-    QDomElement polyLoopElement = doc.createElement("PolyLoop");
-    planarGeometryElement.appendChild(polyLoopElement);
+    xmlWriter.writeStartElement("PlanarGeometry");
+    xmlWriter.writeStartElement("PolyLoop");
     for (const Point3d& vertex : vertices){
-      QDomElement cartesianPointElement = doc.createElement("CartesianPoint");
-      polyLoopElement.appendChild(cartesianPointElement);
-
-      QDomElement coordinateXElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateXElement);
-      coordinateXElement.appendChild(doc.createTextNode(QString::number(vertex.x(), 'f')));
-
-      QDomElement coordinateYElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateYElement);
-      coordinateYElement.appendChild(doc.createTextNode(QString::number(vertex.y(), 'f')));
-
-      QDomElement coordinateZElement = doc.createElement("Coordinate");
-      cartesianPointElement.appendChild(coordinateZElement);
-      coordinateZElement.appendChild(doc.createTextNode(QString::number(vertex.z(), 'f')));
+      xmlWriter.writeStartElement("CartesianPoint");
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.x(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.y(), 'f'));
+      xmlWriter.writeTextElement("Coordinate", QString::number(vertex.z(), 'f'));
+      xmlWriter.writeEndElement(); // CartesianPoint
     }
+    xmlWriter.writeEndElement(); // PolyLoop
+    xmlWriter.writeEndElement(); // PlanarGeometry
 
     // export CADObjectId if present
-    translateCADObjectId(shadingSurface, result, doc);
+    translateCADObjectId(shadingSurface, xmlWriter);
 
-    return result;
+    xmlWriter.writeEndElement(); // Surface
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateThermalZone(const openstudio::model::ThermalZone& thermalZone, QDomDocument& doc)
+  bool ForwardTranslator::translateThermalZone(const openstudio::model::ThermalZone& thermalZone, QXmlStreamWriter& xmlWriter)
   {
-    QDomElement result = doc.createElement("Zone");
-    m_translatedObjects[thermalZone.handle()] = result;
+    m_translatedObjects.insert(thermalZone.handle());
+
+    xmlWriter.writeStartElement("Zone");
 
     // id
     std::string name = thermalZone.name().get();
-    result.setAttribute("id", escapeName(name));
+    xmlWriter.writeAttribute("id", escapeName(name));
 
     // name
-    QDomElement nameElement = doc.createElement("Name");
-    result.appendChild(nameElement);
-    nameElement.appendChild(doc.createTextNode(QString::fromStdString(name)));
+    xmlWriter.writeTextElement("Name", QString::fromStdString(name));
 
     // heating setpoint
     boost::optional<double> designHeatT;
@@ -1416,50 +1283,51 @@ namespace gbxml {
     }
 
     if (designHeatT){
-      QDomElement designHeatTElement = doc.createElement("DesignHeatT");
-      designHeatTElement.setAttribute("unit", "C");
-      designHeatTElement.appendChild(doc.createTextNode(QString::number(*designHeatT, 'f')));
-      result.appendChild(designHeatTElement);
+      xmlWriter.writeStartElement("DesignHeatT");
+      xmlWriter.writeAttribute("unit", "C");
+      xmlWriter.writeCharacters(QString::number(*designHeatT, 'f'));
+      xmlWriter.writeEndElement();
     }
 
     if (designCoolT){
-      QDomElement designCoolTElement = doc.createElement("DesignCoolT");
-      designCoolTElement.setAttribute("unit", "C");
-      designCoolTElement.appendChild(doc.createTextNode(QString::number(*designCoolT, 'f')));
-      result.appendChild(designCoolTElement);
+      xmlWriter.writeStartElement("DesignCoolT");
+      xmlWriter.writeAttribute("unit", "C");
+      xmlWriter.writeCharacters(QString::number(*designCoolT, 'f'));
+      xmlWriter.writeEndElement();
     }
 
     // export CADObjectId if present
-    translateCADObjectId(thermalZone, result, doc);
+    translateCADObjectId(thermalZone, xmlWriter);
 
-    return result;
+    xmlWriter.writeEndElement(); // Zone
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateCADObjectId(const openstudio::model::ModelObject& modelObject, QDomElement& parentElement, QDomDocument& doc)
+  bool ForwardTranslator::translateCADObjectId(const openstudio::model::ModelObject& modelObject, QXmlStreamWriter& xmlWriter)
   {
-    boost::optional<QDomElement> result;
-
     if (modelObject.hasAdditionalProperties()) {
       model::AdditionalProperties additionalProperties = modelObject.additionalProperties();
       if (additionalProperties.hasFeature("CADObjectId")) {
         boost::optional<std::string> cadObjectId = additionalProperties.getFeatureAsString("CADObjectId");
         if (cadObjectId) {
-          QDomElement cadObjectIdElement = doc.createElement("CADObjectId");
-          cadObjectIdElement.appendChild(doc.createTextNode(toQString(*cadObjectId)));
+          xmlWriter.writeStartElement("CADObjectId");
 
           if (additionalProperties.hasFeature("programIdRef")) {
             boost::optional<std::string> programIdRef = additionalProperties.getFeatureAsString("programIdRef");
             if (programIdRef){
-              cadObjectIdElement.setAttribute("programIdRef", toQString(*programIdRef));
+              xmlWriter.writeAttribute("programIdRef", toQString(*programIdRef));
             }
           }
 
-          parentElement.appendChild(cadObjectIdElement);
-          result = cadObjectIdElement;
+          xmlWriter.writeCharacters(toQString(*cadObjectId));
+          xmlWriter.writeEndElement(); // CADObjectId
+
+          return true;
         }
       }
     }
-    return result;
+    return false;
   }
 
 } // gbxml
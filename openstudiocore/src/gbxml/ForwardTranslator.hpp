@@ -39,11 +39,9 @@
 
 #include "../model/ModelObject.hpp"
 
-#include <map>
+#include <set>
 
-class QDomDocument;
-class QDomElement;
-class QDomNodeList;
+class QXmlStreamWriter;
 
 namespace openstudio {
 
@@ -89,22 +87,23 @@ namespace gbxml {
     QString escapeName(const std::string& name);
 
     // listed in translation order
-    boost::optional<QDomDocument> translateModel(const openstudio::model::Model& model);
-    boost::optional<QDomElement> translateFacility(const openstudio::model::Facility& facility, QDomDocument& doc);
-    boost::optional<QDomElement> translateBuilding(const openstudio::model::Building& building, QDomDocument& doc);
-    boost::optional<QDomElement> translateSpace(const openstudio::model::Space& space, QDomDocument& doc);
-    boost::optional<QDomElement> translateShadingSurfaceGroup(const openstudio::model::ShadingSurfaceGroup& shadingSurfaceGroup, QDomDocument& doc);
-    boost::optional<QDomElement> translateBuildingStory(const openstudio::model::BuildingStory& story, QDomDocument& doc);
-    boost::optional<QDomElement> translateSurface(const openstudio::model::Surface& surface, QDomDocument& doc);
-    boost::optional<QDomElement> translateSubSurface(const openstudio::model::SubSurface& subSurface, const openstudio::Transformation& transformation, QDomDocument& doc);
-    boost::optional<QDomElement> translateShadingSurface(const openstudio::model::ShadingSurface& shadingSurface, QDomDocument& doc);
-    boost::optional<QDomElement> translateThermalZone(const openstudio::model::ThermalZone& thermalZone, QDomDocument& doc);
-    boost::optional<QDomElement> translateLayer(const openstudio::model::Material& material, QDomDocument& doc);
-    boost::optional<QDomElement> translateMaterial(const openstudio::model::Material& material, QDomDocument& doc);
-    boost::optional<QDomElement> translateConstructionBase(const openstudio::model::ConstructionBase& constructionBase, QDomDocument& doc);
-    boost::optional<QDomElement> translateCADObjectId(const openstudio::model::ModelObject& modelObject, QDomElement& parentElement, QDomDocument& doc);
-
-    std::map<openstudio::Handle, QDomElement> m_translatedObjects;
+    // each translate method writes its element to xmlWriter as it walks the model, returning false if nothing was written
+    bool translateModel(const openstudio::model::Model& model, QXmlStreamWriter& xmlWriter);
+    bool translateFacility(const openstudio::model::Facility& facility, QXmlStreamWriter& xmlWriter);
+    bool translateBuilding(const openstudio::model::Building& building, QXmlStreamWriter& xmlWriter);
+    bool translateSpace(const openstudio::model::Space& space, QXmlStreamWriter& xmlWriter);
+    bool translateShadingSurfaceGroup(const openstudio::model::ShadingSurfaceGroup& shadingSurfaceGroup, QXmlStreamWriter& xmlWriter);
+    bool translateBuildingStory(const openstudio::model::BuildingStory& story, QXmlStreamWriter& xmlWriter);
+    bool translateSurface(const openstudio::model::Surface& surface, QXmlStreamWriter& xmlWriter);
+    bool translateSubSurface(const openstudio::model::SubSurface& subSurface, const openstudio::Transformation& transformation, QXmlStreamWriter& xmlWriter);
+    bool translateShadingSurface(const openstudio::model::ShadingSurface& shadingSurface, QXmlStreamWriter& xmlWriter);
+    bool translateThermalZone(const openstudio::model::ThermalZone& thermalZone, QXmlStreamWriter& xmlWriter);
+    bool translateLayer(const openstudio::model::Material& material, QXmlStreamWriter& xmlWriter);
+    bool translateMaterial(const openstudio::model::Material& material, QXmlStreamWriter& xmlWriter);
+    bool translateConstructionBase(const openstudio::model::ConstructionBase& constructionBase, QXmlStreamWriter& xmlWriter);
+    bool translateCADObjectId(const openstudio::model::ModelObject& modelObject, QXmlStreamWriter& xmlWriter);
+
+    std::set<openstudio::Handle> m_translatedObjects;
 
     std::set<openstudio::model::Material, openstudio::IdfObjectImplLess> m_materials;
 
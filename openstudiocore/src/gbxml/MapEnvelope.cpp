@@ -52,11 +52,12 @@
 
 #include <QDomDocument>
 #include <QDomElement>
+#include <QXmlStreamWriter>
 
 namespace openstudio {
 namespace gbxml {
 
-  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateConstruction(const QDomElement& element, const QDomNodeList& layerElements, const QDomDocument& doc, openstudio::model::Model& model)
+  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateConstruction(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
   {
     // Krishnan, this constructor should only be used for unique objects like Building and Site
     //openstudio::model::Construction construction = model.getUniqueModelObject<openstudio::model::Construction>();
@@ -80,20 +81,17 @@ namespace gbxml {
       QString layerId = layerIdList.at(layerIdIdx).toElement().attribute("layerIdRef");
 
       // find this layerId in all the layers
-      for (int i = 0; i < layerElements.count(); i++) {
-        QDomElement layerElement = layerElements.at(i).toElement();
-        if (layerId == layerElement.attribute("id")) {
-          QDomNodeList materialIdElements = layerElement.elementsByTagName("MaterialId");
-          for (int j = 0; j < materialIdElements.count(); j++) {
-            QString materialId = materialIdElements.at(j).toElement().attribute("materialIdRef");
-            auto materialIt = m_idToObjectMap.find(materialId);
-            if (materialIt != m_idToObjectMap.end()) {
-              boost::optional<openstudio::model::Material> material = materialIt->second.optionalCast<openstudio::model::Material>();
-              OS_ASSERT(material); // Krishnan, what type of error handling do you want?
-              materials.push_back(*material);
-            }
+      auto layerIt = m_layerElements.find(layerId);
+      if (layerIt != m_layerElements.end()) {
+        QDomNodeList materialIdElements = layerIt->second.elementsByTagName("MaterialId");
+        for (int j = 0; j < materialIdElements.count(); j++) {
+          QString materialId = materialIdElements.at(j).toElement().attribute("materialIdRef");
+          auto materialIt = m_idToObjectMap.find(materialId);
+          if (materialIt != m_idToObjectMap.end()) {
+            boost::optional<openstudio::model::Material> material = materialIt->second.optionalCast<openstudio::model::Material>();
+            OS_ASSERT(material); // Krishnan, what type of error handling do you want?
+            materials.push_back(*material);
           }
-          break;
         }
       }
     }
@@ -249,36 +247,31 @@ namespace gbxml {
     return result;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateConstructionBase(const openstudio::model::ConstructionBase& constructionBase, QDomDocument& doc)
+  bool ForwardTranslator::translateConstructionBase(const openstudio::model::ConstructionBase& constructionBase, QXmlStreamWriter& xmlWriter)
   {
-    boost::optional<QDomElement> result;
-
     bool isOpaque = constructionBase.isOpaque();
 
+    m_translatedObjects.insert(constructionBase.handle());
+
     if (isOpaque){
-      result = doc.createElement("Construction");
-      m_translatedObjects[constructionBase.handle()] = *result;
+      xmlWriter.writeStartElement("Construction");
     } else{
-      result = doc.createElement("WindowType");
-      m_translatedObjects[constructionBase.handle()] = *result;
+      xmlWriter.writeStartElement("WindowType");
     }
 
     std::string name = constructionBase.name().get();
 
     // id
-    result->setAttribute("id", escapeName(name));
+    xmlWriter.writeAttribute("id", escapeName(name));
 
     // name
-    QDomElement nameElement = doc.createElement("Name");
-    result->appendChild(nameElement);
-    nameElement.appendChild(doc.createTextNode(QString::fromStdString(name)));
+    xmlWriter.writeTextElement("Name", QString::fromStdString(name));
 
     if (isOpaque){
       if (constructionBase.optionalCast<model::LayeredConstruction>()){
         for (const auto& layer : constructionBase.cast<model::LayeredConstruction>().layers()){
-          QDomElement layerIdElement = doc.createElement("LayerId");
-          result->appendChild(layerIdElement);
-          layerIdElement.setAttribute("layerIdRef", escapeName(layer.name().get() + " Layer"));
+          xmlWriter.writeEmptyElement("LayerId");
+          xmlWriter.writeAttribute("layerIdRef", escapeName(layer.name().get() + " Layer"));
 
           m_materials.insert(layer);
         }
@@ -312,71 +305,67 @@ namespace gbxml {
 
 
       if (visibleTransmittance){
-        QDomElement element = doc.createElement("Transmittance");
-        result->appendChild(element);
-        element.appendChild(doc.createTextNode(QString::number(*visibleTransmittance)));
-        element.setAttribute("unit", "Fraction");
-        element.setAttribute("type", "Visible");
-        element.setAttribute("surfaceType", "Both");
+        xmlWriter.writeStartElement("Transmittance");
+        xmlWriter.writeAttribute("unit", "Fraction");
+        xmlWriter.writeAttribute("type", "Visible");
+        xmlWriter.writeAttribute("surfaceType", "Both");
+        xmlWriter.writeCharacters(QString::number(*visibleTransmittance));
+        xmlWriter.writeEndElement();
       }
 
       if (uFactor){
-        QDomElement element = doc.createElement("U-value");
-        result->appendChild(element);
-        element.appendChild(doc.createTextNode(QString::number(*uFactor)));
-        element.setAttribute("unit", "WPerSquareMeterK");
+        xmlWriter.writeStartElement("U-value");
+        xmlWriter.writeAttribute("unit", "WPerSquareMeterK");
+        xmlWriter.writeCharacters(QString::number(*uFactor));
+        xmlWriter.writeEndElement();
       }
 
       if (solarHeatGainCoefficient){
-        QDomElement element = doc.createElement("SolarHeatGainCoeff");
-        result->appendChild(element);
-        element.appendChild(doc.createTextNode(QString::number(*solarHeatGainCoefficient)));
-        element.setAttribute("unit", "Fraction");
+        xmlWriter.writeStartElement("SolarHeatGainCoeff");
+        xmlWriter.writeAttribute("unit", "Fraction");
+        xmlWriter.writeCharacters(QString::number(*solarHeatGainCoefficient));
+        xmlWriter.writeEndElement();
       }
     }
-    return result;
+
+    xmlWriter.writeEndElement(); // Construction or WindowType
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateLayer(const openstudio::model::Material& material, QDomDocument& doc)
+  bool ForwardTranslator::translateLayer(const openstudio::model::Material& material, QXmlStreamWriter& xmlWriter)
   {
-    boost::optional<QDomElement> result;
-
-    result = doc.createElement("Layer");
+    xmlWriter.writeStartElement("Layer");
 
     std::string materialName = material.name().get();
     std::string layerName = materialName + " Layer";
 
     // id
-    result->setAttribute("id", escapeName(layerName));
+    xmlWriter.writeAttribute("id", escapeName(layerName));
 
     // name
-    QDomElement nameElement = doc.createElement("Name");
-    result->appendChild(nameElement);
-    nameElement.appendChild(doc.createTextNode(QString::fromStdString(layerName)));
+    xmlWriter.writeTextElement("Name", QString::fromStdString(layerName));
 
     // name
-    QDomElement materialIdElement = doc.createElement("MaterialId");
-    result->appendChild(materialIdElement);
-    materialIdElement.setAttribute("materialIdRef", escapeName(materialName));
+    xmlWriter.writeEmptyElement("MaterialId");
+    xmlWriter.writeAttribute("materialIdRef", escapeName(materialName));
 
-    return result;
+    xmlWriter.writeEndElement(); // Layer
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateMaterial(const openstudio::model::Material& material, QDomDocument& doc)
+  bool ForwardTranslator::translateMaterial(const openstudio::model::Material& material, QXmlStreamWriter& xmlWriter)
   {
-    boost::optional<QDomElement> result;
-
-    result = doc.createElement("Material");
+    xmlWriter.writeStartElement("Material");
 
     std::string name = material.name().get();
 
     // id
-    result->setAttribute("id", escapeName(name));
+    xmlWriter.writeAttribute("id", escapeName(name));
 
     // name
-    QDomElement nameElement = doc.createElement("Name");
-    result->appendChild(nameElement);
-    nameElement.appendChild(doc.createTextNode(QString::fromStdString(name)));
+    xmlWriter.writeTextElement("Name", QString::fromStdString(name));
 
     boost::optional<double> thermalReflectance;
     boost::optional<double> solarReflectance;
@@ -416,135 +405,84 @@ namespace gbxml {
       resistance = gap.thermalResistance();
     }
 
+    // writes a Reflectance or Absorptance element, surfaceType is omitted if empty
+    auto writeOptical = [&xmlWriter](const QString& elementName, double value, const QString& type, const QString& surfaceType){
+      xmlWriter.writeStartElement(elementName);
+      xmlWriter.writeAttribute("unit", "Fraction");
+      xmlWriter.writeAttribute("type", type);
+      if (!surfaceType.isEmpty()){
+        xmlWriter.writeAttribute("surfaceType", surfaceType);
+      }
+      xmlWriter.writeCharacters(QString::number(value));
+      xmlWriter.writeEndElement();
+    };
+
+    // writes an element with a unit attribute and a numeric value
+    auto writeValue = [&xmlWriter](const QString& elementName, double value, const QString& unit){
+      xmlWriter.writeStartElement(elementName);
+      xmlWriter.writeAttribute("unit", unit);
+      xmlWriter.writeCharacters(QString::number(value));
+      xmlWriter.writeEndElement();
+    };
+
     if (thermalReflectance){
-      QDomElement element = doc.createElement("Reflectance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*thermalReflectance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "ExtIR");
-      element.setAttribute("surfaceType", "Both");
-
-      element = doc.createElement("Reflectance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*thermalReflectance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "IntIR");
-      element.setAttribute("surfaceType", "Both");
+      writeOptical("Reflectance", *thermalReflectance, "ExtIR", "Both");
+      writeOptical("Reflectance", *thermalReflectance, "IntIR", "Both");
     }
 
     if (solarReflectance){
-      QDomElement element = doc.createElement("Reflectance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*solarReflectance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "ExtSolar");
-      element.setAttribute("surfaceType", "Both");
-
-      element = doc.createElement("Reflectance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*solarReflectance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "IntSolar");
-      element.setAttribute("surfaceType", "Both");
+      writeOptical("Reflectance", *solarReflectance, "ExtSolar", "Both");
+      writeOptical("Reflectance", *solarReflectance, "IntSolar", "Both");
     }
 
     if (visibleReflectance){
-      QDomElement element = doc.createElement("Reflectance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*visibleReflectance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "ExtVisible");
-      element.setAttribute("surfaceType", "Both");
-
-      element = doc.createElement("Reflectance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*visibleReflectance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "IntVisible");
-      element.setAttribute("surfaceType", "Both");
+      writeOptical("Reflectance", *visibleReflectance, "ExtVisible", "Both");
+      writeOptical("Reflectance", *visibleReflectance, "IntVisible", "Both");
     }
 
     if (roughness){
-      QDomElement element = doc.createElement("Roughness");
-      result->appendChild(element);
-      element.setAttribute("value", QString::fromStdString(*roughness));
+      xmlWriter.writeEmptyElement("Roughness");
+      xmlWriter.writeAttribute("value", QString::fromStdString(*roughness));
     }
 
     if (thickness){
-      QDomElement element = doc.createElement("Thickness");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*thickness)));
-      element.setAttribute("unit", "Meters");
+      writeValue("Thickness", *thickness, "Meters");
     }
 
     if (conductivity){
-      QDomElement element = doc.createElement("Conductivity");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*conductivity)));
-      element.setAttribute("unit", "WPerMeterK");
+      writeValue("Conductivity", *conductivity, "WPerMeterK");
     }
 
     if (resistance){
-      QDomElement element = doc.createElement("R-value");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*resistance)));
-      element.setAttribute("unit", "SquareMeterKPerW");
+      writeValue("R-value", *resistance, "SquareMeterKPerW");
     }
 
     if (density){
-      QDomElement element = doc.createElement("Density");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*density)));
-      element.setAttribute("unit", "KgPerCubicM");
+      writeValue("Density", *density, "KgPerCubicM");
     }
 
     if (specificHeat){
-      QDomElement element = doc.createElement("SpecificHeat");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*specificHeat)));
-      element.setAttribute("unit", "JPerKgK");
+      writeValue("SpecificHeat", *specificHeat, "JPerKgK");
     }
 
     if (thermalAbsorptance){
-      QDomElement element = doc.createElement("Absorptance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*thermalAbsorptance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "ExtIR");
-
-      element = doc.createElement("Absorptance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*thermalAbsorptance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "IntIR");
+      writeOptical("Absorptance", *thermalAbsorptance, "ExtIR", QString());
+      writeOptical("Absorptance", *thermalAbsorptance, "IntIR", QString());
     }
 
     if (solarAbsorptance){
-      QDomElement element = doc.createElement("Absorptance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*solarAbsorptance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "ExtSolar");
-      element = doc.createElement("Absorptance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*solarAbsorptance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "IntSolar");
+      writeOptical("Absorptance", *solarAbsorptance, "ExtSolar", QString());
+      writeOptical("Absorptance", *solarAbsorptance, "IntSolar", QString());
     }
 
     if (visibleAbsorptance){
-      QDomElement element = doc.createElement("Absorptance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*visibleAbsorptance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "ExtVisible");
-      element = doc.createElement("Absorptance");
-      result->appendChild(element);
-      element.appendChild(doc.createTextNode(QString::number(*visibleAbsorptance)));
-      element.setAttribute("unit", "Fraction");
-      element.setAttribute("type", "IntVisible");
+      writeOptical("Absorptance", *visibleAbsorptance, "ExtVisible", QString());
+      writeOptical("Absorptance", *visibleAbsorptance, "IntVisible", QString());
     }
-    return result;
+
+    xmlWriter.writeEndElement(); // Material
+
+    return true;
   }
 
 } // gbxml
@@ -71,11 +71,58 @@
 
 #include <QDomDocument>
 #include <QDomElement>
+#include <QFile>
 #include <QThread>
+#include <QXmlStreamReader>
 
 namespace openstudio {
 namespace gbxml {
 
+  // Reads the element the reader is positioned on, and all of its descendants, into doc. Whitespace
+  // only text is dropped as QDomDocument::setContent does. Returns with the reader on the end tag.
+  static QDomElement readElement(QXmlStreamReader& reader, QDomDocument& doc)
+  {
+    OS_ASSERT(reader.isStartElement());
+
+    QDomElement result = doc.createElement(reader.qualifiedName().toString());
+    for (const QXmlStreamAttribute& attribute : reader.attributes()){
+      result.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+    }
+
+    QDomElement current = result;
+    while (!reader.atEnd()){
+      QXmlStreamReader::TokenType token = reader.readNext();
+      if (token == QXmlStreamReader::StartElement){
+        QDomElement child = doc.createElement(reader.qualifiedName().toString());
+        for (const QXmlStreamAttribute& attribute : reader.attributes()){
+          child.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+        }
+        current.appendChild(child);
+        current = child;
+      }else if (token == QXmlStreamReader::EndElement){
+        if (current == result){
+          break;
+        }
+        current = current.parentNode().toElement();
+      }else if (token == QXmlStreamReader::Characters){
+        if (!reader.isWhitespace()){
+          current.appendChild(doc.createTextNode(reader.text().toString()));
+        }
+      }
+    }
+
+    return result;
+  }
+
+  // Reads the element the reader is positioned on into a document of its own.
+  static QDomElement readElement(QXmlStreamReader& reader, std::shared_ptr<QDomDocument>& doc)
+  {
+    doc = std::make_shared<QDomDocument>();
+    QDomElement result = readElement(reader, *doc);
+    doc->appendChild(result);
+    return result;
+  }
+
   std::ostream& operator<<(std::ostream& os, const QDomElement& element)
   {
     QString str;
@@ -106,18 +153,19 @@ namespace gbxml {
     m_logSink.resetStringStream();
 
     m_idToObjectMap.clear();
+    m_layerElements.clear();
+    m_weekScheduleElements.clear();
+    m_dayScheduleElements.clear();
+    m_spaceStoryIdRefs.clear();
 
     boost::optional<openstudio::model::Model> result;
 
     if (openstudio::filesystem::exists(path)){
 
-      openstudio::filesystem::ifstream file(path, std::ios_base::binary);
-      if (file.is_open()) {
-        QDomDocument doc;
-        doc.setContent(openstudio::filesystem::read_as_QByteArray(file));
+      QFile file(toQString(path));
+      if (file.open(QFile::ReadOnly)) {
+        result = this->convert(file);
         file.close();
-
-        result = this->convert(doc);
       }
     }
 
@@ -161,16 +209,92 @@ namespace gbxml {
     return value.replace(',', '-').replace(';', '-').toStdString();
   }
 
-  boost::optional<model::Model> ReverseTranslator::convert(const QDomDocument& doc)
+  boost::optional<model::Model> ReverseTranslator::convert(QIODevice& device)
   {
-    return translateGBXML(doc.documentElement(), doc);
-  }
+    QDomDocument doc;
+    if (!readResources(device, doc)){
+      return boost::none;
+    }
 
-  boost::optional<model::Model> ReverseTranslator::translateGBXML(const QDomElement& element, const QDomDocument& doc)
-  {
     openstudio::model::Model model;
     model.setFastNaming(true);
 
+    translateGBXML(doc.documentElement(), doc, model);
+
+    if (!device.seek(0)){
+      LOG(Error, "Could not rewind gbXML input to translate Campus");
+      return boost::none;
+    }
+
+    QXmlStreamReader reader(&device);
+    int numCampuses = 0;
+    bool campusesTranslated = true;
+    if (reader.readNextStartElement()){
+      while (reader.readNextStartElement()){
+        if (reader.qualifiedName() == "Campus"){
+          boost::optional<model::ModelObject> facility = translateCampus(reader, model);
+          if (!facility){
+            campusesTranslated = false;
+            break;
+          }
+          ++numCampuses;
+        }else{
+          reader.skipCurrentElement();
+        }
+      }
+    }
+
+    if (reader.hasError()){
+      LOG(Error, "Could not parse gbXML: " << toString(reader.errorString()) << " at line " << reader.lineNumber());
+      return boost::none;
+    }
+    if (!campusesTranslated){
+      return boost::none;
+    }
+    if (numCampuses != 1){
+      LOG(Error, "Expected one Campus in gbXML, found " << numCampuses);
+      return boost::none;
+    }
+
+    model.setFastNaming(false);
+
+    return model;
+  }
+
+  bool ReverseTranslator::readResources(QIODevice& device, QDomDocument& doc)
+  {
+    QXmlStreamReader reader(&device);
+
+    if (!reader.readNextStartElement()){
+      LOG(Error, "Could not parse gbXML: " << toString(reader.errorString()));
+      return false;
+    }
+
+    // keep the root element and its attributes, skip the Campus which holds nearly all of the data
+    QDomElement root = doc.createElement(reader.qualifiedName().toString());
+    for (const QXmlStreamAttribute& attribute : reader.attributes()){
+      root.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+    }
+    doc.appendChild(root);
+
+    while (reader.readNextStartElement()){
+      if (reader.qualifiedName() == "Campus"){
+        reader.skipCurrentElement();
+      }else{
+        root.appendChild(readElement(reader, doc));
+      }
+    }
+
+    if (reader.hasError()){
+      LOG(Error, "Could not parse gbXML: " << toString(reader.errorString()) << " at line " << reader.lineNumber());
+      return false;
+    }
+
+    return true;
+  }
+
+  void ReverseTranslator::translateGBXML(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
+  {
     // gbXML attributes not mapped directly to IDF, but needed to map
 
     // {F, C, K, R}
@@ -236,6 +360,25 @@ namespace gbxml {
       m_useSIUnitsForResults = true;
     }
 
+    // index elements that are looked up by id
+    QDomNodeList layerElements = element.elementsByTagName("Layer");
+    for (int i = 0; i < layerElements.count(); i++){
+      QDomElement layerElement = layerElements.at(i).toElement();
+      m_layerElements.insert(std::make_pair(layerElement.attribute("id"), layerElement));
+    }
+
+    QDomNodeList weekScheduleElements = element.elementsByTagName("WeekSchedule");
+    for (int i = 0; i < weekScheduleElements.count(); i++){
+      QDomElement weekScheduleElement = weekScheduleElements.at(i).toElement();
+      m_weekScheduleElements.insert(std::make_pair(weekScheduleElement.attribute("id"), weekScheduleElement));
+    }
+
+    QDomNodeList dayScheduleElements = element.elementsByTagName("DaySchedule");
+    for (int i = 0; i < dayScheduleElements.count(); i++){
+      QDomElement dayScheduleElement = dayScheduleElements.at(i).toElement();
+      m_dayScheduleElements.insert(std::make_pair(dayScheduleElement.attribute("id"), dayScheduleElement));
+    }
+
     // do materials before constructions
     QDomNodeList materialElements = element.elementsByTagName("Material");
     if (m_progressBar){
@@ -256,7 +399,6 @@ namespace gbxml {
     }
 
     // do constructions before surfaces
-    QDomNodeList layerElements = element.elementsByTagName("Layer");
     QDomNodeList constructionElements = element.elementsByTagName("Construction");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Constructions"));
@@ -267,7 +409,7 @@ namespace gbxml {
 
     for (int i = 0; i < constructionElements.count(); i++){
       QDomElement constructionElement = constructionElements.at(i).toElement();
-      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, layerElements, doc, model);
+      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, doc, model);
       OS_ASSERT(construction); // Krishnan, what type of error handling do you want?
 
       if (m_progressBar){
@@ -332,94 +474,104 @@ namespace gbxml {
       }
     }
 
-    QDomNodeList campusElements = element.elementsByTagName("Campus");
-    OS_ASSERT(campusElements.count() == 1);
-    QDomElement campusElement = campusElements.at(0).toElement();
-    boost::optional<model::ModelObject> facility = translateCampus(campusElement, doc, model);
-    OS_ASSERT(facility); // Krishnan, what type of error handling do you want?
-
-    model.setFastNaming(false);
+  }
 
-    return model;
+  void ReverseTranslator::updateProgress(const QXmlStreamReader& reader)
+  {
+    if (m_progressBar){
+      m_progressBar->setValue(static_cast<int>(reader.characterOffset() / 1024));
+    }
   }
 
-  boost::optional<model::ModelObject> ReverseTranslator::translateCampus(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
+  boost::optional<model::ModelObject> ReverseTranslator::translateCampus(QXmlStreamReader& reader, openstudio::model::Model& model)
   {
     openstudio::model::Facility facility = model.getUniqueModelObject<openstudio::model::Facility>();
 
-    QDomNodeList buildingElements = element.elementsByTagName("Building");
-    OS_ASSERT(buildingElements.count() == 1);
-
-    boost::optional<model::ModelObject> building = translateBuilding(buildingElements.at(0).toElement(), doc, model);
-    OS_ASSERT(building);
-
-    QDomNodeList surfaceElements = element.elementsByTagName("Surface");
     if (m_progressBar){
-      m_progressBar->setWindowTitle(toString("Translating Surfaces"));
+      m_progressBar->setWindowTitle(toString("Translating Campus"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(surfaceElements.count());
-      m_progressBar->setValue(0);
+      m_progressBar->setMaximum(static_cast<int>(reader.device()->size() / 1024));
+      updateProgress(reader);
     }
 
-    for (int i = 0; i < surfaceElements.count(); ++i){
-
-      try {
-        boost::optional<model::ModelObject> surface = translateSurface(surfaceElements.at(i).toElement(), doc, model);
-      }catch(const std::exception&){
-        LOG(Error, "Could not translate surface " << surfaceElements.at(i).toElement());
-      }
+    int numBuildings = 0;
+    while (reader.readNextStartElement()){
+      if (reader.qualifiedName() == "Building"){
+        boost::optional<model::ModelObject> building = translateBuilding(reader, model);
+        OS_ASSERT(building);
+        ++numBuildings;
+      }else if (reader.qualifiedName() == "Surface"){
+        std::shared_ptr<QDomDocument> doc;
+        QDomElement surfaceElement = readElement(reader, doc);
+        try {
+          boost::optional<model::ModelObject> surface = translateSurface(surfaceElement, *doc, model);
+        }catch(const std::exception&){
+          LOG(Error, "Could not translate surface " << surfaceElement);
+        }
 
-      if (m_progressBar){
-        m_progressBar->setValue(m_progressBar->value() + 1);
+        updateProgress(reader);
+      }else{
+        reader.skipCurrentElement();
       }
     }
+    if (reader.hasError()){
+      return boost::none;
+    }
+    if (numBuildings != 1){
+      LOG(Error, "Expected one Building in Campus, found " << numBuildings);
+      return boost::none;
+    }
 
     return facility;
   }
 
-  boost::optional<model::ModelObject> ReverseTranslator::translateBuilding(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
+  boost::optional<model::ModelObject> ReverseTranslator::translateBuilding(QXmlStreamReader& reader, openstudio::model::Model& model)
   {
     openstudio::model::Building building = model.getUniqueModelObject<openstudio::model::Building>();
 
-    QString id = element.attribute("id");
+    QString id = reader.attributes().value("id").toString();
     m_idToObjectMap.insert(std::make_pair(id, building));
 
-    QString name = element.firstChildElement("Name").toElement().text();
-    building.setName(escapeName(id, name));
-
-    QDomNodeList storyElements = element.elementsByTagName("BuildingStorey");
-    if (m_progressBar){
-      m_progressBar->setWindowTitle(toString("Translating Building Stories"));
-      m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(storyElements.count());
-      m_progressBar->setValue(0);
-    }
-
-    for (int i = 0; i < storyElements.count(); ++i){
-      boost::optional<model::ModelObject> story = translateBuildingStory(storyElements.at(i).toElement(), doc, model);
-      OS_ASSERT(story);
-
-      if (m_progressBar){
-        m_progressBar->setValue(m_progressBar->value() + 1);
+    building.setName(escapeName(id, QString()));
+
+    bool hasName = false;
+    while (reader.readNextStartElement()){
+      if (!hasName && (reader.qualifiedName() == "Name")){
+        QString name = reader.readElementText(QXmlStreamReader::IncludeChildElements);
+        building.setName(escapeName(id, name));
+        hasName = true;
+      }else if (reader.qualifiedName() == "BuildingStorey"){
+        std::shared_ptr<QDomDocument> doc;
+        QDomElement storyElement = readElement(reader, doc);
+        boost::optional<model::ModelObject> story = translateBuildingStory(storyElement, *doc, model);
+        OS_ASSERT(story);
+
+        updateProgress(reader);
+      }else if (reader.qualifiedName() == "Space"){
+        std::shared_ptr<QDomDocument> doc;
+        QDomElement spaceElement = readElement(reader, doc);
+        boost::optional<model::ModelObject> space = translateSpace(spaceElement, *doc, model);
+        OS_ASSERT(space);
+
+        updateProgress(reader);
+      }else{
+        reader.skipCurrentElement();
       }
     }
 
-    QDomNodeList spaceElements = element.elementsByTagName("Space");
-    if (m_progressBar){
-      m_progressBar->setWindowTitle(toString("Translating Spaces"));
-      m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(spaceElements.count());
-      m_progressBar->setValue(0);
-    }
-
-    for (int i = 0; i < spaceElements.count(); ++i){
-      boost::optional<model::ModelObject> space = translateSpace(spaceElements.at(i).toElement(), doc, model);
-      OS_ASSERT(space);
-
-      if (m_progressBar){
-        m_progressBar->setValue(m_progressBar->value() + 1);
+    // stories may follow the spaces that reference them
+    for (const auto& spaceStoryIdRef : m_spaceStoryIdRefs){
+      auto spaceIt = m_idToObjectMap.find(spaceStoryIdRef.first);
+      auto storyIt = m_idToObjectMap.find(spaceStoryIdRef.second);
+      if ((spaceIt != m_idToObjectMap.end()) && (storyIt != m_idToObjectMap.end())){
+        boost::optional<model::Space> space = spaceIt->second.optionalCast<model::Space>();
+        boost::optional<model::BuildingStory> story = storyIt->second.optionalCast<model::BuildingStory>();
+        if (space && story){
+          space->setBuildingStory(*story);
+        }
       }
     }
+    m_spaceStoryIdRefs.clear();
 
     return building;
   }
@@ -482,6 +634,8 @@ namespace gbxml {
       if (story){
         space.setBuildingStory(*story);
       }
+    }else if (!storyId.isEmpty()){
+      m_spaceStoryIdRefs.push_back(std::make_pair(id, storyId));
     }
 
     // if space doesn't have story assigned should we warn the user?
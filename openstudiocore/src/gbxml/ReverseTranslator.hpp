@@ -43,7 +43,8 @@
 
 class QDomDocument;
 class QDomElement;
-class QDomNodeList;
+class QIODevice;
+class QXmlStreamReader;
 
 namespace openstudio {
 
@@ -88,13 +89,24 @@ namespace gbxml {
 
     std::map<QString, openstudio::model::ModelObject> m_idToObjectMap;
 
-    boost::optional<openstudio::model::Model> convert(const QDomDocument& doc);
-    boost::optional<openstudio::model::Model> translateGBXML(const QDomElement& element, const QDomDocument& doc);
-    boost::optional<openstudio::model::ModelObject> translateCampus(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateBuilding(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
+    // elements referenced by id from other resource elements
+    std::map<QString, QDomElement> m_layerElements;
+    std::map<QString, QDomElement> m_weekScheduleElements;
+    std::map<QString, QDomElement> m_dayScheduleElements;
+
+    // space id and story id for spaces that appear before their story
+    std::vector<std::pair<QString, QString> > m_spaceStoryIdRefs;
+
+    // the gbXML is read in two streaming passes, the first collects everything but the Campus
+    // into a small document, the second translates the Campus one element at a time
+    boost::optional<openstudio::model::Model> convert(QIODevice& device);
+    bool readResources(QIODevice& device, QDomDocument& doc);
+    void translateGBXML(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateCampus(QXmlStreamReader& reader, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateBuilding(QXmlStreamReader& reader, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuildingStory(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateThermalZone(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateConstruction(const QDomElement& element, const QDomNodeList& layerElements, const QDomDocument& doc, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateConstruction(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateWindowType(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateMaterial(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateScheduleDay(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
@@ -105,6 +117,8 @@ namespace gbxml {
     boost::optional<openstudio::model::ModelObject> translateSubSurface(const QDomElement& element, const QDomDocument& doc, openstudio::model::Surface& surface);
     boost::optional<openstudio::model::ModelObject> translateCADObjectId(const QDomElement& element, const QDomDocument& doc, openstudio::model::ModelObject& modelObject);
 
+    void updateProgress(const QXmlStreamReader& reader);
+
     StringStreamLogSink m_logSink;
 
     ProgressBar* m_progressBar;
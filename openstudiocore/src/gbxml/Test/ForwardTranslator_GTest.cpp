@@ -30,6 +30,8 @@
 #include <gtest/gtest.h>
 #include "gbXMLFixture.hpp"
 
+#include "DomForwardTranslator.hpp"
+
 #include "../ForwardTranslator.hpp"
 #include "../ReverseTranslator.hpp"
 #include "../../model/Surface.hpp"
@@ -49,14 +51,88 @@
 
 #include "../../model/Model.hpp"
 
+#include "../../utilities/core/FilesystemHelpers.hpp"
+
 #include <resources.hxx>
 
+#include <QDomDocument>
+#include <QDomElement>
+#include <QDomNamedNodeMap>
+
+#include <map>
 #include <sstream>
 
 using namespace openstudio::model;
 using namespace openstudio::gbxml;
 using namespace openstudio;
 
+// Serializes element with its attributes sorted by name so that documents differing only in attribute order
+// compare equal.  The CreatedBy date is dropped since it is the time of translation.
+static void canonicalXml(const QDomElement& element, std::ostream& os)
+{
+  std::map<std::string, std::string> attributes;
+  QDomNamedNodeMap attributeNodes = element.attributes();
+  for (int i = 0; i < attributeNodes.count(); ++i){
+    QDomAttr attribute = attributeNodes.item(i).toAttr();
+    attributes[toString(attribute.name())] = toString(attribute.value());
+  }
+  if (element.tagName() == "CreatedBy"){
+    attributes.erase("date");
+  }
+
+  os << "<" << toString(element.tagName());
+  for (const auto& attribute : attributes){
+    os << " " << attribute.first << "=\"" << attribute.second << "\"";
+  }
+  os << ">";
+
+  for (QDomNode child = element.firstChild(); !child.isNull(); child = child.nextSibling()){
+    if (child.isElement()){
+      canonicalXml(child.toElement(), os);
+    } else if (child.isText()){
+      os << toString(child.toText().data());
+    }
+  }
+
+  os << "</" << toString(element.tagName()) << ">\n";
+}
+
+static std::string canonicalXml(const openstudio::path& p)
+{
+  QDomDocument doc;
+  if (!doc.setContent(openstudio::filesystem::read_as_QByteArray(p))){
+    return std::string();
+  }
+
+  std::stringstream ss;
+  canonicalXml(doc.documentElement(), ss);
+  return ss.str();
+}
+
+// Checks that the streaming translator writes the same document as the DOM based translator it replaced
+static void expectSameAsDomOutput(const Model& model, const std::string& name)
+{
+  path p = openstudio::tempDir() / openstudio::toPath("ForwardTranslator_" + name + ".xml");
+  path domPath = openstudio::tempDir() / openstudio::toPath("ForwardTranslator_" + name + "_Dom.xml");
+
+  ForwardTranslator forwardTranslator;
+  ASSERT_TRUE(forwardTranslator.modelToGbXML(model, p));
+
+  DomForwardTranslator domForwardTranslator;
+  ASSERT_TRUE(domForwardTranslator.modelToGbXML(model, domPath));
+
+  EXPECT_EQ(domForwardTranslator.warnings().size(), forwardTranslator.warnings().size());
+  EXPECT_EQ(domForwardTranslator.errors().size(), forwardTranslator.errors().size());
+
+  std::string expected = canonicalXml(domPath);
+  std::string actual = canonicalXml(p);
+  ASSERT_FALSE(expected.empty());
+  EXPECT_EQ(expected, actual) << name;
+
+  openstudio::filesystem::remove(p);
+  openstudio::filesystem::remove(domPath);
+}
+
 TEST_F(gbXMLFixture, ForwardTranslator_exampleModel)
 {
   Model model = exampleModel();
@@ -193,3 +269,17 @@ TEST_F(gbXMLFixture, ForwardTranslator_ConstructionLayers) {
   EXPECT_TRUE(olayeredcons->layers()[2].optionalCast<MasslessOpaqueMaterial>());
   EXPECT_TRUE(olayeredcons->layers()[3].optionalCast<StandardOpaqueMaterial>());
 }
+
+TEST_F(gbXMLFixture, ForwardTranslator_SameAsDomOutput)
+{
+  expectSameAsDomOutput(exampleModel(), "exampleModel");
+
+  std::vector<std::string> files{"TestCube.xml", "ZNETH.xml", "seb.xml", "TwoStoryOffice_Trane.xml", "simpleBox_vasari.xml"};
+  for (const auto& file : files){
+    ReverseTranslator reverseTranslator;
+    boost::optional<Model> model = reverseTranslator.loadModel(resourcesPath() / openstudio::toPath("gbxml/" + file));
+    ASSERT_TRUE(model) << file;
+
+    expectSameAsDomOutput(*model, file);
+  }
+}
@@ -46,6 +46,9 @@
 #include "../../model/ThermalZone_Impl.hpp"
 #include "../../model/Space.hpp"
 #include "../../model/Space_Impl.hpp"
+#include "../../model/BuildingStory.hpp"
+#include "../../model/BuildingStory_Impl.hpp"
+#include "../../model/ConstructionBase.hpp"
 #include "../../model/Surface.hpp"
 #include "../../model/Surface_Impl.hpp"
 #include "../../model/SubSurface.hpp"
@@ -62,6 +65,7 @@
 #include <resources.hxx>
 
 #include <sstream>
+#include <fstream>
 
 using namespace openstudio::energyplus;
 using namespace openstudio::model;
@@ -523,3 +527,95 @@ TEST_F(gbXMLFixture, ReverseTranslator_TwoStoryOffice_Trane)
   bool test = forwardTranslator.modelToGbXML(*model, outputPath);
   EXPECT_TRUE(test);
 }
+
+TEST_F(gbXMLFixture, ReverseTranslator_ElementOrder)
+{
+  // campus first, spaces before their story, resources after the campus
+  openstudio::path inputPath = openstudio::tempDir() / openstudio::toPath("ReverseTranslator_ElementOrder.xml");
+  {
+    std::ofstream file(openstudio::toString(inputPath));
+    file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+         << "<gbXML xmlns=\"http://www.gbxml.org/schema\" temperatureUnit=\"C\" lengthUnit=\"Meters\" areaUnit=\"SquareMeters\" volumeUnit=\"CubicMeters\" useSIUnitsForResults=\"true\" version=\"0.37\">\n"
+         << "  <Campus id=\"campus-1\">\n"
+         << "    <Building id=\"building-1\" buildingType=\"Office\">\n"
+         << "      <Space id=\"space-1\" buildingStoreyIdRef=\"story-1\" zoneIdRef=\"zone-1\">\n"
+         << "        <Name>Space 1</Name>\n"
+         << "      </Space>\n"
+         << "      <BuildingStorey id=\"story-1\">\n"
+         << "        <Name>Story 1</Name>\n"
+         << "        <Level>0</Level>\n"
+         << "      </BuildingStorey>\n"
+         << "      <Name>Building 1</Name>\n"
+         << "    </Building>\n"
+         << "    <Surface id=\"surface-1\" surfaceType=\"ExteriorWall\" constructionIdRef=\"construction-1\">\n"
+         << "      <Name>Surface 1</Name>\n"
+         << "      <AdjacentSpaceId spaceIdRef=\"space-1\"/>\n"
+         << "      <PlanarGeometry>\n"
+         << "        <PolyLoop>\n"
+         << "          <CartesianPoint><Coordinate>0</Coordinate><Coordinate>0</Coordinate><Coordinate>3</Coordinate></CartesianPoint>\n"
+         << "          <CartesianPoint><Coordinate>0</Coordinate><Coordinate>0</Coordinate><Coordinate>0</Coordinate></CartesianPoint>\n"
+         << "          <CartesianPoint><Coordinate>10</Coordinate><Coordinate>0</Coordinate><Coordinate>0</Coordinate></CartesianPoint>\n"
+         << "          <CartesianPoint><Coordinate>10</Coordinate><Coordinate>0</Coordinate><Coordinate>3</Coordinate></CartesianPoint>\n"
+         << "        </PolyLoop>\n"
+         << "      </PlanarGeometry>\n"
+         << "    </Surface>\n"
+         << "  </Campus>\n"
+         << "  <Construction id=\"construction-1\">\n"
+         << "    <LayerId layerIdRef=\"layer-1\"/>\n"
+         << "    <Name>Construction 1</Name>\n"
+         << "  </Construction>\n"
+         << "  <Layer id=\"layer-1\">\n"
+         << "    <MaterialId materialIdRef=\"material-1\"/>\n"
+         << "  </Layer>\n"
+         << "  <Material id=\"material-1\">\n"
+         << "    <Name>Material 1</Name>\n"
+         << "    <R-value unit=\"SquareMeterKPerW\">2.0</R-value>\n"
+         << "  </Material>\n"
+         << "  <Zone id=\"zone-1\">\n"
+         << "    <Name>Zone 1</Name>\n"
+         << "  </Zone>\n"
+         << "</gbXML>\n";
+  }
+
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+  ASSERT_TRUE(model);
+
+  EXPECT_EQ("Building 1", model->getUniqueModelObject<Building>().nameString());
+
+  boost::optional<Space> space = model->getModelObjectByName<Space>("Space 1");
+  ASSERT_TRUE(space);
+  ASSERT_TRUE(space->buildingStory());
+  EXPECT_EQ("Story 1", space->buildingStory()->nameString());
+  ASSERT_TRUE(space->thermalZone());
+  EXPECT_EQ("Zone 1", space->thermalZone()->nameString());
+
+  boost::optional<Surface> surface = model->getModelObjectByName<Surface>("Surface 1");
+  ASSERT_TRUE(surface);
+  ASSERT_TRUE(surface->space());
+  EXPECT_EQ(space->handle(), surface->space()->handle());
+  ASSERT_TRUE(surface->construction());
+  EXPECT_EQ("Construction 1", surface->construction()->nameString());
+  EXPECT_EQ(4u, surface->vertices().size());
+
+  // malformed input is reported instead of partially translated
+  {
+    std::ofstream file(openstudio::toString(inputPath));
+    file << "<gbXML><Campus id=\"campus-1\"><Building id=\"building-1\"></Campus></gbXML>\n";
+  }
+  EXPECT_FALSE(reverseTranslator.loadModel(inputPath));
+  EXPECT_FALSE(reverseTranslator.errors().empty());
+
+  // so is a document without exactly one campus or one building
+  for (const std::string& body : {std::string(""),
+                                  std::string("<Campus id=\"campus-1\"></Campus>"),
+                                  std::string("<Campus id=\"campus-1\"><Building id=\"building-1\"/><Building id=\"building-2\"/></Campus>"),
+                                  std::string("<Campus id=\"campus-1\"><Building id=\"building-1\"/></Campus><Campus id=\"campus-2\"><Building id=\"building-2\"/></Campus>")}){
+    {
+      std::ofstream file(openstudio::toString(inputPath));
+      file << "<gbXML>" << body << "</gbXML>\n";
+    }
+    EXPECT_FALSE(reverseTranslator.loadModel(inputPath)) << body;
+    EXPECT_FALSE(reverseTranslator.errors().empty()) << body;
+  }
+}
@@ -30,77 +30,51 @@
 #include "EpwData.hpp"
 #include "SolarRadiation.hpp"
 
+#include "../utilities/filetypes/EpwFile.hpp"
+
+#include <algorithm>
+
 namespace openstudio {
 namespace isomodel {
 
 EpwData::EpwData(const openstudio::path &t_path)
   : m_data(7, std::vector<double>(8760))
 {
-  loadData(t_path);
+  boost::optional<EpwFile> epwFile = EpwFile::load(t_path, true);
+  if (!epwFile) {
+    throw std::runtime_error("Unable to open weather file: " + openstudio::toString(t_path));
+  }
+  loadData(*epwFile);
 }
 
-void EpwData::parseHeader(const std::string &line)
+EpwData::EpwData(EpwFile &t_epwFile)
+  : m_data(7, std::vector<double>(8760))
 {
-  std::stringstream linestream(line);
-
-  //cout << "Weather Location Header: "<<endl;
-  for(int i = 0;i<10;i++)
-  {
-    std::string s;
-    std::getline(linestream, s, ',');
-    switch(i)
-    {
-      case 1:
-        m_location = s;
-        //cout << "\tLocation: " << s <<endl;
-        break;
-      case 5:
-        m_stationid = s;
-        //cout << "\tStation ID: " << s <<endl;
-        break;
-      case 6:
-        m_latitude = atof(s.c_str());
-        //cout << "\tLatitude: " << s <<endl;
-        break;
-      case 7:
-        m_longitude = atof(s.c_str());
-        //cout << "\tLongitude: " << s <<endl;
-        break;
-      case 8:
-        m_timezone = atoi(s.c_str());
-        //cout << "\tTimezone: " << s <<endl;
-        break;
-      default:
-        break;
-    }
-  }
+  loadData(t_epwFile);
 }
 
-void EpwData::parseData(const std::string &line, size_t row)
+void EpwData::loadData(EpwFile &t_epwFile)
 {
-  std::stringstream linestream(line);
-  size_t col = 0;
+  m_location = t_epwFile.city();
+  m_stationid = t_epwFile.wmoNumber();
+  // the time zone has always been truncated to whole hours here
+  m_timezone = static_cast<int>(t_epwFile.timeZone());
+  m_latitude = t_epwFile.latitude();
+  m_longitude = t_epwFile.longitude();
 
-  for(size_t i = 0;i<22;i++)
+  // missing values are kept as the epw missing value markers, as they were when the file was read directly
+  std::vector<EpwDataPoint> points = t_epwFile.data();
+  size_t numRows = std::min(points.size(), m_data[DBT].size());
+  for (size_t row = 0; row < numRows; ++row)
   {
-    std::string s;
-    std::getline(linestream, s, ',');
-    switch(i)
-    {
-      case 6:
-      case 7:
-      case 8:
-      case 13:
-      case 14:
-      case 15:
-      case 21:
-        assert(col < m_data.size());
-        assert(row < m_data[col].size());
-        m_data[col++][row] = ::atof(s.c_str());
-        break;
-      default:
-        break;
-    }
+    const EpwDataPoint &point = points[row];
+    m_data[DBT][row] = point.dryBulbTemperature().get_value_or(99.9);
+    m_data[DPT][row] = point.dewPointTemperature().get_value_or(99.9);
+    m_data[RH][row] = point.relativeHumidity().get_value_or(999);
+    m_data[EGH][row] = point.globalHorizontalRadiation().get_value_or(9999);
+    m_data[EB][row] = point.directNormalRadiation().get_value_or(9999);
+    m_data[ED][row] = point.diffuseHorizontalRadiation().get_value_or(9999);
+    m_data[WSPD][row] = point.windSpeed().get_value_or(999);
   }
 }
 
@@ -189,33 +163,5 @@ std::string EpwData::toISOData() const {
   }
   return sstream.str();
 }
-
-void EpwData::loadData(const openstudio::path &fn)
-{
-  // Array was fully initialized in constructor
-  std::ifstream myfile(openstudio::toSystemFilename(fn));
-  if (myfile.is_open())
-  {
-    size_t i = 0;
-    size_t row = 0;
-    while ( myfile.good() && row < 8760)
-    {
-      i++;
-      std::string line;
-      getline(myfile,line);
-      if(i==1)
-      {
-        parseHeader(line);
-      }
-      else if(i > 8)
-      {
-        parseData(line,row++);
-      }
-    }
-    myfile.close();
-  } else {
-    throw std::runtime_error("Unable to open weather file: " + openstudio::toString(fn));
-  }
-}
 }
 }
@@ -41,6 +41,9 @@
 #include "../utilities/data/Vector.hpp"
 
 namespace openstudio {
+
+class EpwFile;
+
 namespace isomodel {
 
 const int DBT = 0;
@@ -55,8 +58,12 @@ const int WSPD = 6;
 class EpwData
 {
   public:
+    /// Loads the epw file at t_path, throws if it cannot be read
     EpwData(const openstudio::path &t_path);
 
+    /// Takes the columns used by the ISO model from the first 8760 records of an EpwFile
+    explicit EpwData(EpwFile &t_epwFile);
+
     std::string location() const {return m_location;}
     std::string stationid() const {return m_stationid;}
     int timezone() const {return m_timezone;}
@@ -68,9 +75,7 @@ class EpwData
     void toISOData(Matrix &_msolar, Matrix &_mhdbt, Matrix &_mhEgh, Vector &_mEgh, Vector &_mdbt, Vector &_mwind) const;
 
   protected:
-    void loadData(const openstudio::path &t_path);
-    void parseHeader(const std::string &line);
-    void parseData(const std::string &line, size_t row);
+    void loadData(EpwFile &t_epwFile);
     std::string m_location,m_stationid;
     int m_timezone;
     double m_latitude,m_longitude;
@@ -17,6 +17,7 @@
   #include <isomodel/ForwardTranslator.hpp>
   #include <isomodel/UserModel.hpp>
   #include <isomodel/SimModel.hpp>
+  #include <isomodel/SimModelBatch.hpp>
 
   using namespace openstudio::isomodel;
   using namespace openstudio;
@@ -166,6 +167,9 @@
 %rename("weatherFilePath=") openstudio::isomodel::UserModel::setWeatherFilePath(std::string value);
 
 %include <isomodel/SimModel.hpp>
+%template(SimModelVector) std::vector<openstudio::isomodel::SimModel>;
+%template(ISOResultsVector) std::vector<openstudio::isomodel::ISOResults>;
+%include <isomodel/SimModelBatch.hpp>
 %include <isomodel/UserModel.hpp>
 %include <isomodel/ForwardTranslator.hpp>
 #endif //ISOMODEL_I
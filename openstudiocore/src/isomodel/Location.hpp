@@ -40,12 +40,12 @@ namespace isomodel {
   public:
     double terrain() const {return _terrain;}
     void setTerrain(double value) {_terrain = value;}
-    std::shared_ptr<WeatherData> weather() const {return _weather; }
-    void setWeatherData(std::shared_ptr<WeatherData> value){ _weather = value;}
+    std::shared_ptr<const WeatherData> weather() const {return _weather; }
+    void setWeatherData(std::shared_ptr<const WeatherData> value){ _weather = value;}
 
   private:
     double _terrain;
-    std::shared_ptr<WeatherData> _weather;
+    std::shared_ptr<const WeatherData> _weather;
   };
 
 } // isomodel
@@ -99,6 +99,8 @@ namespace isomodel {
     REGISTER_LOGGER("openstudio.isomodel.SimModel");
 
   private:
+    friend class SimModelBatch;
+
     std::shared_ptr<Population> pop;
     std::shared_ptr<Location> location;
     std::shared_ptr<Lighting> lights;
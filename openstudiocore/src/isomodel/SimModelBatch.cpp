@@ -0,0 +1,929 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SimModelBatch.hpp"
+#include "UserModel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace openstudio {
+namespace isomodel {
+
+namespace {
+
+  /// Input columns, directional inputs take numDirections consecutive columns in the order
+  /// [S, SE, E, NE, N, NW, W, SW, roof/skylight] used by UserModel::toSimModel
+  enum Input {
+    HoursStart,
+    HoursEnd,
+    DaysStart,
+    DaysEnd,
+    DensityOccupied,
+    DensityUnoccupied,
+    HeatGainPerPerson,
+    Terrain,
+    LightingPowerDensityOccupied,
+    LightingPowerDensityUnoccupied,
+    DimmingFraction,
+    ExteriorLightingEnergy,
+    LightingOccupancySensor,
+    ConstantIllumination,
+    ElectricApplianceHeatGainOccupied,
+    ElectricApplianceHeatGainUnoccupied,
+    GasApplianceHeatGainOccupied,
+    GasApplianceHeatGainUnoccupied,
+    BuildingEnergyManagement,
+    FloorArea,
+    WindowShadingDevice,
+    InteriorHeatCapacity,
+    WallHeatCapacity,
+    BuildingHeight,
+    InfiltrationRate,
+    HeatingSetpointOccupied,
+    HeatingSetpointUnoccupied,
+    HeatingLossFactor,
+    HotColdWasteFactor,
+    HeatingEfficiency,
+    HeatingEnergyType,
+    HeatingPumpControl,
+    HotWaterDemand,
+    HotWaterDistributionEfficiency,
+    HotWaterSystemEfficiency,
+    HotWaterEnergyType,
+    CoolingSetpointOccupied,
+    CoolingSetpointUnoccupied,
+    CoolingCOP,
+    CoolingPartialLoadValue,
+    CoolingLossFactor,
+    CoolingPumpControl,
+    VentilationSupplyRate,
+    VentilationSupplyDifference,
+    HeatRecoveryEfficiency,
+    ExhaustAirRecirculated,
+    VentilationType,
+    FanPower,
+    FanControlFactor,
+    WallArea,
+    WindowArea = WallArea + 9,
+    WallU = WindowArea + 9,
+    WindowU = WallU + 9,
+    WallEmissivity = WindowU + 9,
+    WallAbsorption = WallEmissivity + 9,
+    WindowSHGC = WallAbsorption + 9,
+    WindowSCF = WindowSHGC + 9,
+    NumInputs = WindowSCF + 9
+  };
+
+  const size_t numMonths = 12;
+  const size_t numDirections = 9;
+
+  /// Variants evaluated together, sized so a Block stays in cache
+  const size_t blockSize = 32;
+
+  // these must match the constants in SimModel.cpp
+  const double daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  const double hoursInMonth[] = {744, 672, 744, 720, 744, 720, 744, 744, 720, 744, 720, 744};
+  const double megasecondsInMonth[] = {2.6784, 2.4192, 2.6784, 2.592, 2.6784, 2.592, 2.6784, 2.6784, 2.592, 2.6784, 2.592, 2.6784};
+  const double monthFractionOfYear[] = {0.0849315068493151, 0.0767123287671233, 0.0849315068493151, 0.0821917808219178, 0.0849315068493151, 0.0821917808219178, 0.0849315068493151, 0.0849315068493151, 0.0821917808219178, 0.0849315068493151, 0.0821917808219178, 0.0849315068493151};
+  const double daysInYear = 365;
+  const double hoursInYear = 8760;
+  const double hoursInWeek = 168;
+  const double kWh2MJ = 3.6f;
+
+  /// div() from SimModel.cpp, dividing by zero gives the largest double, written without a branch so loops vectorize
+  inline double divide(double numerator, double denominator)
+  {
+    double result = numerator / denominator;
+    return denominator == 0 ? std::numeric_limits<double>::max() : result;
+  }
+
+  /// Weather derived values shared by every variant in a block
+  struct BlockWeather
+  {
+    double mdbt[numMonths];
+    double mwind[numMonths];
+    double hrs_sun_down_mo[numMonths];
+    double I_sol[numMonths][numDirections];  // msolar with mEgh as the roof column
+  };
+
+  /// Working set for a block of variants, the last index of every array is the variant within the block
+  struct Block
+  {
+    double in[NumInputs][blockSize];
+
+    // per variant
+    double frac_hrs_wk_day[blockSize];
+    double frac_hrs_wk_nt[blockSize];
+    double frac_hrs_wke_tot[blockSize];
+    double hoursOccupiedPerDay[blockSize];
+    double hoursUnoccupiedPerDay[blockSize];
+    double Q_illum_tot_yr[blockSize];
+    double sum_wall_A[blockSize];
+    double sum_win_A[blockSize];
+    double H_tr[blockSize];
+    double phi_I_tot[blockSize];
+    double tau[blockSize];
+    double Th_avg[blockSize];
+    double Tc_avg[blockSize];
+    double Qneed_ht_yr[blockSize];
+    double Qneed_cl_yr[blockSize];
+    double scratch[6][blockSize];
+
+    // per direction and variant
+    double win_A_sol[numDirections][blockSize];
+    double wall_A_sol[numDirections][blockSize];
+    double wall_phi_r[numDirections][blockSize];
+
+    // per month and variant
+    double Q_illum_tot[numMonths][blockSize];
+    double Q_illum_ext_tot[numMonths][blockSize];
+    double E_sol[numMonths][blockSize];
+    double Hve_ht[numMonths][blockSize];
+    double Hve_cl[numMonths][blockSize];
+    double Qfan_tot[numMonths][blockSize];
+    double Qneed_ht[numMonths][blockSize];
+    double Qneed_cl[numMonths][blockSize];
+    double Qelec_ht[numMonths][blockSize];
+    double Qgas_ht[numMonths][blockSize];
+    double Qcl_elec_tot[numMonths][blockSize];
+    double Qcl_gas_tot[numMonths][blockSize];
+    double Q_pump_tot[numMonths][blockSize];
+    double Q_dhw_elec[numMonths][blockSize];
+    double Q_dhw_gas[numMonths][blockSize];
+  };
+
+  // Each step below evaluates the matching SimModel member for n variants, keeping the order of every
+  // floating point operation so results match exactly.  Values that SimModel computes but that never
+  // reach its results are skipped, see interiorTemp.
+
+  void loadWeather(const WeatherData& weather, BlockWeather& w)
+  {
+    const Matrix& mhEgh = weather.mhEgh();
+    for (size_t m = 0; m < numMonths; ++m){
+      w.mdbt[m] = weather.mdbt()[m];
+      w.mwind[m] = weather.mwind()[m];
+
+      // solarRadiationBreakdown
+      double sun_up = 0;
+      double sun_down = 0;
+      for (int j = 0; j < 24; ++j){
+        if (mhEgh(m, j) != 0){
+          sun_up = j;
+          break;
+        }
+      }
+      for (int j = 23; j >= 0; --j){
+        if (mhEgh(m, j) != 0){
+          sun_down = j;
+          break;
+        }
+      }
+      double frac_hrs_sun_up = (sun_down - sun_up + 1) / 24.0;
+      double frac_hrs_sun_down = 1.0 - frac_hrs_sun_up;
+      w.hrs_sun_down_mo[m] = frac_hrs_sun_down * hoursInMonth[m];
+
+      // solarHeatGain
+      for (size_t j = 0; j < numDirections - 1; ++j){
+        w.I_sol[m][j] = weather.msolar()(m, j);
+      }
+      w.I_sol[m][numDirections - 1] = weather.mEgh()[m];
+    }
+  }
+
+  void scheduleAndOccupancy(Block& b, size_t n)
+  {
+    for (size_t v = 0; v < n; ++v){
+      double hoursOccupiedPerDay = b.in[HoursEnd][v] - b.in[HoursStart][v];
+      if (hoursOccupiedPerDay < 0){
+        hoursOccupiedPerDay += 24;
+      }
+      double daysOccupiedPerWeek = b.in[DaysEnd][v] - b.in[DaysStart][v] + 1;
+      if (daysOccupiedPerWeek < 0){
+        daysOccupiedPerWeek += 7;
+      }
+      double hoursOccupiedDuringWeek = hoursOccupiedPerDay * daysOccupiedPerWeek;
+      double hoursUnoccupiedPerDay = 24 - hoursOccupiedPerDay;
+      double hoursUnoccupiedDuringWeek = (daysOccupiedPerWeek - 1) * hoursUnoccupiedPerDay;
+      double totalWeekendHours = hoursInWeek - hoursOccupiedDuringWeek - hoursUnoccupiedDuringWeek;
+
+      b.hoursOccupiedPerDay[v] = hoursOccupiedPerDay;
+      b.hoursUnoccupiedPerDay[v] = hoursUnoccupiedPerDay;
+      b.frac_hrs_wk_day[v] = hoursOccupiedDuringWeek / hoursInWeek;
+      b.frac_hrs_wk_nt[v] = hoursUnoccupiedDuringWeek / hoursInWeek;
+      b.frac_hrs_wke_tot[v] = totalWeekendHours / hoursInWeek;
+    }
+  }
+
+  void lightingEnergyUse(Block& b, const BlockWeather& w, size_t n)
+  {
+    const double n_day_start = 7;
+    const double n_day_end = 19;
+    const double n_weeks = 50;
+    for (size_t v = 0; v < n; ++v){
+      double hoursStart = b.in[HoursStart][v];
+      double hoursEnd = b.in[HoursEnd][v];
+      double days = b.in[DaysEnd][v] + 1 - b.in[DaysStart][v] + 1;
+      double t_lt_D = (std::min(n_day_end, hoursEnd) - std::max(hoursStart, n_day_start)) * days * n_weeks;
+      double t_lt_N = (std::max(n_day_start - hoursStart, 0.0) + std::max(hoursEnd - n_day_end, 0.0)) * days * n_weeks;
+      double Q_illum_occ = b.in[FloorArea][v] * b.in[LightingPowerDensityOccupied][v] * b.in[ConstantIllumination][v] *
+                           b.in[LightingOccupancySensor][v] * (t_lt_D * b.in[DimmingFraction][v] + t_lt_N) / 1000.0;
+      double t_unocc = hoursInYear - t_lt_D - t_lt_N;
+      double Q_illum_unocc = b.in[FloorArea][v] * b.in[LightingPowerDensityUnoccupied][v] * t_unocc / 1000.0;
+      b.Q_illum_tot_yr[v] = Q_illum_occ + Q_illum_unocc;
+    }
+    for (size_t m = 0; m < numMonths; ++m){
+      for (size_t v = 0; v < n; ++v){
+        b.Q_illum_tot[m][v] = monthFractionOfYear[m] * b.Q_illum_tot_yr[v];
+        b.Q_illum_ext_tot[m][v] = w.hrs_sun_down_mo[m] * (b.in[ExteriorLightingEnergy][v] / 1000.0);
+      }
+    }
+  }
+
+  /// envelopCalculations and windowSolarGain
+  void envelope(Block& b, size_t n)
+  {
+    const double n_win_SDF_table[] = {0.5, 0.35, 1.0};
+    const double win_ff = 1.0 - 0.25;
+    const double n_win_F_W = 0.9;
+    const double n_R_sc_ext = 0.04;
+    const double theta_er = 11.0;
+
+    double* H_D = b.H_tr;
+    std::fill(H_D, H_D + n, 0.0);
+    std::fill(b.sum_wall_A, b.sum_wall_A + n, 0.0);
+    std::fill(b.sum_win_A, b.sum_win_A + n, 0.0);
+    for (size_t j = 0; j < numDirections; ++j){
+      const double* wall_A = b.in[WallArea + j];
+      const double* win_A = b.in[WindowArea + j];
+      const double* wall_U = b.in[WallU + j];
+      const double* win_U = b.in[WindowU + j];
+      for (size_t v = 0; v < n; ++v){
+        H_D[v] += wall_A[v] * wall_U[v] + win_A[v] * win_U[v];
+        b.sum_wall_A[v] += wall_A[v];
+        b.sum_win_A[v] += win_A[v];
+      }
+    }
+    const double H_g = 0;
+    const double H_U = 0;
+    const double H_A = 0;
+    for (size_t v = 0; v < n; ++v){
+      b.H_tr[v] = H_D[v] + H_g + H_U + H_A;
+    }
+
+    for (size_t v = 0; v < n; ++v){
+      int n_win_SDF_table_index = std::min(2, std::max(static_cast<int>(b.in[WindowShadingDevice][v]) - 1, 0));
+      b.scratch[0][v] = n_win_SDF_table[n_win_SDF_table_index];
+    }
+    const double* win_F_shgl = b.scratch[0];
+    for (size_t j = 0; j < numDirections; ++j){
+      const double* win_A = b.in[WindowArea + j];
+      const double* g_gln = b.in[WindowSHGC + j];
+      const double* wall_A = b.in[WallArea + j];
+      const double* wall_U = b.in[WallU + j];
+      const double* wall_alpha_sc = b.in[WallAbsorption + j];
+      const double* wall_emiss = b.in[WallEmissivity + j];
+      for (size_t v = 0; v < n; ++v){
+        b.win_A_sol[j][v] = win_F_shgl[v] * (g_gln[v] * n_win_F_W) * win_ff * win_A[v];
+        b.wall_A_sol[j][v] = wall_alpha_sc[v] * n_R_sc_ext * wall_U[v] * wall_A[v];
+        double win_hr = wall_emiss[v] * 5.0;
+        b.wall_phi_r[j][v] = n_R_sc_ext * wall_U[v] * wall_A[v] * win_hr * theta_er;
+      }
+    }
+  }
+
+  void solarHeatGain(Block& b, const BlockWeather& w, size_t n)
+  {
+    const double n_v_env_form_factors[] = {0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 1};
+    double* win_phi_sol = b.scratch[0];
+    double* wall_phi_sol = b.scratch[1];
+    for (size_t m = 0; m < numMonths; ++m){
+      std::fill(win_phi_sol, win_phi_sol + n, 0.0);
+      std::fill(wall_phi_sol, wall_phi_sol + n, 0.0);
+      for (size_t j = 0; j < numDirections; ++j){
+        const double I_sol = w.I_sol[m][j];
+        const double* win_SCF = b.in[WindowSCF + j];
+        for (size_t v = 0; v < n; ++v){
+          win_phi_sol[v] += win_SCF[v] * b.win_A_sol[j][v] * I_sol;
+          wall_phi_sol[v] += b.wall_A_sol[j][v] * I_sol - b.wall_phi_r[j][v] * n_v_env_form_factors[j];
+        }
+      }
+      for (size_t v = 0; v < n; ++v){
+        b.E_sol[m][v] = (win_phi_sol[v] + wall_phi_sol[v]) * megasecondsInMonth[m];
+      }
+    }
+  }
+
+  /// heatGainsAndLosses and internalHeatGain
+  void internalHeatGain(Block& b, size_t n)
+  {
+    for (size_t v = 0; v < n; ++v){
+      double frac_hrs_wk_day = b.frac_hrs_wk_day[v];
+      double floorArea = b.in[FloorArea][v];
+      double phi_int_occ = b.in[HeatGainPerPerson][v] / b.in[DensityOccupied][v];
+      double phi_int_unocc = b.in[HeatGainPerPerson][v] / b.in[DensityUnoccupied][v];
+      double phi_int_avg = frac_hrs_wk_day * phi_int_occ + (1 - frac_hrs_wk_day) * phi_int_unocc;
+      double phi_plug_occ = b.in[ElectricApplianceHeatGainOccupied][v] + b.in[GasApplianceHeatGainOccupied][v];
+      double phi_plug_unocc = b.in[ElectricApplianceHeatGainUnoccupied][v] + b.in[GasApplianceHeatGainUnoccupied][v];
+      double phi_plug_avg = phi_plug_occ * frac_hrs_wk_day + phi_plug_unocc * (1 - frac_hrs_wk_day);
+      double phi_illum_avg = b.Q_illum_tot_yr[v] / floorArea / hoursInYear * 1000;
+      b.phi_I_tot[v] = phi_int_avg * floorArea + phi_plug_avg * floorArea + phi_illum_avg * floorArea;
+    }
+  }
+
+  /// SimModel::interiorTemp never fills M_dT or M_Te, so the unoccupied heat gains and night time dry bulb
+  /// temperatures it is passed do not reach the results and every month has the same average temperatures.
+  void interiorTemp(Block& b, size_t n)
+  {
+    const double Te = 0;
+    const double dT = 0;
+    for (size_t v = 0; v < n; ++v){
+      double T_adj = 0;
+      switch (static_cast<int>(b.in[BuildingEnergyManagement][v])){
+        case 1:
+          T_adj = 0.0;
+          break;
+        case 2:
+          T_adj = 0.5;
+          break;
+        case 3:
+          T_adj = 1.0;
+          break;
+      }
+      double ht_tset_ctrl = b.in[HeatingSetpointOccupied][v] - T_adj;
+      double cl_tset_ctrl = b.in[CoolingSetpointOccupied][v] + T_adj;
+      double ht_tset_unocc = b.in[HeatingSetpointUnoccupied][v];
+      double cl_tset_unocc = b.in[CoolingSetpointUnoccupied][v];
+
+      double Cm_int = b.in[InteriorHeatCapacity][v] * b.in[FloorArea][v];
+      double Cm_env = b.in[WallHeatCapacity][v] * b.sum_wall_A[v];
+      double Cm = Cm_int + Cm_env;
+      double H_ve = 0.0;
+      double H_tot = b.H_tr[v] + H_ve;
+      double tau = Cm / H_tot / 3600.0;
+      b.tau[v] = tau;
+
+      const double v_ti[] = {b.hoursUnoccupiedPerDay[v], b.hoursOccupiedPerDay[v], b.hoursUnoccupiedPerDay[v],
+                             b.hoursOccupiedPerDay[v], b.hoursUnoccupiedPerDay[v]};
+      double decay_unocc = exp(-1 * v_ti[0] / tau);
+      double decay_occ = exp(-1 * v_ti[1] / tau);
+      const double decay[] = {decay_unocc, decay_occ, decay_unocc, decay_occ, decay_unocc};
+
+      // heating
+      double M_Taa[5] = {0, 0, 0, 0, 0};
+      double Tstart = ht_tset_ctrl;
+      for (size_t i = 0; i < 4; ++i){
+        Tstart = (Tstart - Te - dT) * decay[i] + Te + dT;
+        M_Taa[i + 1] = std::max(Tstart, ht_tset_unocc);
+      }
+      double Th_wk_nt = 0;
+      double sum = 0;
+      for (size_t i = 0; i < 5; ++i){
+        double T_avg = tau / v_ti[i] * (M_Taa[i] - Te - dT) * (1 - decay[i]) + Te + dT;
+        double M_Tb = std::max(T_avg, ht_tset_unocc);
+        sum += M_Tb;
+        if (i == 1){
+          Th_wk_nt = M_Tb;
+        }
+      }
+      double Th_wke_avg = sum / 5;
+
+      // cooling
+      double M_Tcc[5] = {0, 0, 0, 0, 0};
+      Tstart = cl_tset_ctrl;
+      for (size_t i = 0; i < 4; ++i){
+        Tstart = (Tstart - Te - dT) * decay[i] + Te + dT;
+        M_Tcc[i + 1] = std::max(Tstart, cl_tset_unocc);
+      }
+      double Tc_wk_nt = 0;
+      sum = 0;
+      for (size_t i = 0; i < 5; ++i){
+        double T_avg = tau / v_ti[i] * (M_Tcc[i] - Te - dT) * (1 - decay[i]) + Te + dT;
+        double M_Td = std::max(T_avg, cl_tset_unocc);
+        sum += M_Td;
+        if (i == 1){
+          Tc_wk_nt = M_Td;
+        }
+      }
+      double Tc_wke_avg = sum / 5;
+
+      double Th_wk_avg = ht_tset_ctrl * b.frac_hrs_wk_day[v] + Th_wk_nt * b.frac_hrs_wk_nt[v] + Th_wke_avg * b.frac_hrs_wke_tot[v];
+      double Tc_wk_avg = cl_tset_ctrl * b.frac_hrs_wk_day[v] + Tc_wk_nt * b.frac_hrs_wk_nt[v] + Tc_wke_avg * b.frac_hrs_wke_tot[v];
+      b.Th_avg[v] = std::min(Th_wk_avg, ht_tset_ctrl);
+      b.Tc_avg[v] = std::min(Tc_wk_avg, cl_tset_ctrl);
+    }
+  }
+
+  void ventilationCalc(Block& b, const BlockWeather& w, size_t n)
+  {
+    const double n_p_exp = 0.65;
+    const double Q4pa_factor = std::pow((4.0 / 75.0), n_p_exp);
+    const double n_zone_frac = 0.7;
+    const double n_stack_exp = 0.667;
+    const double n_stack_coeff = 0.0146;
+    const double n_wind_exp = 0.667;
+    const double n_wind_coeff = 0.0769;
+    const double n_dCp = 0.75;
+    const double n_sw_coeff = 0.14;
+    const double n_rhoc_air = 1200;
+
+    double* h_stack = b.scratch[0];
+    double* v_Q4pa = b.scratch[1];
+    double* stack_coeff = b.scratch[2];
+    double* wind_base = b.scratch[3];
+    double* qv_inf_min = b.scratch[4];
+    double* qv_mve = b.scratch[5];
+    for (size_t v = 0; v < n; ++v){
+      double floorArea = b.in[FloorArea][v];
+      double vent_zone_height = std::max(0.1, b.in[BuildingHeight][v]);
+      double qv_supp = b.in[VentilationSupplyRate][v] / floorArea / 3.6;
+      double qv_ext = -(qv_supp - b.in[VentilationSupplyDifference][v] / floorArea / 3.6);
+      double qv_comb = 0;
+      double qv_diff = qv_supp + qv_ext + qv_comb;
+      double vent_ht_recov = b.in[HeatRecoveryEfficiency][v];
+      double vent_outdoor_frac = 1 - b.in[ExhaustAirRecirculated][v];
+      double tot_env_A = b.sum_wall_A[v] + b.sum_win_A[v];
+
+      double Q75pa = b.in[InfiltrationRate][v];
+      if (Q75pa == 0) Q75pa = 0.00000000001;
+      v_Q4pa[v] = Q75pa * tot_env_A / floorArea * Q4pa_factor;
+
+      h_stack[v] = n_zone_frac * vent_zone_height;
+      stack_coeff[v] = n_stack_coeff * v_Q4pa[v];
+      wind_base[v] = n_dCp * b.in[Terrain][v];
+      qv_inf_min[v] = std::max(0.0, -qv_diff);
+
+      // vent_rate_flag is 1 in SimModel::ventilationCalc
+      double vent_op_frac = b.frac_hrs_wk_day[v];
+      qv_mve[v] = b.in[VentilationType][v] == 3 ? 0 : (vent_op_frac * qv_supp * vent_outdoor_frac * (1 - vent_ht_recov));
+    }
+
+    for (size_t m = 0; m < numMonths; ++m){
+      const double mdbt = w.mdbt[m];
+      const double mwind2 = w.mwind[m] * w.mwind[m];
+      for (size_t v = 0; v < n; ++v){
+        double qv_stack_ht = std::max(std::pow(::fabs(mdbt - b.Th_avg[v]) * h_stack[v], n_stack_exp) * stack_coeff[v], 0.001);
+        double qv_stack_cl = std::max(std::pow(::fabs(mdbt - b.Tc_avg[v]) * h_stack[v], n_stack_exp) * stack_coeff[v], 0.001);
+        double qv_wind = std::pow(mwind2 * wind_base[v], n_wind_exp) * v_Q4pa[v] * n_wind_coeff;
+
+        double qv_sw_ht = std::max(qv_stack_ht, qv_wind) + divide(qv_stack_ht * qv_wind * n_sw_coeff, v_Q4pa[v]);
+        double qv_sw_cl = std::max(qv_stack_cl, qv_wind) + divide(qv_stack_cl * qv_wind * n_sw_coeff, v_Q4pa[v]);
+
+        double qve_ht = qv_sw_ht + qv_inf_min[v] + qv_mve[v];
+        double qve_cl = qv_sw_cl + qv_inf_min[v] + qv_mve[v];
+
+        b.Hve_ht[m][v] = qve_ht * n_rhoc_air / 3600.0;
+        b.Hve_cl[m][v] = qve_cl * n_rhoc_air / 3600.0;
+      }
+    }
+  }
+
+  void heatingAndCooling(Block& b, const BlockWeather& w, size_t n)
+  {
+    const double a_H0 = 1;
+    const double tau_H0 = 15;
+    const double n_dT_supp_ht = 7.0;
+    const double n_dT_supp_cl = 7.0;
+    const double n_rhoC_a = 1.22521 * 0.001012;
+    const double eps = std::numeric_limits<double>::min();
+
+    std::fill(b.Qneed_ht_yr, b.Qneed_ht_yr + n, 0.0);
+    std::fill(b.Qneed_cl_yr, b.Qneed_cl_yr + n, 0.0);
+    for (size_t m = 0; m < numMonths; ++m){
+      const double mdbt = w.mdbt[m];
+      const double Msec = megasecondsInMonth[m];
+      for (size_t v = 0; v < n; ++v){
+        double floorArea = b.in[FloorArea][v];
+        double a_H = a_H0 + b.tau[v] / tau_H0;
+        double tot_mo_ht_gain = Msec * b.phi_I_tot[v] + b.E_sol[m][v];
+
+        double QT_ht = (b.Th_avg[v] - mdbt) * Msec * b.H_tr[v];
+        double QV_ht = b.Hve_ht[m][v] * floorArea * (b.Th_avg[v] - mdbt) * Msec;
+        double Qtot_ht = QT_ht + QV_ht;
+        double gamma_H_ht = divide(tot_mo_ht_gain, Qtot_ht + eps);
+        double eta_g_H = gamma_H_ht > 0 ?
+                         (1 - std::pow(gamma_H_ht, a_H)) / (1 - std::pow(gamma_H_ht, (a_H + 1))) :
+                         1 / (gamma_H_ht + eps);
+        double Qneed_ht = Qtot_ht - eta_g_H * tot_mo_ht_gain;
+
+        double QT_cl = (b.Tc_avg[v] - mdbt) * b.H_tr[v] * Msec;
+        double QV_cl = b.Hve_cl[m][v] * floorArea * (b.Tc_avg[v] - mdbt) * Msec;
+        double Qtot_cl = QT_cl + QV_cl;
+        double gamma_H_cl = divide(Qtot_cl, tot_mo_ht_gain + eps);
+        double eta_g_CL = gamma_H_cl > 0.0 ?
+                          (1.0 - std::pow(gamma_H_cl, a_H)) / (1.0 - std::pow(gamma_H_cl, (a_H + 1.0))) :
+                          1.0;
+        double Qneed_cl = tot_mo_ht_gain - eta_g_CL * Qtot_cl;
+
+        b.Qneed_ht[m][v] = Qneed_ht;
+        b.Qneed_cl[m][v] = Qneed_cl;
+        b.Qneed_ht_yr[v] += Qneed_ht;
+        b.Qneed_cl_yr[v] += Qneed_cl;
+
+        double T_sup_ht = b.in[HeatingSetpointOccupied][v] + n_dT_supp_ht;
+        double T_sup_cl = b.in[CoolingSetpointOccupied][v] - n_dT_supp_cl;
+        double Vair_ht = divide(Qneed_ht, (T_sup_ht - b.Th_avg[v]) * n_rhoC_a + eps);
+        double Vair_cl = divide(Qneed_cl, (b.Tc_avg[v] - T_sup_cl) * n_rhoC_a + eps);
+        double Vair_min = Msec * (b.in[VentilationSupplyRate][v] * b.frac_hrs_wk_day[v]) / 1000;
+        double Vair_tot = std::max(Vair_ht + Vair_cl, Vair_min);
+        double fanPower = Vair_tot * (b.in[FanPower][v] * b.in[FanControlFactor][v]);
+        b.Qfan_tot[m][v] = divide(fanPower, floorArea) / 3600;
+      }
+    }
+  }
+
+  void hvac(Block& b, size_t n)
+  {
+    // district heating and cooling are disabled in SimModel::hvac, these are the zeros it adds for them
+    const double Qht_DH_total = 0.0;
+    const double Qcl_DC_elec = 0.0;
+    const double Qcl_DC_abs = 0.0;
+    const double eps = std::numeric_limits<double>::min();
+
+    double* eta_dist_ht = b.scratch[0];
+    double* eta_dist_cl = b.scratch[1];
+    for (size_t v = 0; v < n; ++v){
+      double f_waste = b.in[HotColdWasteFactor][v];
+      double f_dem_ht = std::max(b.Qneed_ht_yr[v] / (b.Qneed_cl_yr[v] + b.Qneed_ht_yr[v]), 0.1);
+      double f_dem_cl = std::max((1.0 - f_dem_ht), 0.1);
+      eta_dist_ht[v] = 1.0 / (1.0 + b.in[HeatingLossFactor][v] + f_waste / f_dem_ht);
+      eta_dist_cl[v] = 1.0 / (1.0 + b.in[CoolingLossFactor][v] + f_waste / f_dem_cl);
+    }
+    for (size_t m = 0; m < numMonths; ++m){
+      for (size_t v = 0; v < n; ++v){
+        double IEER = b.in[CoolingCOP][v] * b.in[CoolingPartialLoadValue][v];
+        double Qloss_ht_dist = divide(b.Qneed_ht[m][v] * (1 - eta_dist_ht[v]), eta_dist_ht[v]);
+        double Qloss_cl_dist = divide(b.Qneed_cl[m][v] * (1 - eta_dist_cl[v]), eta_dist_cl[v]);
+        double Qht_sys = divide(Qloss_ht_dist + b.Qneed_ht[m][v], b.in[HeatingEfficiency][v] + eps);
+        double Qcl_sys = divide(Qloss_cl_dist + b.Qneed_cl[m][v], IEER + eps);
+
+        b.Qcl_elec_tot[m][v] = Qcl_sys + Qcl_DC_elec;
+        b.Qcl_gas_tot[m][v] = Qcl_DC_abs;
+        if (b.in[HeatingEnergyType][v] == 1){
+          b.Qelec_ht[m][v] = Qht_sys;
+          b.Qgas_ht[m][v] = Qht_DH_total;
+        } else {
+          b.Qelec_ht[m][v] = 0;
+          b.Qgas_ht[m][v] = Qht_sys + Qht_DH_total;
+        }
+      }
+    }
+  }
+
+  void pump(Block& b, size_t n)
+  {
+    const double n_E_pumps = 0.25;
+    double Q_pumps_yr = 0;
+    for (size_t m = 0; m < numMonths; ++m){
+      Q_pumps_yr += megasecondsInMonth[m] * n_E_pumps;
+    }
+
+    double* frac_ht_total = b.scratch[0];
+    double* frac_cl_total = b.scratch[1];
+    double* frac_total = b.scratch[2];
+    std::fill(frac_ht_total, frac_ht_total + n, 0.0);
+    std::fill(frac_cl_total, frac_cl_total + n, 0.0);
+    std::fill(frac_total, frac_total + n, 0.0);
+    for (size_t m = 0; m < numMonths; ++m){
+      for (size_t v = 0; v < n; ++v){
+        double Qneed = b.Qneed_ht[m][v] + b.Qneed_cl[m][v];
+        frac_ht_total[v] += divide(b.Qneed_ht[m][v], Qneed);
+        frac_cl_total[v] += divide(b.Qneed_cl[m][v], Qneed);
+        frac_total[v] += divide(Qneed, b.Qneed_ht_yr[v] + b.Qneed_cl_yr[v]);
+      }
+    }
+
+    for (size_t m = 0; m < numMonths; ++m){
+      for (size_t v = 0; v < n; ++v){
+        double floorArea = b.in[FloorArea][v];
+        double Q_pumps_ht = Q_pumps_yr * b.in[HeatingPumpControl][v] * floorArea;
+        double Q_pumps_cl = Q_pumps_yr * b.in[CoolingPumpControl][v] * floorArea;
+        double Qneed = b.Qneed_ht[m][v] + b.Qneed_cl[m][v];
+        if (Q_pumps_ht == 0 || Q_pumps_cl == 0){
+          double Q_pumps_ht_mo = divide(divide(b.Qneed_ht[m][v], Qneed) * Q_pumps_ht, frac_ht_total[v]);
+          double Q_pumps_cl_mo = divide(divide(b.Qneed_cl[m][v], Qneed) * Q_pumps_cl, frac_cl_total[v]);
+          b.Q_pump_tot[m][v] = Q_pumps_ht_mo + Q_pumps_cl_mo;
+        } else {
+          double Q_pumps_tot = Q_pumps_ht + Q_pumps_cl;
+          b.Q_pump_tot[m][v] = divide(divide(Qneed, b.Qneed_ht_yr[v] + b.Qneed_cl_yr[v]) * Q_pumps_tot, frac_total[v]);
+        }
+      }
+    }
+  }
+
+  void heatedWater(Block& b, size_t n)
+  {
+    const double n_dhw_tset = 60;
+    const double n_dhw_tsupply = 20;
+    const double n_CP_h20 = 4.18;
+    const double Q_dhw_solar = 0;
+    for (size_t m = 0; m < numMonths; ++m){
+      for (size_t v = 0; v < n; ++v){
+        double Q_dhw_yr = b.in[HotWaterDemand][v] * (n_dhw_tset - n_dhw_tsupply) * n_CP_h20;
+        double frac_MonthlyDemand_yr = divide(daysInMonth[m] * Q_dhw_yr, daysInYear);
+        double Qe_demand = divide(frac_MonthlyDemand_yr, b.in[HotWaterDistributionEfficiency][v]);
+        double Q_dhw_demand = divide(Qe_demand, kWh2MJ);
+        double Q_dhw_need = std::max(divide(Q_dhw_demand - Q_dhw_solar, b.in[HotWaterSystemEfficiency][v]), 0.0);
+        if (b.in[HotWaterEnergyType][v] == 1){
+          b.Q_dhw_elec[m][v] = Q_dhw_need;
+          b.Q_dhw_gas[m][v] = 0;
+        } else {
+          b.Q_dhw_gas[m][v] = Q_dhw_need;
+          b.Q_dhw_elec[m][v] = 0;
+        }
+      }
+    }
+  }
+
+  /// SimModel::outputGeneration for variant v of the block
+  ISOResults outputGeneration(const Block& b, size_t v)
+  {
+    ISOResults allResults;
+
+    double floorArea = b.in[FloorArea][v];
+    double frac_hrs_wk_day = b.frac_hrs_wk_day[v];
+    double E_plug_elec = b.in[ElectricApplianceHeatGainOccupied][v] * frac_hrs_wk_day +
+                         b.in[ElectricApplianceHeatGainUnoccupied][v] * (1.0 - frac_hrs_wk_day);
+    double E_plug_gas = b.in[GasApplianceHeatGainOccupied][v] * frac_hrs_wk_day +
+                        b.in[GasApplianceHeatGainUnoccupied][v] * (1.0 - frac_hrs_wk_day);
+
+    for (size_t m = 0; m < numMonths; ++m){
+      EndUses results;
+      results.addEndUse(divide(divide(b.Qelec_ht[m][v], floorArea), kWh2MJ), EndUseFuelType::Electricity, EndUseCategoryType::Heating);
+      results.addEndUse(divide(divide(b.Qcl_elec_tot[m][v], floorArea), kWh2MJ), EndUseFuelType::Electricity, EndUseCategoryType::Cooling);
+      results.addEndUse(divide(b.Q_illum_tot[m][v], floorArea), EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights);
+      results.addEndUse(divide(b.Q_illum_ext_tot[m][v], floorArea), EndUseFuelType::Electricity, EndUseCategoryType::ExteriorLights);
+      results.addEndUse(b.Qfan_tot[m][v], EndUseFuelType::Electricity, EndUseCategoryType::Fans);
+      results.addEndUse(divide(divide(b.Q_pump_tot[m][v], floorArea), kWh2MJ), EndUseFuelType::Electricity, EndUseCategoryType::Pumps);
+      results.addEndUse(hoursInMonth[m] * E_plug_elec / 1000.0, EndUseFuelType::Electricity, EndUseCategoryType::InteriorEquipment);
+      results.addEndUse(divide(b.Q_dhw_elec[m][v], floorArea), EndUseFuelType::Electricity, EndUseCategoryType::WaterSystems);
+
+      results.addEndUse(divide(divide(b.Qgas_ht[m][v], floorArea), kWh2MJ), EndUseFuelType::Gas, EndUseCategoryType::Heating);
+      results.addEndUse(divide(divide(b.Qcl_gas_tot[m][v], floorArea), kWh2MJ), EndUseFuelType::Gas, EndUseCategoryType::Cooling);
+      results.addEndUse(hoursInMonth[m] * E_plug_gas / 1000.0, EndUseFuelType::Gas, EndUseCategoryType::InteriorEquipment);
+      results.addEndUse(divide(b.Q_dhw_gas[m][v], floorArea), EndUseFuelType::Gas, EndUseCategoryType::WaterSystems);
+      allResults.monthlyResults.push_back(results);
+    }
+
+    return allResults;
+  }
+
+  void simulateBlock(Block& b, const BlockWeather& w, size_t n)
+  {
+    scheduleAndOccupancy(b, n);
+    lightingEnergyUse(b, w, n);
+    envelope(b, n);
+    solarHeatGain(b, w, n);
+    internalHeatGain(b, n);
+    interiorTemp(b, n);
+    ventilationCalc(b, w, n);
+    heatingAndCooling(b, w, n);
+    hvac(b, n);
+    pump(b, n);
+    heatedWater(b, n);
+  }
+
+  /// A run of at most blockSize variants sharing weather data, as offsets into the simulation order
+  struct BlockRange
+  {
+    size_t begin;
+    size_t end;
+  };
+
+} // anonymous namespace
+
+SimModelBatch::SimModelBatch()
+  : m_inputs(NumInputs)
+{
+}
+
+SimModelBatch::SimModelBatch(const std::vector<SimModel>& simModels)
+  : m_inputs(NumInputs)
+{
+  for (const SimModel& simModel : simModels){
+    addSimModel(simModel);
+  }
+}
+
+size_t SimModelBatch::addSimModel(const SimModel& simModel)
+{
+  if (!simModel.pop || !simModel.location || !simModel.lights || !simModel.building || !simModel.structure ||
+      !simModel.heating || !simModel.cooling || !simModel.ventilation){
+    throw std::runtime_error("SimModel is missing inputs, cannot add it to SimModelBatch");
+  }
+  if (!simModel.location->weather()){
+    throw std::runtime_error("SimModel has no weather data, cannot add it to SimModelBatch");
+  }
+
+  const Structure& structure = *simModel.structure;
+  const Vector* directional[] = {&structure.wallArea(), &structure.windowArea(), &structure.wallUniform(),
+                                 &structure.windowUniform(), &structure.wallThermalEmissivity(), &structure.wallSolarAbsorbtion(),
+                                 &structure.windowNormalIncidenceSolarEnergyTransmittance(), &structure.windowShadingCorrectionFactor()};
+  for (const Vector* values : directional){
+    if (values->size() != numDirections){
+      throw std::runtime_error("SimModel structure does not have values for 9 directions, cannot add it to SimModelBatch");
+    }
+  }
+
+  double values[NumInputs];
+  values[HoursStart] = simModel.pop->hoursStart();
+  values[HoursEnd] = simModel.pop->hoursEnd();
+  values[DaysStart] = simModel.pop->daysStart();
+  values[DaysEnd] = simModel.pop->daysEnd();
+  values[DensityOccupied] = simModel.pop->densityOccupied();
+  values[DensityUnoccupied] = simModel.pop->densityUnoccupied();
+  values[HeatGainPerPerson] = simModel.pop->heatGainPerPerson();
+  values[Terrain] = simModel.location->terrain();
+  values[LightingPowerDensityOccupied] = simModel.lights->powerDensityOccupied();
+  values[LightingPowerDensityUnoccupied] = simModel.lights->powerDensityUnoccupied();
+  values[DimmingFraction] = simModel.lights->dimmingFraction();
+  values[ExteriorLightingEnergy] = simModel.lights->exteriorEnergy();
+  values[LightingOccupancySensor] = simModel.building->lightingOccupancySensor();
+  values[ConstantIllumination] = simModel.building->constantIllumination();
+  values[ElectricApplianceHeatGainOccupied] = simModel.building->electricApplianceHeatGainOccupied();
+  values[ElectricApplianceHeatGainUnoccupied] = simModel.building->electricApplianceHeatGainUnoccupied();
+  values[GasApplianceHeatGainOccupied] = simModel.building->gasApplianceHeatGainOccupied();
+  values[GasApplianceHeatGainUnoccupied] = simModel.building->gasApplianceHeatGainUnoccupied();
+  values[BuildingEnergyManagement] = simModel.building->buildingEnergyManagement();
+  values[FloorArea] = structure.floorArea();
+  values[WindowShadingDevice] = structure.windowShadingDevice();
+  values[InteriorHeatCapacity] = structure.interiorHeatCapacity();
+  values[WallHeatCapacity] = structure.wallHeatCapacity();
+  values[BuildingHeight] = structure.buildingHeight();
+  values[InfiltrationRate] = structure.infiltrationRate();
+  values[HeatingSetpointOccupied] = simModel.heating->temperatureSetPointOccupied();
+  values[HeatingSetpointUnoccupied] = simModel.heating->temperatureSetPointUnoccupied();
+  values[HeatingLossFactor] = simModel.heating->hvacLossFactor();
+  values[HotColdWasteFactor] = simModel.heating->hotcoldWasteFactor();
+  values[HeatingEfficiency] = simModel.heating->efficiency();
+  values[HeatingEnergyType] = simModel.heating->energyType();
+  values[HeatingPumpControl] = simModel.heating->pumpControlReduction();
+  values[HotWaterDemand] = simModel.heating->hotWaterDemand();
+  values[HotWaterDistributionEfficiency] = simModel.heating->hotWaterDistributionEfficiency();
+  values[HotWaterSystemEfficiency] = simModel.heating->hotWaterSystemEfficiency();
+  values[HotWaterEnergyType] = simModel.heating->hotWaterEnergyType();
+  values[CoolingSetpointOccupied] = simModel.cooling->temperatureSetPointOccupied();
+  values[CoolingSetpointUnoccupied] = simModel.cooling->temperatureSetPointUnoccupied();
+  values[CoolingCOP] = simModel.cooling->cop();
+  values[CoolingPartialLoadValue] = simModel.cooling->partialLoadValue();
+  values[CoolingLossFactor] = simModel.cooling->hvacLossFactor();
+  values[CoolingPumpControl] = simModel.cooling->pumpControlReduction();
+  values[VentilationSupplyRate] = simModel.ventilation->supplyRate();
+  values[VentilationSupplyDifference] = simModel.ventilation->supplyDifference();
+  values[HeatRecoveryEfficiency] = simModel.ventilation->heatRecoveryEfficiency();
+  values[ExhaustAirRecirculated] = simModel.ventilation->exhaustAirRecirculated();
+  values[VentilationType] = simModel.ventilation->type();
+  values[FanPower] = simModel.ventilation->fanPower();
+  values[FanControlFactor] = simModel.ventilation->fanControlFactor();
+  const Input directionalInputs[] = {WallArea, WindowArea, WallU, WindowU, WallEmissivity, WallAbsorption, WindowSHGC, WindowSCF};
+  for (size_t i = 0; i < sizeof(directionalInputs) / sizeof(directionalInputs[0]); ++i){
+    for (size_t j = 0; j < numDirections; ++j){
+      values[directionalInputs[i] + j] = (*directional[i])[j];
+    }
+  }
+
+  for (size_t i = 0; i < NumInputs; ++i){
+    m_inputs[i].push_back(values[i]);
+  }
+  m_weather.push_back(simModel.location->weather());
+
+  return m_weather.size() - 1;
+}
+
+size_t SimModelBatch::addUserModel(UserModel& userModel)
+{
+  return addSimModel(userModel.toSimModel());
+}
+
+size_t SimModelBatch::size() const
+{
+  return m_weather.size();
+}
+
+void SimModelBatch::clear()
+{
+  for (std::vector<double>& column : m_inputs){
+    column.clear();
+  }
+  m_weather.clear();
+}
+
+std::vector<ISOResults> SimModelBatch::simulate(unsigned numThreads) const
+{
+  size_t numVariants = size();
+  std::vector<ISOResults> results(numVariants);
+
+  // group variants by weather so each block shares its weather derived values
+  std::vector<size_t> order(numVariants);
+  for (size_t i = 0; i < numVariants; ++i){
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs){
+    return std::less<const WeatherData*>()(m_weather[lhs].get(), m_weather[rhs].get());
+  });
+
+  std::vector<BlockRange> blocks;
+  for (size_t begin = 0; begin < numVariants; ){
+    size_t end = begin + 1;
+    while (end < numVariants && end - begin < blockSize && m_weather[order[end]] == m_weather[order[begin]]){
+      ++end;
+    }
+    blocks.push_back(BlockRange{begin, end});
+    begin = end;
+  }
+
+  std::atomic<size_t> next(0);
+  std::mutex errorMutex;
+  std::exception_ptr error;
+  auto worker = [&](){
+    try {
+      std::unique_ptr<Block> block(new Block);
+      BlockWeather weather;
+      const WeatherData* loadedWeather = nullptr;
+      for (size_t i = next++; i < blocks.size(); i = next++){
+        const BlockRange& range = blocks[i];
+        size_t n = range.end - range.begin;
+
+        const WeatherData* blockWeather = m_weather[order[range.begin]].get();
+        if (blockWeather != loadedWeather){
+          loadWeather(*blockWeather, weather);
+          loadedWeather = blockWeather;
+        }
+
+        for (size_t input = 0; input < NumInputs; ++input){
+          const std::vector<double>& column = m_inputs[input];
+          for (size_t v = 0; v < n; ++v){
+            block->in[input][v] = column[order[range.begin + v]];
+          }
+        }
+
+        simulateBlock(*block, weather, n);
+
+        for (size_t v = 0; v < n; ++v){
+          results[order[range.begin + v]] = outputGeneration(*block, v);
+        }
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(errorMutex);
+      if (!error){
+        error = std::current_exception();
+      }
+      next = blocks.size();
+    }
+  };
+
+  if (numThreads == 0){
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  size_t threadCount = std::min<size_t>(numThreads, blocks.size());
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < threadCount; ++i){
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads){
+    thread.join();
+  }
+
+  if (error){
+    std::rethrow_exception(error);
+  }
+
+  return results;
+}
+
+} // isomodel
+} // openstudio
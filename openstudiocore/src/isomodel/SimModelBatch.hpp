@@ -0,0 +1,94 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef ISOMODEL_SIMMODELBATCH_HPP
+#define ISOMODEL_SIMMODELBATCH_HPP
+
+#include "ISOModelAPI.hpp"
+#include "SimModel.hpp"
+
+#include "../utilities/core/Logger.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace openstudio {
+namespace isomodel {
+
+  class UserModel;
+  class WeatherData;
+
+  /** SimModelBatch runs the monthly method of SimModel::simulate for many variants at once, e.g. for
+   *  parametric screening.  Inputs are stored struct of arrays, one column per input with one entry per
+   *  variant, and each step of the method is evaluated as a fused, allocation free loop across a block
+   *  of variants.  Every variant goes through the same floating point operations as SimModel::simulate
+   *  so the results are identical to simulating each variant on its own.
+   *
+   *  \code
+   *  SimModelBatch batch;
+   *  for (UserModel& variant : variants) {
+   *    batch.addUserModel(variant);
+   *  }
+   *  std::vector<ISOResults> results = batch.simulate();
+   *  \endcode
+   */
+  class ISOMODEL_API SimModelBatch {
+  public:
+    SimModelBatch();
+
+    explicit SimModelBatch(const std::vector<SimModel>& simModels);
+
+    /// Adds a variant and returns its index, throws if the SimModel is missing inputs or weather data
+    size_t addSimModel(const SimModel& simModel);
+
+    /// Adds userModel.toSimModel() and returns its index, throws if the UserModel is not valid
+    size_t addUserModel(UserModel& userModel);
+
+    /// Returns the number of variants
+    size_t size() const;
+
+    /// Removes all variants
+    void clear();
+
+    /** Simulates every variant, returning one ISOResults per variant in the order they were added.
+     *  Blocks of variants are spread over numThreads threads, 0 uses one thread per core. */
+    std::vector<ISOResults> simulate(unsigned numThreads = 0) const;
+
+  private:
+    REGISTER_LOGGER("openstudio.isomodel.SimModelBatch");
+
+    // one column per input, laid out as described in SimModelBatch.cpp, with one entry per variant
+    std::vector<std::vector<double> > m_inputs;
+    std::vector<std::shared_ptr<const WeatherData> > m_weather;
+  };
+
+} // isomodel
+} // openstudio
+
+#endif // ISOMODEL_SIMMODELBATCH_HPP
@@ -0,0 +1,109 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "ISOModelFixture.hpp"
+#include "../SimModelBatch.hpp"
+#include "../UserModel.hpp"
+#include <resources.hxx>
+
+using namespace openstudio::isomodel;
+using namespace openstudio;
+
+namespace {
+
+  // the batch engine performs the same operations in the same order as SimModel, results must be identical
+  void compareResults(const ISOResults& expected, const ISOResults& actual)
+  {
+    ASSERT_EQ(expected.monthlyResults.size(), actual.monthlyResults.size());
+    for (size_t i = 0; i < expected.monthlyResults.size(); ++i){
+      for (const EndUseFuelType& fuelType : EndUses::fuelTypes()){
+        for (const EndUseCategoryType& category : EndUses::categories()){
+          EXPECT_EQ(expected.monthlyResults[i].getEndUse(fuelType, category), actual.monthlyResults[i].getEndUse(fuelType, category));
+        }
+      }
+    }
+  }
+
+} // anonymous namespace
+
+TEST_F(ISOModelFixture, SimModelBatch)
+{
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+
+  // enough variants for several blocks, touching the branches in heating, ventilation, pumps and hot water
+  std::vector<SimModel> simModels;
+  for (int i = 0; i < 100; ++i){
+    UserModel variant = userModel;
+    double scale = 0.5 + i / 100.0;
+    variant.setFloorArea(userModel.floorArea() * scale);
+    variant.setHeatingOccupiedSetpoint(userModel.heatingOccupiedSetpoint() * scale);
+    variant.setCoolingOccupiedSetpoint(userModel.coolingOccupiedSetpoint() * scale);
+    variant.setWindowAreaS(userModel.windowAreaS() * scale);
+    variant.setWallUvalueN(userModel.wallUvalueN() * scale);
+    variant.setFreshAirFlowRate(userModel.freshAirFlowRate() * scale);
+    variant.setInteriorHeatCapacity(userModel.interiorHeatCapacity() * scale);
+    variant.setHeatingEnergyCarrier(1 + i % 2);
+    variant.setBemType(1 + i % 3);
+    variant.setVentilationType(1 + i % 3);
+    variant.setDhwEnergyCarrier(1 + (i / 2) % 2);
+    if (i % 7 == 0){
+      variant.setHeatingPumpControl(0);
+    }
+    if (i % 11 == 0){
+      variant.setBuildingAirLeakage(0);
+    }
+    simModels.push_back(variant.toSimModel());
+  }
+
+  SimModelBatch batch(simModels);
+  EXPECT_EQ(simModels.size(), batch.size());
+
+  for (unsigned numThreads : {1u, 4u}){
+    std::vector<ISOResults> results = batch.simulate(numThreads);
+    ASSERT_EQ(simModels.size(), results.size());
+    for (size_t i = 0; i < simModels.size(); ++i){
+      compareResults(simModels[i].simulate(), results[i]);
+    }
+  }
+
+  batch.clear();
+  EXPECT_EQ(0u, batch.size());
+  EXPECT_TRUE(batch.simulate().empty());
+  EXPECT_EQ(0u, batch.addUserModel(userModel));
+  std::vector<ISOResults> results = batch.simulate();
+  ASSERT_EQ(1u, results.size());
+  compareResults(userModel.toSimModel().simulate(), results[0]);
+  EXPECT_DOUBLE_EQ(231.02313235954443, results[0].totalEnergyUse());
+
+  EXPECT_THROW(batch.addSimModel(SimModel()), std::runtime_error);
+}
@@ -32,10 +32,16 @@
 
 #include "../UserModel.hpp"
 #include "../SimModel.hpp"
+#include "../EpwData.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
 
 #include <resources.hxx>
 
+#include <ctime>
+#include <iterator>
 #include <sstream>
+#include <string>
 
 using namespace openstudio::isomodel;
 using namespace openstudio;
@@ -821,3 +827,76 @@ TEST_F(ISOModelFixture, UserModel)
 
 
 }
+
+TEST_F(ISOModelFixture, UserModel_WeatherDataCache)
+{
+  openstudio::path isoPath = resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO");
+  openstudio::path epwPath = resourcesPath() / openstudio::toPath("isomodel/weather.epw");
+
+  UserModel userModel;
+  userModel.load(isoPath);
+  ASSERT_TRUE(userModel.valid());
+  UserModel userModel2;
+  userModel2.load(isoPath);
+  ASSERT_TRUE(userModel2.valid());
+
+  // UserModels using the same file share one WeatherData
+  std::shared_ptr<const WeatherData> weather = userModel.loadWeather();
+  ASSERT_TRUE(weather);
+  EXPECT_EQ(weather, userModel2.loadWeather());
+  EXPECT_EQ(weather, WeatherData::load(epwPath));
+
+  // which matches weather data computed without the cache
+  WeatherData uncached{EpwData(epwPath)};
+  for (size_t i = 0; i < 12; ++i){
+    EXPECT_EQ(uncached.mdbt()[i], weather->mdbt()[i]);
+    EXPECT_EQ(uncached.mEgh()[i], weather->mEgh()[i]);
+    EXPECT_EQ(uncached.mwind()[i], weather->mwind()[i]);
+    for (size_t j = 0; j < 8; ++j){
+      EXPECT_EQ(uncached.msolar()(i, j), weather->msolar()(i, j));
+    }
+  }
+
+  // a changed file is loaded again
+  openstudio::path tempPath = openstudio::tempDir() / openstudio::toPath("UserModel_WeatherDataCache.epw");
+  openstudio::filesystem::copy_file(epwPath, tempPath, openstudio::filesystem::copy_option::overwrite_if_exists);
+  std::shared_ptr<const WeatherData> tempWeather = WeatherData::load(tempPath);
+  EXPECT_NE(weather, tempWeather);
+  EXPECT_EQ(tempWeather, WeatherData::load(tempPath));
+  {
+    openstudio::filesystem::ofstream file(tempPath, std::ios_base::app);
+    file << std::endl;
+  }
+  std::shared_ptr<const WeatherData> changedWeather = WeatherData::load(tempPath);
+  EXPECT_NE(tempWeather, changedWeather);
+  EXPECT_EQ(tempWeather->mdbt()[0], changedWeather->mdbt()[0]);
+
+  // an edit that keeps the size and modification time is caught while the modification time is not conclusive
+  std::time_t lastWriteTime = std::time(nullptr) + 3600;
+  openstudio::filesystem::last_write_time(tempPath, lastWriteTime);
+  changedWeather = WeatherData::load(tempPath);
+  std::string contents;
+  {
+    openstudio::filesystem::ifstream file(tempPath, std::ios_base::binary);
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  std::string::size_type firstRecord = contents.find(",-12.2,-16.1,");
+  ASSERT_NE(std::string::npos, firstRecord);
+  contents.replace(firstRecord, 13, ",-19.2,-16.1,");
+  {
+    openstudio::filesystem::ofstream file(tempPath, std::ios_base::binary | std::ios_base::trunc);
+    file << contents;
+  }
+  openstudio::filesystem::last_write_time(tempPath, lastWriteTime);
+  std::shared_ptr<const WeatherData> editedWeather = WeatherData::load(tempPath);
+  EXPECT_NE(changedWeather, editedWeather);
+  EXPECT_LT(editedWeather->mdbt()[0], changedWeather->mdbt()[0]);
+  EXPECT_EQ(editedWeather, WeatherData::load(tempPath));
+
+  // data already handed out survives clearing the cache
+  WeatherData::clearCache();
+  EXPECT_NE(weather, WeatherData::load(epwPath));
+  EXPECT_EQ(uncached.mdbt()[0], weather->mdbt()[0]);
+
+  EXPECT_THROW(WeatherData::load(resourcesPath() / openstudio::toPath("isomodel/missing.epw")), std::exception);
+}
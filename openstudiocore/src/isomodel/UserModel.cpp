@@ -606,7 +606,7 @@ namespace isomodel {
       return -1;
   }
 
-  std::shared_ptr<WeatherData> UserModel::loadWeather(){
+  std::shared_ptr<const WeatherData> UserModel::loadWeather(){
     openstudio::path weatherFilename;
     //see if weather file path is absolute path
     //if so, use it, else assemble relative path
@@ -621,29 +621,10 @@ namespace isomodel {
       {
         LOG(Error, "Weather File Not Found: " << openstudio::toString(_weatherFilePath));
         _valid = false;
-        return std::shared_ptr<WeatherData>();
+        return std::shared_ptr<const WeatherData>();
       }
     }
-    EpwData edata(weatherFilename);
-
-    Matrix _msolar(12,8,0);
-    Matrix _mhdbt(12,24,0);
-    Matrix _mhEgh(12,24,0);
-    Vector _mEgh(12);
-    Vector _mdbt(12);
-    Vector _mwind(12);
-
-    edata.toISOData(_msolar, _mhdbt, _mhEgh, _mEgh, _mdbt, _mwind);
-
-    std::shared_ptr<WeatherData> wdata(new WeatherData);
-    wdata->setMdbt(_mdbt);
-    wdata->setMEgh(_mEgh);
-    wdata->setMhdbt(_mhdbt);
-    wdata->setMhEgh(_mhEgh);
-    wdata->setMsolar(_msolar);
-    wdata->setMwind(_mwind);
-
-    return wdata;
+    return WeatherData::load(weatherFilename);
   }
 
   void UserModel::load(const openstudio::path &buildingFile){
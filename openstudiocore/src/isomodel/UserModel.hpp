@@ -50,9 +50,10 @@ namespace isomodel {
      * Loads the specified weather data from disk.
      * Exposed to allow for separate loading from Ruby Scripts
      * Call setWeatherFilePath(path) then loadWeather() to update
-     * the UserModel with a new set of weather data
+     * the UserModel with a new set of weather data.  The weather data
+     * is shared with every other UserModel using the same file, see WeatherData::load
      */
-    std::shared_ptr<WeatherData> loadWeather();
+    std::shared_ptr<const WeatherData> loadWeather();
 
     /**
      * Loads an ISO model from the specified .ISO file
@@ -356,7 +357,7 @@ namespace isomodel {
     void parseStructure(const std::string &attributeName, const char* attributeValue);
 
     REGISTER_LOGGER("openstudio.isomodel.UserModel");
-    std::shared_ptr<WeatherData> _weather;
+    std::shared_ptr<const WeatherData> _weather;
     bool _valid;
     double _terrainClass;
     double _floorArea;
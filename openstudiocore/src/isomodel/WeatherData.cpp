@@ -28,12 +28,127 @@
 ***********************************************************************************************************************/
 
 #include "WeatherData.hpp"
+#include "EpwData.hpp"
 
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/Filesystem.hpp"
+
+#include <boost/optional.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <stdexcept>
 
 namespace openstudio {
 namespace isomodel {
 
-// nothing to see here
+namespace {
+
+  struct CachedWeatherData
+  {
+    std::time_t lastWriteTime;
+    uintmax_t fileSize;
+    // false if the file was written too close to the load for its modification time to be conclusive
+    bool metadataTrusted;
+    // only computed when the metadata is not trusted
+    std::string checksum;
+    std::shared_ptr<const WeatherData> weatherData;
+  };
+
+  std::mutex& weatherDataCacheMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  /// Keyed by the canonical path of the epw file, an entry is replaced when its file changes
+  std::map<std::string, CachedWeatherData>& weatherDataCache()
+  {
+    static std::map<std::string, CachedWeatherData> cache;
+    return cache;
+  }
+
+} // anonymous namespace
+
+WeatherData::WeatherData(const EpwData &epwData)
+  : _msolar(12, 8, 0), _mhdbt(12, 24, 0), _mhEgh(12, 24, 0), _mEgh(12), _mdbt(12), _mwind(12)
+{
+  epwData.toISOData(_msolar, _mhdbt, _mhEgh, _mEgh, _mdbt, _mwind);
+}
+
+std::shared_ptr<const WeatherData> WeatherData::load(const openstudio::path &epwPath)
+{
+  boost::system::error_code ec;
+  std::time_t lastWriteTime = openstudio::filesystem::last_write_time(epwPath, ec);
+  uintmax_t fileSize = 0;
+  if (!ec) {
+    fileSize = openstudio::filesystem::file_size(epwPath, ec);
+  }
+  if (ec) {
+    throw std::runtime_error("Unable to open weather file: " + openstudio::toString(epwPath));
+  }
+  std::string key = openstudio::toString(openstudio::filesystem::canonical(epwPath));
+
+  // the file is only read to checksum it if its size and modification time match an entry that
+  // could have been modified within the resolution of the modification time
+  boost::optional<CachedWeatherData> unverified;
+  {
+    std::lock_guard<std::mutex> lock(weatherDataCacheMutex());
+    auto it = weatherDataCache().find(key);
+    if (it != weatherDataCache().end() && it->second.lastWriteTime == lastWriteTime && it->second.fileSize == fileSize) {
+      if (it->second.metadataTrusted) {
+        return it->second.weatherData;
+      }
+      unverified = it->second;
+    }
+  }
+  if (unverified) {
+    std::time_t checkStart = std::time(nullptr);
+    if (openstudio::checksum(epwPath) == unverified->checksum) {
+      if (lastWriteTime + 1 < checkStart) {
+        // the file has not changed since it was loaded and its modification time is conclusive from now on
+        std::lock_guard<std::mutex> lock(weatherDataCacheMutex());
+        auto it = weatherDataCache().find(key);
+        if (it != weatherDataCache().end() && it->second.weatherData == unverified->weatherData) {
+          it->second.metadataTrusted = true;
+        }
+      }
+      return unverified->weatherData;
+    }
+  }
+
+  // modification times have a resolution of a second on some file systems, a file written during that
+  // second may change again without changing its modification time
+  CachedWeatherData loaded;
+  loaded.lastWriteTime = lastWriteTime;
+  loaded.fileSize = fileSize;
+  loaded.metadataTrusted = (lastWriteTime + 1 < std::time(nullptr));
+  if (!loaded.metadataTrusted) {
+    loaded.checksum = openstudio::checksum(epwPath);
+  }
+
+  // load outside of the lock so different files can be loaded concurrently
+  loaded.weatherData = std::shared_ptr<const WeatherData>(new WeatherData(EpwData(epwPath)));
+
+  std::lock_guard<std::mutex> lock(weatherDataCacheMutex());
+  CachedWeatherData& cached = weatherDataCache()[key];
+  if (cached.weatherData && cached.lastWriteTime == lastWriteTime && cached.fileSize == fileSize &&
+      cached.metadataTrusted == loaded.metadataTrusted && cached.checksum == loaded.checksum) {
+    // another thread loaded the same file first, share its copy
+    return cached.weatherData;
+  }
+  cached = loaded;
+  return loaded.weatherData;
+}
+
+void WeatherData::clearCache()
+{
+  std::lock_guard<std::mutex> lock(weatherDataCacheMutex());
+  weatherDataCache().clear();
+}
 
 }
 }
@@ -33,13 +33,34 @@
 #include "ISOModelAPI.hpp"
 #include "../utilities/data/Vector.hpp"
 #include "../utilities/data/Matrix.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <memory>
 
 namespace openstudio {
 namespace isomodel {
 
+class EpwData;
+
 class ISOMODEL_API WeatherData
 {
 public:
+  WeatherData() {}
+
+  /// Computes the monthly and hourly ISO weather data from epw data
+  explicit WeatherData(const EpwData &epwData);
+
+  /**
+   * Returns the ISO weather data for the epw file at epwPath.  Results are cached for the process, keyed by
+   * path, file size and modification time, so every caller loading an unchanged file shares one immutable
+   * WeatherData.  The file is checksummed only if it was written too recently for its modification time to
+   * be conclusive.  Safe to call from multiple threads, throws if the file cannot be read.
+   */
+  static std::shared_ptr<const WeatherData> load(const openstudio::path &epwPath);
+
+  /// Removes all cached weather data, WeatherData already handed out is unaffected
+  static void clearCache();
+
   /**
    * mean monthly Global Horizontal Radiation (W/m2)
    */
@@ -35,6 +35,7 @@
 #include "Connection.hpp"
 #include "ModelObject.hpp"
 #include "ModelObject_Impl.hpp"
+#include "ParentObject.hpp"
 #include "ResourceObject.hpp"
 #include "ResourceObject_Impl.hpp"
 
@@ -823,6 +824,62 @@ namespace detail {
     return removedObjects;
   }
 
+  std::vector<openstudio::IdfObject> Model_Impl::purgeDuplicateResourceObjects() {
+    IdfObjectVector removedObjects;
+
+    bool removedAny = true;
+    while (removedAny) {
+      removedAny = false;
+
+      ResourceObjectVector resources;
+      for (const ResourceObject& resource : model().getModelObjects<ResourceObject>()) {
+        if (resource.parent()) { continue; }
+        if (boost::optional<ParentObject> parentObject = resource.optionalCast<ParentObject>()) {
+          if (!parentObject->children().empty()) { continue; }
+        }
+        resources.push_back(resource);
+      }
+      std::sort(resources.begin(), resources.end(),
+                [](const ResourceObject& a, const ResourceObject& b) { return a.nameString() < b.nameString(); });
+
+      // candidates are bucketed by type and data fields hash, name is not part of the hash
+      std::map<std::pair<IddObjectType, std::size_t>, ResourceObjectVector> keepers;
+      for (const ResourceObject& resource : resources) {
+        // test for initialized first in case an earlier .remove() got this one already
+        if (!resource.initialized()) { continue; }
+
+        ResourceObjectVector& bucket = keepers[std::make_pair(resource.iddObjectType(), resource.dataFieldsHash())];
+
+        boost::optional<ResourceObject> keeper;
+        for (const ResourceObject& candidate : bucket) {
+          if (candidate.getImpl<detail::ResourceObject_Impl>()->dataFieldsEqual(resource, true) &&
+              candidate.objectListFieldsEqual(resource))
+          {
+            keeper = candidate;
+            break;
+          }
+        }
+
+        if (!keeper) {
+          bucket.push_back(resource);
+          continue;
+        }
+
+        for (WorkspaceObject source : resource.sources()) {
+          for (unsigned index : source.getSourceIndices(resource.handle())) {
+            source.setPointer(index, keeper->handle());
+          }
+        }
+        ResourceObject duplicate = resource;
+        IdfObjectVector thisCallRemoved = duplicate.remove();
+        removedObjects.insert(removedObjects.end(),thisCallRemoved.begin(),thisCallRemoved.end());
+        removedAny = true;
+      }
+    }
+
+    return removedObjects;
+  }
+
   void Model_Impl::connect(const Model& m,
                            ModelObject sourceObject,
                            unsigned sourcePort,
@@ -1377,6 +1434,10 @@ std::vector<openstudio::IdfObject> Model::purgeUnusedResourceObjects(IddObjectTy
   return getImpl<detail::Model_Impl>()->purgeUnusedResourceObjects(iddObjectType);
 }
 
+std::vector<openstudio::IdfObject> Model::purgeDuplicateResourceObjects() {
+  return getImpl<detail::Model_Impl>()->purgeDuplicateResourceObjects();
+}
+
 void Model::addVersionObject() {
   getUniqueModelObject<Version>();
 }
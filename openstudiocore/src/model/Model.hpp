@@ -424,6 +424,14 @@ class MODEL_API Model : public openstudio::Workspace {
    *  are not ResourceObjects, and these may be removed as well. */
   std::vector<openstudio::IdfObject> purgeUnusedResourceObjects(IddObjectType iddObjectType);
 
+  /** Merges \link ResourceObject ResourceObjects\endlink that differ only by name. Users of
+   *  each duplicate are pointed to the remaining object and the duplicate is removed. Resources
+   *  that are children or have children are left alone. Repeats until no duplicates remain, so
+   *  that, for instance, constructions become duplicates once their materials have been merged.
+   *  Of each set of duplicates, the object with the first name is kept. All objects removed are
+   *  returned to support undos. */
+  std::vector<openstudio::IdfObject> purgeDuplicateResourceObjects();
+
   // DLM@20110614: Kyle can you fill in here?
   /// Connects the sourcePort on the source ModelObject to the targetPort on the target ModelObject.
   void connect(ModelObject sourceObject,
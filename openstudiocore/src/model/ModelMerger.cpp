@@ -70,6 +70,7 @@
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/geometry/Transformation.hpp"
 #include "../utilities/geometry/Geometry.hpp"
+#include "../utilities/geometry/FloorplanJS.hpp"
 
 #include <utilities/idd/IddFactory.hxx>
 
@@ -877,7 +878,7 @@ namespace openstudio
       return *currentObject;
     }
 
-    void ModelMerger::mergeModels(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping)
+    void ModelMerger::initializeMerge(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping)
     {
       m_logSink.setThreadId(QThread::currentThread());
       m_logSink.resetStringStream();
@@ -894,6 +895,11 @@ namespace openstudio
         }
         m_newToCurrentHandleMapping[it.second] = it.first;
       }
+    }
+
+    void ModelMerger::mergeModels(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping)
+    {
+      initializeMerge(currentModel, newModel, handleMapping);
 
       //** Remove objects from current model that are not in new model **//
       for (const auto& iddObjectType : iddObjectTypesToMerge()){
@@ -912,6 +918,91 @@ namespace openstudio
       }
     }
 
+    void ModelMerger::mergeModelChanges(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping, const FloorplanChangeSet& changeSet)
+    {
+      initializeMerge(currentModel, newModel, handleMapping);
+
+      // shading under a space is replaced along with the space in mergeSpace
+      auto isSpaceShading = [](const WorkspaceObject& object) {
+        boost::optional<ShadingSurfaceGroup> group = object.optionalCast<ShadingSurfaceGroup>();
+        return (group && group->space());
+      };
+
+      //** Match unmapped objects by name, plenums and their zones have no handle in the floorplan **//
+      for (const auto& iddObjectType : iddObjectTypesToMerge()){
+        std::map<std::string, UUID> unmappedCurrentObjects;
+        for (const auto& currentObject : currentModel.getObjectsByType(iddObjectType)){
+          if (isSpaceShading(currentObject)){
+            continue;
+          }
+          if (m_currentToNewHandleMapping.find(currentObject.handle()) == m_currentToNewHandleMapping.end()){
+            unmappedCurrentObjects.insert(std::make_pair(currentObject.nameString(), currentObject.handle()));
+          }
+        }
+        for (const auto& newObject : newModel.getObjectsByType(iddObjectType)){
+          if (isSpaceShading(newObject)){
+            continue;
+          }
+          if (m_newToCurrentHandleMapping.find(newObject.handle()) == m_newToCurrentHandleMapping.end()){
+            auto it = unmappedCurrentObjects.find(newObject.nameString());
+            if (it != unmappedCurrentObjects.end()){
+              m_currentToNewHandleMapping[it->second] = newObject.handle();
+              m_newToCurrentHandleMapping[newObject.handle()] = it->second;
+              unmappedCurrentObjects.erase(it);
+            }
+          }
+        }
+      }
+
+      //** Remove objects from current model that are not in new model, only removed or replaced spaces and shading **//
+      std::set<UUID> removedHandles;
+      for (const auto& removedObject : changeSet.removedObjects()){
+        if (!removedObject.handle().isNull()){
+          removedHandles.insert(removedObject.handle());
+        }
+      }
+      std::set<std::string> replacedNames = changeSet.replacedNames();
+
+      for (const auto& iddObjectType : iddObjectTypesToMerge()){
+        bool geometryType = ((iddObjectType == IddObjectType::OS_Space) || (iddObjectType == IddObjectType::OS_ShadingSurfaceGroup));
+        for (auto& currenObject : currentModel.getObjectsByType(iddObjectType)){
+          if (m_currentToNewHandleMapping.find(currenObject.handle()) != m_currentToNewHandleMapping.end()){
+            continue;
+          }
+          if (!geometryType || (removedHandles.find(currenObject.handle()) != removedHandles.end()) || (replacedNames.find(currenObject.nameString()) != replacedNames.end())){
+            currenObject.remove();
+          }
+        }
+      }
+
+      //** Merge objects from new model into curret model **//
+      for (const auto& iddObjectType : iddObjectTypesToMerge()){
+        for (auto& newObject : newModel.getObjectsByType(iddObjectType)){
+          getCurrentModelObject(newObject);
+        }
+      }
+
+      //** Intersect and match merged spaces with the unchanged spaces they touch **//
+      std::vector<Space> mergedSpaces;
+      std::vector<Space> unchangedSpaces;
+      for (const auto& space : currentModel.getConcreteModelObjects<Space>()){
+        if (m_currentToNewHandleMapping.find(space.handle()) != m_currentToNewHandleMapping.end()){
+          mergedSpaces.push_back(space);
+        } else{
+          unchangedSpaces.push_back(space);
+        }
+      }
+
+      for (auto& mergedSpace : mergedSpaces){
+        for (auto& unchangedSpace : unchangedSpaces){
+          if (mergedSpace.boundingBox().intersects(unchangedSpace.boundingBox())){
+            mergedSpace.intersectSurfaces(unchangedSpace);
+            mergedSpace.matchSurfaces(unchangedSpace);
+          }
+        }
+      }
+    }
+
     std::vector<IddObjectType> ModelMerger::iddObjectTypesToMerge() const
     {
       return m_iddObjectTypesToMerge;
@@ -40,6 +40,8 @@
 
 namespace openstudio
 {
+  class FloorplanChangeSet;
+
   namespace model
   {
 
@@ -65,6 +67,12 @@ namespace openstudio
       /// Handle mapping is mapping of handles in currentModel (keys) to handles in newModel (values)
       void mergeModels(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping);
 
+      /// Merges changes from newModel into currentModel where newModel was translated from FloorplanJS::toThreeScene restricted to changeSet.affectedIds()
+      /// Spaces and ShadingSurfaceGroups in currentModel are only removed if they were removed or replaced in changeSet, all others are left in place
+      /// Unmapped objects in newModel are matched to unmapped objects of the same type and name in currentModel, this preserves plenums
+      /// Merged Spaces are intersected and matched with the Spaces they touch in currentModel
+      void mergeModelChanges(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping, const FloorplanChangeSet& changeSet);
+
       /// List of IddObjectTypes which are merged
       std::vector<IddObjectType> iddObjectTypesToMerge() const;
 
@@ -87,6 +95,8 @@ namespace openstudio
 
        REGISTER_LOGGER("openstudio.model.ModelMerger");
 
+      void initializeMerge(Model& currentModel, const Model& newModel, const std::map<UUID, UUID>& handleMapping);
+
       void mergeSpace(Space& currentSpace, const Space& newSpace);
       void mergeShadingSurfaceGroup(ShadingSurfaceGroup& currentGroup, const ShadingSurfaceGroup& newGroup);
       void mergeThermalZone(ThermalZone& currentThermalZone, const ThermalZone& newThermalZone);
@@ -245,6 +245,10 @@ namespace detail {
      *  are not ResourceObjects, and these may be removed as well. */
     virtual std::vector<openstudio::IdfObject> purgeUnusedResourceObjects(IddObjectType iddObjectType);
 
+    /** Merges \link ResourceObject ResourceObjects\endlink that differ only by name. All objects
+     *  removed are returned to support undos. */
+    std::vector<openstudio::IdfObject> purgeDuplicateResourceObjects();
+
     void connect(const Model& model,
                  ModelObject sourceObject,
                  unsigned sourcePort,
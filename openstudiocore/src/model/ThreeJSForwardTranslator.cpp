@@ -59,6 +59,7 @@
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
+#include "../utilities/core/StringStreamLogSink.hpp"
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
@@ -68,7 +69,9 @@
 
 #include <QThread>
 
+#include <atomic>
 #include <cmath>
+#include <thread>
 
 namespace openstudio
 {
@@ -290,39 +293,57 @@ namespace openstudio
       }
     }
 
-    void makeGeometries(const PlanarSurface& planarSurface, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas, bool triangulateSurfaces)
+    // model data needed to build the geometry of a planar surface, gathered up front so that
+    // triangulation can run on worker threads without touching the model
+    struct PlanarSurfaceGeometryInput
     {
-      std::string name = planarSurface.nameString();
-      boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
-      boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
+      Point3dVector vertices;
+      Point3dVectorVector subSurfaceVertices;
+      Transformation siteTransformation;
+    };
+
+    PlanarSurfaceGeometryInput getGeometryInput(const PlanarSurface& planarSurface)
+    {
+      PlanarSurfaceGeometryInput result;
 
       // get the transformation to site coordinates
-      Transformation siteTransformation;
+      boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
       if (planarSurfaceGroup){
-        siteTransformation = planarSurfaceGroup->siteTransformation();
+        result.siteTransformation = planarSurfaceGroup->siteTransformation();
       }
 
       // get the vertices
-      Point3dVector vertices = planarSurface.vertices();
-      Transformation t = Transformation::alignFace(vertices);
-      //Transformation r = t.rotationMatrix();
-      Transformation tInv = t.inverse();
-      Point3dVector faceVertices = reverse(tInv*vertices);
+      result.vertices = planarSurface.vertices();
 
       // get vertices of all sub surfaces
-      Point3dVectorVector faceSubVertices;
+      boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
       if (surface){
         for (const auto& subSurface : surface->subSurfaces()){
-          faceSubVertices.push_back(reverse(tInv*subSurface.vertices()));
+          result.subSurfaceVertices.push_back(subSurface.vertices());
         }
       }
 
+      return result;
+    }
+
+    // does not access the model, empty if triangulation fails
+    boost::optional<ThreeGeometryData> makeGeometryData(const PlanarSurfaceGeometryInput& input, bool triangulateSurfaces)
+    {
+      Transformation t = Transformation::alignFace(input.vertices);
+      //Transformation r = t.rotationMatrix();
+      Transformation tInv = t.inverse();
+      Point3dVector faceVertices = reverse(tInv*input.vertices);
+
+      Point3dVectorVector faceSubVertices;
+      for (const auto& subSurfaceVertices : input.subSurfaceVertices){
+        faceSubVertices.push_back(reverse(tInv*subSurfaceVertices));
+      }
+
       Point3dVectorVector finalFaceVertices;
       if (triangulateSurfaces){
         finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
         if (finalFaceVertices.empty()){
-          LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << faceSubVertices.size() << " sub surfaces");
-          return;
+          return boost::none;
         }
       } else{
         finalFaceVertices.push_back(faceVertices);
@@ -331,7 +352,7 @@ namespace openstudio
       Point3dVector allVertices;
       std::vector<size_t> faceIndices;
       for (const auto& finalFaceVerts : finalFaceVertices) {
-        Point3dVector finalVerts = siteTransformation*t*finalFaceVerts;
+        Point3dVector finalVerts = input.siteTransformation*t*finalFaceVerts;
         //normal = siteTransformation.rotationMatrix*r*z
 
         // https://github.com/mrdoob/three.js/wiki/JSON-Model-format-3
@@ -359,9 +380,82 @@ namespace openstudio
         //face_indices.each_index {|i| face_indices[i] = face_indices[i] + 1}
       }
 
-      ThreeGeometryData geometryData(toThreeVector(allVertices), faceIndices);
+      return ThreeGeometryData(toThreeVector(allVertices), faceIndices);
+    }
+
+    // geometry data for a planar surface and the messages logged while making it on a worker thread
+    struct PlanarSurfaceGeometryOutput
+    {
+      boost::optional<ThreeGeometryData> geometryData;
+      std::vector<LogMessage> logMessages;
+    };
+
+    // makes geometry data for all inputs, spreading the work over the available hardware threads
+    std::vector<PlanarSurfaceGeometryOutput> makeGeometryDatas(const std::vector<PlanarSurfaceGeometryInput>& inputs, bool triangulateSurfaces)
+    {
+      std::vector<PlanarSurfaceGeometryOutput> result(inputs.size());
+
+      std::atomic<size_t> next(0);
+      auto worker = [&](bool captureMessages){
+        // sinks filtered to the calling thread do not see messages logged on worker threads,
+        // collect them per input so that they can be logged again from the calling thread
+        boost::optional<StringStreamLogSink> sink;
+        if (captureMessages){
+          sink = StringStreamLogSink();
+          sink->setLogLevel(Warn);
+          sink->setThreadId(QThread::currentThread());
+        }
+
+        for (size_t i = next++; i < inputs.size(); i = next++){
+          try{
+            result[i].geometryData = makeGeometryData(inputs[i], triangulateSurfaces);
+          } catch (const std::exception& e){
+            LOG_FREE(Error, "modelToThreeJS", "Exception while making geometry: " << e.what());
+          } catch (...){
+            LOG_FREE(Error, "modelToThreeJS", "Unknown exception while making geometry");
+          }
+
+          if (sink){
+            Logger::instance().flush();
+            result[i].logMessages = sink->logMessages();
+            sink->resetStringStream();
+          }
+        }
+      };
+
+      // not worth starting threads for a handful of surfaces
+      const size_t minSurfacesPerThread = 16;
+      size_t numThreads = std::min<size_t>(std::thread::hardware_concurrency(), inputs.size() / minSurfacesPerThread);
+
+      if (numThreads < 2){
+        worker(false);
+        return result;
+      }
+
+      std::vector<std::thread> threads;
+      for (size_t i = 0; i < numThreads; ++i){
+        threads.emplace_back(worker, true);
+      }
+      for (auto& thread : threads){
+        thread.join();
+      }
+
+      return result;
+    }
+
+    void makeGeometries(const PlanarSurface& planarSurface, const PlanarSurfaceGeometryInput& input, const PlanarSurfaceGeometryOutput& output, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas)
+    {
+      for (const auto& logMessage : output.logMessages){
+        LOG_FREE(logMessage.logLevel(), logMessage.logChannel(), logMessage.logMessage());
+      }
+
+      const boost::optional<ThreeGeometryData>& geometryData = output.geometryData;
+      if (!geometryData){
+        LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << planarSurface.nameString() << " with " << input.subSurfaceVertices.size() << " sub surfaces");
+        return;
+      }
 
-      ThreeGeometry geometry(toThreeUUID(toString(planarSurface.handle())), "Geometry", geometryData);
+      ThreeGeometry geometry(toThreeUUID(toString(planarSurface.handle())), "Geometry", *geometryData);
       geometries.push_back(geometry);
 
       ThreeUserData userData;
@@ -381,7 +475,7 @@ namespace openstudio
         }
 
         Point3dVector otherVertices = otherSiteTransformation*adjacentPlanarSurface->vertices();
-        if (circularEqual(siteTransformation*vertices, reverse(otherVertices))){
+        if (circularEqual(input.siteTransformation*input.vertices, reverse(otherVertices))){
           userData.setCoincidentWithOutsideObject(true);
         } else{
           userData.setCoincidentWithOutsideObject(false);
@@ -466,12 +560,22 @@ namespace openstudio
       double n = 0;
       double N = planarSurfaces.size() + planarSurfaceGroups.size() + buildingStories.size() + buildingUnits.size() + thermalZones.size() + spaceTypes.size() + defaultConstructionSets.size() + 1;
 
+      // gather surface vertices from the model, model access is not thread safe
+      std::vector<PlanarSurfaceGeometryInput> geometryInputs;
+      geometryInputs.reserve(planarSurfaces.size());
+      for (const auto& planarSurface : planarSurfaces){
+        geometryInputs.push_back(getGeometryInput(planarSurface));
+      }
+
+      // triangulation only uses the gathered vertices so it is done in parallel
+      std::vector<PlanarSurfaceGeometryOutput> geometryOutputs = makeGeometryDatas(geometryInputs, triangulateSurfaces);
+
       // loop over all surfaces
-      for (const auto& planarSurface : planarSurfaces)
+      for (size_t surfaceIdx = 0; surfaceIdx < planarSurfaces.size(); ++surfaceIdx)
       {
         std::vector<ThreeGeometry> geometries;
         std::vector<ThreeUserData> userDatas;
-        makeGeometries(planarSurface, geometries, userDatas, triangulateSurfaces);
+        makeGeometries(planarSurfaces[surfaceIdx], geometryInputs[surfaceIdx], geometryOutputs[surfaceIdx], geometries, userDatas);
         OS_ASSERT(geometries.size() == userDatas.size());
 
         size_t n = geometries.size();
@@ -134,3 +134,37 @@ TEST_F(ModelFixture,ResourceObject_Clone) {
   EXPECT_EQ("Material with Changed Data",newConstruction.layers()[0].name().get());
   EXPECT_EQ("Material 1",anotherNewConstruction.layers()[0].name().get());
 }
+
+TEST_F(ModelFixture,ResourceObject_PurgeDuplicateResourceObjects) {
+  Model model;
+  StandardOpaqueMaterial material1(model);
+  StandardOpaqueMaterial material2(model);
+  StandardOpaqueMaterial material3(model);
+  EXPECT_TRUE(material3.setThickness(0.2));
+
+  Construction construction1(model);
+  EXPECT_TRUE(construction1.setLayers(MaterialVector(1u,material1)));
+  Construction construction2(model);
+  EXPECT_TRUE(construction2.setLayers(MaterialVector(1u,material2)));
+  Construction construction3(model);
+  EXPECT_TRUE(construction3.setLayers(MaterialVector(1u,material3)));
+
+  EXPECT_EQ(material1.dataFieldsHash(), material2.dataFieldsHash());
+
+  // material2 is merged into material1, after which construction2 duplicates construction1
+  IdfObjectVector removedObjects = model.purgeDuplicateResourceObjects();
+  EXPECT_EQ(2u, removedObjects.size());
+  EXPECT_TRUE(material1.initialized());
+  EXPECT_FALSE(material2.initialized());
+  EXPECT_TRUE(material3.initialized());
+  EXPECT_TRUE(construction1.initialized());
+  EXPECT_FALSE(construction2.initialized());
+  EXPECT_TRUE(construction3.initialized());
+
+  ASSERT_EQ(1u, construction1.numLayers());
+  EXPECT_EQ(material1, construction1.layers()[0]);
+  ASSERT_EQ(1u, construction3.numLayers());
+  EXPECT_EQ(material3, construction3.layers()[0]);
+
+  EXPECT_TRUE(model.purgeDuplicateResourceObjects().empty());
+}
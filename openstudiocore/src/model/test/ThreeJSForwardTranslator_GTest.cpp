@@ -39,6 +39,7 @@
 #include "../Surface.hpp"
 #include "../Surface_Impl.hpp"
 
+#include "../../utilities/geometry/Point3d.hpp"
 #include "../../utilities/geometry/ThreeJS.hpp"
 
 using namespace openstudio;
@@ -83,3 +84,48 @@ TEST_F(ModelFixture,ThreeJSForwardTranslator_ExampleModel) {
   EXPECT_EQ(model.getConcreteModelObjects<Space>().size(), model2->getConcreteModelObjects<Space>().size());
   EXPECT_EQ(model.getConcreteModelObjects<Surface>().size(), model2->getConcreteModelObjects<Surface>().size());
 }
+
+TEST_F(ModelFixture,ThreeJSForwardTranslator_TriangulationErrors) {
+
+  Model model;
+  Space space(model);
+
+  // enough surfaces for triangulation to be spread over worker threads
+  for (unsigned i = 0; i < 64; ++i){
+    Point3dVector vertices;
+    vertices.push_back(Point3d(0, 0, i));
+    vertices.push_back(Point3d(0, 1, i));
+    vertices.push_back(Point3d(1, 1, i));
+    vertices.push_back(Point3d(1, 0, i));
+    Surface surface(vertices, model);
+    surface.setSpace(space);
+  }
+
+  // non planar vertices can not be triangulated
+  Point3dVector vertices;
+  vertices.push_back(Point3d(0, 0, 100));
+  vertices.push_back(Point3d(0, 10, 100));
+  vertices.push_back(Point3d(10, 10, 101));
+  vertices.push_back(Point3d(10, 0, 100));
+  Surface nonPlanarSurface(vertices, model);
+  nonPlanarSurface.setName("Non Planar Surface");
+  nonPlanarSurface.setSpace(space);
+
+  ThreeJSForwardTranslator ft;
+  ThreeScene scene = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(64u, scene.geometries().size());
+
+  // errors logged while triangulating on worker threads are reported by the translator
+  bool foundTriangulationError = false;
+  bool foundSurfaceError = false;
+  for (const auto& error : ft.errors()){
+    if (error.logChannel() == "utilities.geometry.computeTriangulation"){
+      foundTriangulationError = true;
+    }
+    if (error.logMessage().find("Non Planar Surface") != std::string::npos){
+      foundSurfaceError = true;
+    }
+  }
+  EXPECT_TRUE(foundTriangulationError);
+  EXPECT_TRUE(foundSurfaceError);
+}
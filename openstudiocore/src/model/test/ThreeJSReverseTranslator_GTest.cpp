@@ -159,6 +159,73 @@ TEST_F(ModelFixture, ThreeJSReverseTranslator_FloorplanJS_SurfaceMatch) {
 
 }
 
+TEST_F(ModelFixture, ThreeJSReverseTranslator_FloorplanJS_MergeChanges) {
+
+  ThreeJSReverseTranslator rt;
+
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/surface_match_floorplan.json");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<FloorplanJS> floorPlan = FloorplanJS::load(toString(p));
+  ASSERT_TRUE(floorPlan);
+
+  boost::optional<Model> model = rt.modelFromThreeJS(floorPlan->toThreeScene(true));
+  ASSERT_TRUE(model);
+
+  model::Model newModel;
+  model::ModelMerger mm;
+  mm.mergeModels(newModel, *model, rt.handleMapping());
+
+  ASSERT_EQ(4u, newModel.getModelObjects<Space>().size());
+  ASSERT_EQ(24u, newModel.getModelObjects<Surface>().size());
+
+  std::set<UUID> unchangedSpaceHandles;
+  for (const auto& space : newModel.getModelObjects<Space>()) {
+    if (space.nameString() != "Space 1 - 1"){
+      unchangedSpaceHandles.insert(space.handle());
+    }
+  }
+  EXPECT_EQ(3u, unchangedSpaceHandles.size());
+
+  // rename one space and only regenerate that space
+  Json::Reader reader;
+  Json::Value value;
+  ASSERT_TRUE(reader.parse(floorPlan->toJSON(), value));
+  ASSERT_EQ("Space 1 - 1", value["stories"][0]["spaces"][0].get("name", "").asString());
+  value["stories"][0]["spaces"][0]["name"] = "Space 1 - 1 Renamed";
+
+  Json::FastWriter writer;
+  FloorplanJS floorPlan2(writer.write(value));
+
+  FloorplanChangeSet changeSet = floorPlan->diff(floorPlan2);
+  ASSERT_EQ(1u, changeSet.affectedIds().size());
+
+  boost::optional<Model> model2 = rt.modelFromThreeJS(floorPlan2.toThreeScene(true, changeSet.affectedIds()));
+  ASSERT_TRUE(model2);
+  EXPECT_EQ(1u, model2->getModelObjects<Space>().size());
+
+  mm.mergeModelChanges(newModel, *model2, rt.handleMapping(), changeSet);
+
+  EXPECT_EQ(4u, newModel.getModelObjects<Space>().size());
+  EXPECT_EQ(24u, newModel.getModelObjects<Surface>().size());
+  EXPECT_FALSE(newModel.getModelObjectByName<Space>("Space 1 - 1"));
+  EXPECT_TRUE(newModel.getModelObjectByName<Space>("Space 1 - 1 Renamed"));
+  EXPECT_EQ(2u, newModel.getModelObjects<BuildingStory>().size());
+
+  for (const auto& handle : unchangedSpaceHandles) {
+    EXPECT_TRUE(newModel.getModelObject<Space>(handle));
+  }
+
+  unsigned numMatched = 0;
+  for (const auto& surface : newModel.getModelObjects<Surface>()) {
+    if (surface.outsideBoundaryCondition() == "Surface"){
+      EXPECT_TRUE(surface.adjacentSurface());
+      ++numMatched;
+    }
+  }
+  EXPECT_EQ(8u, numMatched);
+}
+
 TEST_F(ModelFixture, ThreeJSReverseTranslator_FloorplanJS_Doors) {
 
   ThreeJSReverseTranslator rt;
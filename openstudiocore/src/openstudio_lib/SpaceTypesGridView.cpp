@@ -1611,6 +1611,10 @@ namespace openstudio {
             if( this->modelObject(i).handle() == t_spaceType->handle() ) {
               // Standards Building Type is penultimate
               QWidget * t_widgetStandardsBuildingType = this->cell(i, columnCount - 2);
+              // Rows out of view have no widgets, they pick up the new choices when they are built
+              if( !t_widgetStandardsBuildingType ) {
+                break;
+              }
               // 0 appears to be GridLayout, 1 is a Holder
               QObject * oBT = t_widgetStandardsBuildingType->children()[1];
               Holder * holderBT = qobject_cast<Holder *>(oBT);
@@ -1623,6 +1627,10 @@ namespace openstudio {
 
               // Standards Space Type is last
               QWidget * t_widgetStandardsSpaceType = this->cell(i, columnCount - 1);
+              // Rows out of view have no widgets, they pick up the new choices when they are built
+              if( !t_widgetStandardsSpaceType ) {
+                break;
+              }
               // 0 appears to be GridLayout, 1 is a Holder
               QObject * oST = t_widgetStandardsSpaceType->children()[1];
               Holder * holderST = qobject_cast<Holder *>(oST);
@@ -1693,6 +1701,10 @@ namespace openstudio {
           for( int i = 1; i < this->rowCount(); ++i ) {
             if( this->modelObject(i).handle() == t_spaceType->handle() ) {
               QWidget * t_widgetStandardsSpaceType = this->cell(i, columnCount - 1);
+              // Rows out of view have no widgets, they pick up the new choices when they are built
+              if( !t_widgetStandardsSpaceType ) {
+                break;
+              }
               // 0 appears to be GridLayout, 1 is a Holder
               QObject * oST = t_widgetStandardsSpaceType->children()[1];
               Holder * holderST = qobject_cast<Holder *>(oST);
@@ -61,6 +61,8 @@
 #include <utilities/idd/OS_ComponentData_FieldEnums.hxx>
 #include "../utilities/math/FloatCompare.hpp"
 
+#include "../utilities/core/Trace.hpp"
+
 #include <OpenStudio.hxx>
 
 #include <QThread>
@@ -390,6 +392,8 @@ void VersionTranslator::setAllowNewerVersions(bool allowNewerVersions)
 boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
                                                                bool isComponent,
                                                                ProgressBar* progressBar) {
+  OS_TRACE_SCOPE("osversion", "VersionTranslator::updateVersion");
+
   m_originalVersion = VersionString("0.0.0");
   m_map.clear();
   m_logSink.setThreadId(QThread::currentThread());
@@ -403,7 +407,10 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
   m_nObjectsFinalModel = 0;
   m_isComponent = isComponent;
 
-  initializeMap(is);
+  {
+    OS_TRACE_SCOPE("osversion", "initializeMap");
+    initializeMap(is);
+  }
   OS_ASSERT(m_map.size() < 2u);
   if (m_map.size() == 0u) {
     return boost::none;
@@ -441,6 +448,7 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
   }
 
   // validity checking
+  OS_TRACE_SCOPE("osversion", "validityChecking");
   Workspace finalWorkspace(finalModel);
   model::Model tempModel(finalWorkspace); // None-level strictness!
   OS_ASSERT(tempModel.strictnessLevel() == StrictnessLevel::None);
@@ -599,6 +607,7 @@ IddFileAndFactoryWrapper VersionTranslator::getIddFile(const VersionString& vers
 void VersionTranslator::update(const VersionString& startVersion) {
   std::map<VersionString, IdfFile>::const_iterator start = m_map.find(startVersion);
   if (start != m_map.end()) {
+    OS_TRACE_SCOPE_DYNAMIC("osversion", "update from " + startVersion.str());
 
     std::string translatedIdf;
     VersionString lastVersion("0.0.0");
@@ -621,6 +630,7 @@ void VersionTranslator::update(const VersionString& startVersion) {
           << lastVersion.str() << ". Unable to find and execute the appropriate update method.");
       return;
     }
+    OS_TRACE_SCOPE("osversion", "reloadTranslatedIdf");
     std::stringstream ss(translatedIdf);
     OptionalIdfFile oIdfFile;
     if (oIddFile->iddFileType() == IddFileType::UserCustom) {
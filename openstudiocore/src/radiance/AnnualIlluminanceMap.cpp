@@ -30,9 +30,16 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/FilesystemHelpers.hpp"
+
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <vector>
+#include <cstring>
+#include <ctime>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
@@ -40,6 +47,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/tokenizer.hpp>
 
+#include <QFile>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -47,12 +56,48 @@ using namespace openstudio;
 namespace openstudio{
 namespace radiance{
 
+  // The cache starts with a header of magic, source file size, source file time, M, N, number of records, source
+  // checksum, and whether the source file time is conclusive.  This is followed by the M x values and N y values, then
+  // one record per time step of month, day, and hours followed by the M*N illuminance values in lux.  All values are
+  // 8 bytes in native byte order so records can be read straight from the mapped file.  The magic is written last so
+  // an interrupted write is never reused.  File times have a resolution of a second on some file systems, so the source
+  // checksum is only stored and checked if the source was modified within a second of the cache being written.
+  static const char cacheMagic[8] = {'O', 'S', 'I', 'L', 'L', 'M', 'P', '2'};
+  static const unsigned long long cacheHeaderSize = 64;
+  static const unsigned long long checksumSize = 8;
+  static const unsigned recordHeaderSize = 3;
+
+  template<class T>
+  static void writeCacheValue(std::ostream& os, T value)
+  {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template<class T>
+  static T readCacheValue(const char* data)
+  {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+  }
+
+  static void removeTempFile(const openstudio::path& path)
+  {
+    if (path.empty()){
+      return;
+    }
+    boost::system::error_code ec;
+    openstudio::filesystem::remove(path, ec);
+  }
+
   /// default constructor
   AnnualIlluminanceMap::AnnualIlluminanceMap()
+    : m_values(nullptr)
   {}
 
   /// constructor with path
   AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::path& path)
+    : m_values(nullptr)
   {
     init(path);
   }
@@ -65,9 +110,60 @@ namespace radiance{
       return;
     }
 
+    openstudio::path cachePath = toPath(toString(path) + ".cache");
+    if (openCache(path, cachePath, true)){
+      return;
+    }
+
+    // other instances or processes may have the old cache mapped, truncating it in place would pull the pages out
+    // from under them, so the cache is written to a temporary file which is renamed over the old one
+    bool complete = false;
+    openstudio::path tempPath;
+    try{
+      tempPath = cachePath.parent_path() / openstudio::filesystem::unique_path(toPath(toString(cachePath.filename()) + "-%%%%-%%%%-%%%%"));
+      bool written = false;
+      {
+        openstudio::filesystem::ofstream cacheFile(tempPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        if (cacheFile.good()){
+          complete = writeCache(path, cacheFile);
+          cacheFile.close();
+          written = !cacheFile.fail();
+        }
+      }
+      if (written){
+        openstudio::filesystem::rename(tempPath, cachePath);
+        tempPath.clear();
+        if (openCache(path, cachePath, complete)){
+          return;
+        }
+      }
+    }catch(const std::exception&){
+    }
+    removeTempFile(tempPath);
+
+    // could not write the cache file, keep the cache in memory instead
+    LOG(Warn, "Unable to write illuminance map cache '" << toString(cachePath) << "', reading into memory");
+    std::stringstream ss(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    complete = writeCache(path, ss);
+    m_cacheBuffer = std::make_shared<std::string>(ss.str());
+    if (!indexCache(path, m_cacheBuffer->data(), m_cacheBuffer->size(), complete)){
+      m_cacheBuffer.reset();
+    }
+  }
+
+  bool AnnualIlluminanceMap::writeCache(const openstudio::path& path, std::ostream& os) const
+  {
+    // a source modified during the second it is read in may change again without changing its file time
+    long long readStart = std::time(nullptr);
+
     // open file
     openstudio::filesystem::ifstream file(path);
 
+    // header is rewritten once the file has been read
+    for (unsigned long long i = 0; i < cacheHeaderSize; ++i){
+      os.put('\0');
+    }
+
     // keep track of line number
     unsigned lineNum = 0;
 
@@ -75,21 +171,24 @@ namespace radiance{
     unsigned M=0;
     unsigned N=0;
 
+    // number of illuminance maps written
+    unsigned long long numRecords = 0;
+
+    // set if the file could not be completely read
+    bool complete = true;
+
     // temp string to read file
     string line;
 
     // lines 1 and 2 are the header lines
     string line1, line2;
 
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
-
     // conversion from footcandles to lux
     const double footcandlesToLux(10.76);
 
+    // values for one line
+    std::vector<double> values;
+
     // read the rest of the file line by line
     while(getline(file, line)){
       ++lineNum;
@@ -108,12 +207,21 @@ namespace radiance{
         // create the header info
         HeaderInfo headerInfo(line1, line2);
 
-        // we can now initialize x and y vectors
-        m_xVector = headerInfo.xVector();
-        m_yVector = headerInfo.yVector();
+        // we can now write the x and y vectors
+        Vector xVector = headerInfo.xVector();
+        Vector yVector = headerInfo.yVector();
 
-        M = m_xVector.size();
-        N = m_yVector.size();
+        M = xVector.size();
+        N = yVector.size();
+
+        for (unsigned i = 0; i < M; ++i){
+          writeCacheValue(os, xVector[i]);
+        }
+        for (unsigned j = 0; j < N; ++j){
+          writeCacheValue(os, yVector[j]);
+        }
+
+        values.resize(recordHeaderSize + M*N);
 
       }else{
 
@@ -134,51 +242,191 @@ namespace radiance{
 
         if (numValues != M*N){
           LOG(Fatal,  "Incorrect number of illuminance values read " << numValues << ", expecting " << M*N << ".");
-          return;
+          complete = false;
+          break;
         }else{
 
-          MonthOfYear month = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          unsigned day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+          values[0] = lexical_cast<unsigned>(lineVector[0]);
+          values[1] = lexical_cast<unsigned>(lineVector[1]);
+          values[2] = lexical_cast<double>(lineVector[2]);
 
           // ignore solar angles and global horizontal for now
 
-          // make the date time
-          DateTime dateTime(Date(month, day), Time(fracDays));
-
-          // matrix we are going to read in
-          Matrix illuminanceMap(M,N);
-
-          // read in the values
-          unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j){
-            for (unsigned i = 0; i < M; ++i){
-              illuminanceMap(i,j) = footcandlesToLux*lexical_cast<double>(lineVector[index]);
-              ++index;
-            }
+          // read in the values, x varies fastest
+          for (unsigned index = 0; index < M*N; ++index){
+            values[recordHeaderSize + index] = footcandlesToLux*lexical_cast<double>(lineVector[6 + index]);
           }
 
-          m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
+          os.write(reinterpret_cast<const char*>(values.data()), values.size()*sizeof(double));
+          ++numRecords;
         }
       }
     }
 
     // close file
     file.close();
+
+    // a file without the header lines has no maps
+    if (lineNum < 2){
+      complete = false;
+    }
+
+    // now the header
+    os.seekp(0);
+    if (complete){
+      os.write(cacheMagic, sizeof(cacheMagic));
+    }else{
+      os.seekp(sizeof(cacheMagic));
+    }
+    long long lastWriteTime = openstudio::filesystem::last_write_time_as_time_t(path);
+    bool timeConclusive = (lastWriteTime + 1 < readStart);
+    std::string sourceChecksum = timeConclusive ? std::string() : openstudio::checksum(path);
+    sourceChecksum.resize(checksumSize, '\0');
+    writeCacheValue<unsigned long long>(os, openstudio::filesystem::file_size(path));
+    writeCacheValue<long long>(os, lastWriteTime);
+    writeCacheValue<unsigned long long>(os, M);
+    writeCacheValue<unsigned long long>(os, N);
+    writeCacheValue<unsigned long long>(os, numRecords);
+    os.write(sourceChecksum.data(), checksumSize);
+    writeCacheValue<unsigned long long>(os, timeConclusive ? 1 : 0);
+    os.seekp(0, std::ios_base::end);
+
+    return complete;
+  }
+
+  bool AnnualIlluminanceMap::openCache(const openstudio::path& path, const openstudio::path& cachePath, bool requireComplete)
+  {
+    if (!exists(cachePath)){
+      return false;
+    }
+
+    std::shared_ptr<QFile> cacheFile = std::make_shared<QFile>(toQString(cachePath));
+    if (!cacheFile->open(QIODevice::ReadOnly)){
+      return false;
+    }
+
+    qint64 size = cacheFile->size();
+    if (size < static_cast<qint64>(cacheHeaderSize)){
+      return false;
+    }
+
+    // the mapping stays valid until the file is closed
+    const uchar* data = cacheFile->map(0, size);
+    if (!data){
+      return false;
+    }
+
+    if (!indexCache(path, reinterpret_cast<const char*>(data), size, requireComplete)){
+      return false;
+    }
+
+    m_cachePath = cachePath;
+    m_cacheFile = cacheFile;
+    return true;
+  }
+
+  bool AnnualIlluminanceMap::indexCache(const openstudio::path& path, const char* data, unsigned long long size, bool requireComplete)
+  {
+    if (size < cacheHeaderSize){
+      return false;
+    }
+
+    if (requireComplete && (std::memcmp(data, cacheMagic, sizeof(cacheMagic)) != 0)){
+      return false;
+    }
+
+    if (readCacheValue<unsigned long long>(data + 8) != openstudio::filesystem::file_size(path)){
+      return false;
+    }
+
+    if (readCacheValue<long long>(data + 16) != openstudio::filesystem::last_write_time_as_time_t(path)){
+      return false;
+    }
+
+    if (readCacheValue<unsigned long long>(data + 56) == 0){
+      std::string sourceChecksum = openstudio::checksum(path);
+      sourceChecksum.resize(checksumSize, '\0');
+      if (std::memcmp(data + 48, sourceChecksum.data(), checksumSize) != 0){
+        return false;
+      }
+    }
+
+    unsigned long long M = readCacheValue<unsigned long long>(data + 24);
+    unsigned long long N = readCacheValue<unsigned long long>(data + 32);
+    unsigned long long numRecords = readCacheValue<unsigned long long>(data + 40);
+    unsigned long long recordSize = (recordHeaderSize + M*N)*sizeof(double);
+    if (size != cacheHeaderSize + (M + N)*sizeof(double) + numRecords*recordSize){
+      return false;
+    }
+
+    const char* position = data + cacheHeaderSize;
+
+    Vector xVector(M);
+    for (unsigned i = 0; i < M; ++i, position += sizeof(double)){
+      xVector[i] = readCacheValue<double>(position);
+    }
+
+    Vector yVector(N);
+    for (unsigned j = 0; j < N; ++j, position += sizeof(double)){
+      yVector[j] = readCacheValue<double>(position);
+    }
+
+    DateTimeVector dateTimes;
+    DateTimeIndexMap dateTimeIndexMap;
+    for (unsigned long long index = 0; index < numRecords; ++index){
+      const char* record = position + index*recordSize;
+      MonthOfYear month = monthOfYear(static_cast<unsigned>(readCacheValue<double>(record)));
+      unsigned day = static_cast<unsigned>(readCacheValue<double>(record + sizeof(double)));
+      double fracDays = readCacheValue<double>(record + 2*sizeof(double)) / 24.0;
+
+      // make the date time
+      DateTime dateTime(Date(month, day), Time(fracDays));
+
+      dateTimes.push_back(dateTime);
+      dateTimeIndexMap[dateTime] = index;
+    }
+
+    m_xVector = xVector;
+    m_yVector = yVector;
+    m_dateTimes = dateTimes;
+    m_dateTimeIndexMap = dateTimeIndexMap;
+    m_values = position;
+    return true;
   }
 
   /// get the illuminance map in lux corresponding to date and time
   openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const
   {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()){
-      return it->second;
+    auto it = m_dateTimeIndexMap.find(dateTime);
+    if (it != m_dateTimeIndexMap.end()){
+      return illuminanceMap(it->second);
     }
 
     return m_nullIlluminanceMap;
   }
 
+  /// get the illuminance map in lux corresponding to dateTimes()[index]
+  openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(unsigned index) const
+  {
+    if (!m_values || index >= m_dateTimes.size()){
+      return m_nullIlluminanceMap;
+    }
+
+    unsigned M = m_xVector.size();
+    unsigned N = m_yVector.size();
+    const char* record = m_values + static_cast<unsigned long long>(index)*(recordHeaderSize + M*N)*sizeof(double);
+    const char* position = record + recordHeaderSize*sizeof(double);
+
+    Matrix illuminanceMap(M,N);
+    for (unsigned j = 0; j < N; ++j){
+      for (unsigned i = 0; i < M; ++i, position += sizeof(double)){
+        illuminanceMap(i,j) = readCacheValue<double>(position);
+      }
+    }
+
+    return illuminanceMap;
+  }
+
 
 } // radiance
 } // openstudio
@@ -38,19 +38,31 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
 
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+
+class QFile;
+
 namespace openstudio{
 namespace radiance{
 
   /** AnnualIlluminanceMap represents illuminance map for an entire year.
   *   We assume that the output files is from SPOT, with length in meters and illuminance
   *   values in footcandles.  All illuminance values are converted to lux.
+  *
+  *   The first time a file is read its values are written to a binary cache next to it, the
+  *   original path with '.cache' appended, which is memory mapped and reused while the source
+  *   file is unchanged.  Illuminance maps are only created from the cache when requested, so
+  *   annual maps for large grids do not need to fit in memory.
   */
   class RADIANCE_API AnnualIlluminanceMap
   {
     private:
 
-      // map of DateTime to Matrix (illuminance map)
-      typedef std::map<openstudio::DateTime, openstudio::Matrix> DateTimeIlluminanceMap;
+      // map of DateTime to index of the illuminance map in the cache
+      typedef std::map<openstudio::DateTime, unsigned> DateTimeIndexMap;
 
     public:
 
@@ -76,17 +88,37 @@ namespace radiance{
       /// get the illuminance map in lux corresponding to date and time
       openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
+      /// get the illuminance map in lux corresponding to dateTimes()[index], use to iterate over the year
+      openstudio::Matrix illuminanceMap(unsigned index) const;
+
+      /// get the path to the binary cache, empty if the cache is only held in memory
+      openstudio::path cachePath() const {return m_cachePath;}
+
     private:
 
       REGISTER_LOGGER("radiance.AnnualIlluminanceMap");
 
       void init(const openstudio::path& path);
 
+      // write the binary cache for the text file at path, returns false if the text file could not be completely read
+      bool writeCache(const openstudio::path& path, std::ostream& os) const;
+
+      // map the cache file, returns false if it is missing or does not match the text file at path
+      bool openCache(const openstudio::path& path, const openstudio::path& cachePath, bool requireComplete);
+
+      // read the cache header and index the illuminance maps, returns false if data is not a cache for the text file at path
+      bool indexCache(const openstudio::path& path, const char* data, unsigned long long size, bool requireComplete);
+
       openstudio::DateTimeVector m_dateTimes;
       openstudio::Vector m_xVector;
       openstudio::Vector m_yVector;
       openstudio::Matrix m_nullIlluminanceMap; // used when there is no data
-      DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+      DateTimeIndexMap m_dateTimeIndexMap;
+
+      openstudio::path m_cachePath;
+      std::shared_ptr<QFile> m_cacheFile; // mapped cache, shared between copies
+      std::shared_ptr<std::string> m_cacheBuffer; // cache held in memory if the cache file could not be written
+      const char* m_values; // first illuminance record in the cache
   };
 
 } // radiance
@@ -92,15 +92,19 @@
 
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string/regex.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
 #include <boost/math/constants/constants.hpp>
 
 
 
+#include <cstdio>
 #include <cstring>
 #include <cmath>
 #include <sstream>
 #include <iterator>
 #include <algorithm>
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <math.h>
@@ -136,33 +140,95 @@ static RadianceResourceInitializer __radianceResourceInitializer__;
 namespace openstudio {
 namespace radiance {
 
-  // internal method used to format doubles as strings
-  std::string formatString(double t_d, unsigned t_prec)
-  {
-    std::stringstream ss;
-    ss << std::setprecision(t_prec) << std::noshowpoint << std::fixed << t_d;
-    std::string s = ss.str();
+  namespace {
 
-    /*
-    // truncate 0's from the end
-    int i = s.size() - 1;
-    while (i > 0 && s[i] == '0')
+    // writes finished space geometry on a background thread so disk io overlaps translation of the next space
+    class AsyncFileWriter
     {
-      --i;
-    }
+     public:
 
-    if (i > 0)
-    {
-      s.erase(i + 1);
+      AsyncFileWriter()
+        : m_done(false), m_thread(boost::bind(&AsyncFileWriter::run, this))
+      {}
+
+      // waits for all queued writes to complete
+      ~AsyncFileWriter()
+      {
+        {
+          boost::mutex::scoped_lock lock(m_mutex);
+          m_done = true;
+        }
+        m_condition.notify_one();
+        m_thread.join();
+      }
+
+      void write(const std::shared_ptr<OFSTREAM>& file, std::string&& contents)
+      {
+        {
+          boost::mutex::scoped_lock lock(m_mutex);
+          m_queue.push_back(std::make_pair(file, std::move(contents)));
+        }
+        m_condition.notify_one();
+      }
+
+     private:
 
-      if (*s.rbegin() == '.')
+      void run()
       {
-        s.push_back('0');
+        boost::mutex::scoped_lock lock(m_mutex);
+        while (true){
+          while (!m_done && m_queue.empty()){
+            m_condition.wait(lock);
+          }
+          if (m_queue.empty()){
+            return;
+          }
+          std::pair<std::shared_ptr<OFSTREAM>, std::string> item = std::move(m_queue.front());
+          m_queue.pop_front();
+
+          lock.unlock();
+          *item.first << item.second;
+          item.first->close();
+          lock.lock();
+        }
+      }
+
+      boost::mutex m_mutex;
+      boost::condition_variable m_condition;
+      std::deque<std::pair<std::shared_ptr<OFSTREAM>, std::string> > m_queue;
+      bool m_done;
+      boost::thread m_thread;
+    };
+
+  }
+
+  // internal method used to format doubles as strings
+  std::string formatString(double t_d, unsigned t_prec)
+  {
+    // same output as streaming with std::fixed and std::setprecision(t_prec), without the stream
+    char buffer[64];
+    int n = std::snprintf(buffer, sizeof(buffer), "%.*f", static_cast<int>(t_prec), t_d);
+    std::string result;
+    if (n >= 0 && n < static_cast<int>(sizeof(buffer))){
+      result.assign(buffer, n);
+    }else if (n >= 0){
+      std::vector<char> large(n + 1);
+      std::snprintf(large.data(), large.size(), "%.*f", static_cast<int>(t_prec), t_d);
+      result.assign(large.data(), n);
+    }
+
+    // snprintf uses the decimal separator of the C locale, which QCoreApplication sets from the environment on
+    // Unix, but Radiance always expects a '.'.  %f does not group digits, so in a finite number anything other
+    // than the sign and the digits is the (possibly multibyte) separator.
+    if (std::isfinite(t_d)){
+      std::string::size_type separator = result.find_first_not_of("-0123456789");
+      if (separator != std::string::npos && result[separator] != '.'){
+        std::string::size_type fraction = result.find_first_of("0123456789", separator);
+        result.replace(separator, (fraction == std::string::npos ? result.size() : fraction) - separator, ".");
       }
     }
-    */
 
-    return s;
+    return result;
   }
 
   // internal method used to format all other types as strings
@@ -1078,6 +1144,7 @@ namespace radiance {
   {
     std::vector<std::string> space_names;
 
+    AsyncFileWriter spaceWriter;
 
     for (const auto & space : t_spaces)
     {
@@ -1087,7 +1154,8 @@ namespace radiance {
       LOG(Debug, "Processing space: " << space_name);
 
       // split model into zone-based Radiance .rad files
-      m_radSpaces[space_name] = "#\n# geometry file for space: " + space_name + "\n#\n\n";
+      std::string& radSpace = m_radSpaces[space_name];
+      radSpace = "#\n# geometry file for space: " + space_name + "\n#\n\n";
 
       // loop over surfaces in space
 
@@ -1104,11 +1172,11 @@ namespace radiance {
         std::string surface_name = cleanName(surface.name().get());
 
         // add surface to space geometry
-        m_radSpaces[space_name] += "# surface: " + surface_name + "\n";
+        radSpace += "# surface: " + surface_name + "\n";
 
         // set construction of surface
         std::string constructionName = surface.getString(2).get();
-        m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+        radSpace += "# construction: " + constructionName + "\n";
 
         // get reflectances
         double interiorVisibleReflectance = 0.5; // default for space surfaces
@@ -1130,7 +1198,7 @@ namespace radiance {
           // 2-sided material
 
           // header
-          m_radSpaces[space_name] += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3) + \
+          radSpace += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3) + \
           "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
 
           // material definition
@@ -1152,14 +1220,14 @@ namespace radiance {
               "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
           // polygon reference
-          m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
+          radSpace += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
               "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + " polygon " + \
               surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
         }else{
           // interior-only material
 
           // header
-          m_radSpaces[space_name] += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+          radSpace += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
           // material definition
           m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3)
@@ -1168,7 +1236,7 @@ namespace radiance {
             + " " + formatString(interiorVisibleReflectance, 3) + " 0 0\n");
 
           // polygon reference
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3)
+          radSpace += "refl_" + formatString(interiorVisibleReflectance, 3)
           + " polygon " + surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
         };
@@ -1177,11 +1245,11 @@ namespace radiance {
         // add polygon vertices
         for (const auto & vertex : polygon)
         {
-          m_radSpaces[space_name] += formatString(vertex.x()) + " "
+          radSpace += formatString(vertex.x()) + " "
             + formatString(vertex.y()) + " "
             + formatString(vertex.z()) + "\n";
         }
-        m_radSpaces[space_name] += "\n";
+        radSpace += "\n";
 
         // end(surface)
 
@@ -1429,20 +1497,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                         formatString(exteriorVisibleReflectance, 3) + " " + \
                                         formatString(exteriorVisibleReflectance, 3) + " " + \
                                         formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(exteriorVisibleReflectance, 3) + " polygon outside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  radSpace += "refl_" + formatString(exteriorVisibleReflectance, 3) + " polygon outside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
+                  radSpace += "0\n0\n" + formatString(4 * 3) + "\n";
+                  radSpace += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  radSpace += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  radSpace += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  radSpace += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
 
                 // make interior sill/reveal surfaces
@@ -1459,20 +1527,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  radSpace += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
+                  radSpace += "0\n0\n" + formatString(4 * 3) + "\n";
+                  radSpace += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  radSpace += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  radSpace += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  radSpace += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
 
                 if (insideSillDepth && (*insideSillDepth > 0.0)){
@@ -1488,20 +1556,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_sill_" + subSurface_name + formatString(i, 0) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  radSpace += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_sill_" + subSurface_name + formatString(i, 0) + "\n";
+                  radSpace += "0\n0\n" + formatString(4 * 3) + "\n";
+                  radSpace += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  radSpace += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  radSpace += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  radSpace += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
               }
             }
@@ -1763,20 +1831,20 @@ namespace radiance {
             double interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
             double exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
             //polygon header
-            m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-            m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+            radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+            radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
             // write material
             m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
               formatString(interiorVisibleReflectance, 3) + " " + \
               formatString(interiorVisibleReflectance, 3) + " " + \
               formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
             // write polygon
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
-            m_radSpaces[space_name] += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
+            radSpace += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
+            radSpace += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
 
             for (const auto & vertex : polygon)
             {
-              m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+              radSpace += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
             }
 
           } else if (subSurfaceUpCase == "TUBULARDAYLIGHTDOME") {
@@ -1804,11 +1872,11 @@ namespace radiance {
           std::string shadingSurface_name = cleanName(shadingSurface.name().get());
 
           // add surface to zone geometry
-          m_radSpaces[space_name] += "# surface: " + shadingSurface_name + "\n";
+          radSpace += "# surface: " + shadingSurface_name + "\n";
 
           // set construction of space shadingSurface
           std::string constructionName = shadingSurface.getString(2).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+          radSpace += "# construction: " + constructionName + "\n";
 
           // get reflectance
           double interiorVisibleReflectance = 0.25; // default for space shading surfaces
@@ -1840,21 +1908,21 @@ namespace radiance {
               "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
           // polygon header
-          m_radSpaces[space_name] += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+          radSpace += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
+          radSpace += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
           // get / write surface polygon
 
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
-          m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
+          radSpace += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
               "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + " polygon " + \
           shadingSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
           for (const auto & vertex : polygon)
           {
-            m_radSpaces[space_name] += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+            radSpace += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
           }
-          m_radSpaces[space_name] += "\n";
+          radSpace += "\n";
 
         }
       } // end shading surfaces
@@ -1883,11 +1951,11 @@ namespace radiance {
 
           // add surface to zone geometry
 
-          m_radSpaces[space_name] += "# surface: " + interiorPartitionSurface_name + "\n";
+          radSpace += "# surface: " + interiorPartitionSurface_name + "\n";
 
           // set construction of interiorPartitionSurface
           std::string constructionName = interiorPartitionSurface.getString(1).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+          radSpace += "# construction: " + constructionName + "\n";
 
          // get reflectance
           double interiorVisibleReflectance = 0.5; // set some default
@@ -1908,16 +1976,16 @@ namespace radiance {
             formatString(interiorVisibleReflectance, 3) + " " + \
             formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
           // polygon header
-          m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+          radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+          radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
           // get / write surface polygon
 
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(interiorPartitionSurface);
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
+          radSpace += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
           interiorPartitionSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
           for (const auto & vertex : polygon)
           {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+            radSpace += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
           }
         }
       } // end interior partitions
@@ -2105,17 +2173,22 @@ namespace radiance {
       } //end illuminance map
 
 
-      // write geometry
+      // write geometry, contents are handed off to the writer so the space's buffer is released
       openstudio::path filename = t_radDir / openstudio::toPath("scene") / openstudio::toPath(space_name + ".rad");
-      OFSTREAM file(filename);
-      if (file.is_open()){
+      std::shared_ptr<OFSTREAM> file = std::make_shared<OFSTREAM>(filename);
+      if (file->is_open()){
         t_outfiles.push_back(filename);
         m_radSceneFiles.push_back(filename);
-        file << m_radSpaces[space_name];
+        spaceWriter.write(file, std::move(radSpace));
+        radSpace.clear();
       } else{
         LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
       }
+    }
 
+    // window groups, materials, and the scene only need to be written once all spaces are translated
+    if (!t_spaces.empty())
+    {
       for (const auto & windowGroup : m_windowGroups)
       {
         std::string windowGroup_name = windowGroup.name();
@@ -31,12 +31,20 @@
 
 #include "../AnnualIlluminanceMap.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
+
 #include <resources.hxx>
 
+#include <cctype>
+#include <ctime>
+#include <iterator>
+#include <string>
+
 
 
 using namespace std;
 using namespace boost;
+using namespace openstudio;
 using namespace openstudio::radiance;
 using openstudio::toPath;
 
@@ -80,3 +88,85 @@ TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap)
 
 }
 
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Cache)
+{
+  openstudio::DateTimeVector dateTimes = outFile.dateTimes();
+  ASSERT_FALSE(dateTimes.empty());
+  unsigned M = outFile.xVector().size();
+  unsigned N = outFile.yVector().size();
+
+  // maps are the same by date and time or by index
+  for (unsigned index = 0; index < dateTimes.size(); ++index){
+    openstudio::Matrix illuminanceMap = outFile.illuminanceMap(index);
+    ASSERT_EQ(M, illuminanceMap.size1());
+    ASSERT_EQ(N, illuminanceMap.size2());
+    EXPECT_TRUE(illuminanceMap == outFile.illuminanceMap(dateTimes[index]));
+  }
+  EXPECT_EQ(0u, outFile.illuminanceMap(static_cast<unsigned>(dateTimes.size())).size1());
+
+  // reading again uses the cache written by the fixture
+  openstudio::path path = resourcesPath() / toPath("radiance/Daylighting/annual_day.ill");
+  AnnualIlluminanceMap cached(path);
+  EXPECT_FALSE(cached.cachePath().empty());
+  EXPECT_EQ(outFile.cachePath(), cached.cachePath());
+  ASSERT_EQ(dateTimes.size(), cached.dateTimes().size());
+  EXPECT_TRUE(outFile.xVector() == cached.xVector());
+  EXPECT_TRUE(outFile.yVector() == cached.yVector());
+  for (unsigned index = 0; index < dateTimes.size(); ++index){
+    EXPECT_EQ(dateTimes[index], cached.dateTimes()[index]);
+    EXPECT_TRUE(outFile.illuminanceMap(index) == cached.illuminanceMap(index));
+  }
+}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_CacheReplaced)
+{
+  openstudio::path sourcePath = resourcesPath() / toPath("radiance/Daylighting/annual_day.ill");
+  openstudio::path path = openstudio::tempDir() / toPath("AnnualIlluminanceMap_CacheReplaced.ill");
+  openstudio::path cachePath = toPath(openstudio::toString(path) + ".cache");
+  openstudio::filesystem::remove(cachePath);
+  openstudio::filesystem::copy_file(sourcePath, path, openstudio::filesystem::copy_option::overwrite_if_exists);
+
+  // a file time in the future is never conclusive, so the cache has to notice edits that keep size and time
+  std::time_t lastWriteTime = std::time(nullptr) + 3600;
+  openstudio::filesystem::last_write_time(path, lastWriteTime);
+
+  AnnualIlluminanceMap original(path);
+  EXPECT_EQ(cachePath, original.cachePath());
+  ASSERT_FALSE(original.dateTimes().empty());
+  openstudio::Matrix originalMap = original.illuminanceMap(0u);
+
+  // change the first digit of the first illuminance value of the first map
+  std::string contents;
+  {
+    openstudio::filesystem::ifstream file(path, std::ios_base::binary);
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  std::string::size_type position = contents.find('\n', contents.find('\n') + 1) + 1;
+  for (unsigned token = 0; token < 6; ++token){
+    position = contents.find_first_not_of(' ', position);
+    position = contents.find(' ', position);
+  }
+  position = contents.find_first_not_of(' ', position);
+  ASSERT_NE(std::string::npos, position);
+  ASSERT_TRUE(std::isdigit(static_cast<unsigned char>(contents[position])));
+  contents[position] = (contents[position] == '1') ? '2' : '1';
+  {
+    openstudio::filesystem::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+    file << contents;
+  }
+  openstudio::filesystem::last_write_time(path, lastWriteTime);
+
+  AnnualIlluminanceMap edited(path);
+  EXPECT_EQ(cachePath, edited.cachePath());
+  ASSERT_EQ(original.dateTimes().size(), edited.dateTimes().size());
+  EXPECT_FALSE(originalMap == edited.illuminanceMap(0u));
+  EXPECT_TRUE(original.illuminanceMap(1u) == edited.illuminanceMap(1u));
+
+  // the cache mapped by the first instance was replaced, not rewritten
+  EXPECT_TRUE(originalMap == original.illuminanceMap(0u));
+
+  // no temporary files are left behind
+  for (openstudio::filesystem::directory_iterator it(openstudio::tempDir()), end; it != end; ++it){
+    EXPECT_NE(0u, it->path().filename().string().find("AnnualIlluminanceMap_CacheReplaced.ill.cache-")) << it->path();
+  }
+}
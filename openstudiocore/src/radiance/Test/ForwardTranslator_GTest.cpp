@@ -55,6 +55,10 @@
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/FenestrationSurface_Detailed_FieldEnums.hxx>
 
+#include <cctype>
+#include <clocale>
+#include <locale>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::radiance;
@@ -324,4 +328,67 @@ TEST(Radiance, ForwardTranslator_formatString)
   EXPECT_EQ("0", formatString(0.4412345, 0));
   EXPECT_EQ("0.4", formatString(0.4412345, 1));
   EXPECT_EQ("0.44", formatString(0.4412345, 2));
+
+  EXPECT_EQ("-44.68", formatString(-44.6789, 2));
+  EXPECT_EQ("-0.000", formatString(-0.0001, 3));
+  EXPECT_EQ("123456789.000", formatString(123456789.0, 3));
+  EXPECT_EQ("0.100000000000000", formatString(0.1));
+}
+
+namespace {
+
+  struct CommaDecimalPoint : public std::numpunct<char>
+  {
+    virtual char do_decimal_point() const override { return ','; }
+  };
+
+  // true if text contains a number written with a comma decimal separator
+  bool hasCommaDecimal(const std::string& text)
+  {
+    for (size_t i = 1; i + 1 < text.size(); ++i){
+      if (text[i] == ',' && std::isdigit(static_cast<unsigned char>(text[i - 1])) && std::isdigit(static_cast<unsigned char>(text[i + 1]))){
+        return true;
+      }
+    }
+    return false;
+  }
+
+}
+
+TEST(Radiance, ForwardTranslator_formatString_Locale)
+{
+  // QCoreApplication sets the C locale from the environment on Unix, use a comma decimal one if installed
+  std::string oldCLocale = setlocale(LC_ALL, nullptr);
+  for (const char* name : {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR.utf8", "German_Germany.1252"}){
+    if (setlocale(LC_ALL, name)){
+      break;
+    }
+  }
+  std::locale oldLocale = std::locale::global(std::locale(std::locale::classic(), new CommaDecimalPoint));
+
+  EXPECT_EQ("44.12", formatString(44.12345, 2));
+  EXPECT_EQ("-0.000", formatString(-0.0001, 3));
+  EXPECT_EQ("0.100000000000000", formatString(0.1));
+
+  Model model = exampleModel();
+  openstudio::path outpath = openstudio::tempDir() / toPath("ForwardTranslator_formatString_Locale");
+  openstudio::filesystem::remove_all(outpath);
+
+  ForwardTranslator ft;
+  std::vector<path> outpaths = ft.translateModel(outpath, model);
+
+  std::locale::global(oldLocale);
+  setlocale(LC_ALL, oldCLocale.c_str());
+
+  EXPECT_FALSE(outpaths.empty());
+  unsigned numRadFiles = 0;
+  for (openstudio::filesystem::recursive_directory_iterator it(outpath), end; it != end; ++it){
+    if (openstudio::filesystem::is_regular_file(it->path()) && it->path().extension() == toPath(".rad")){
+      ++numRadFiles;
+      openstudio::filesystem::ifstream file(it->path());
+      std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      EXPECT_FALSE(hasCommaDecimal(text)) << toString(it->path());
+    }
+  }
+  EXPECT_LT(0u, numRadFiles);
 }
@@ -337,7 +337,7 @@ namespace sdd {
       spaceName = escapeName(nameElement.text());
     }
 
-    boost::optional<model::Space> space = buildingStory.model().getModelObjectByName<model::Space>(spaceName);
+    boost::optional<model::Space> space = getModelObjectByName<model::Space>(buildingStory.model(), spaceName);
     if (!space){
       LOG(Error, "Could not retrieve Space named '" << spaceName << "'.");
       return boost::none;
@@ -353,7 +353,7 @@ namespace sdd {
       thermalZoneName = escapeName(thermalZoneElement.text());
     }
 
-    boost::optional<model::ThermalZone> thermalZone = space->model().getModelObjectByName<model::ThermalZone>(thermalZoneName);
+    boost::optional<model::ThermalZone> thermalZone = getModelObjectByName<model::ThermalZone>(space->model(), thermalZoneName);
     if (thermalZone){
       space->setThermalZone(*thermalZone);
     } else{
@@ -496,7 +496,7 @@ namespace sdd {
 
       equipment.setName(spaceName + " Water Use Equipment");
 
-      if( boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(hotWtrHtgSchRefElement.text().toStdString()) )
+      if( boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, hotWtrHtgSchRefElement.text().toStdString()) )
       {
         equipment.setFlowRateFractionSchedule(schedule.get());
       }
@@ -586,7 +586,7 @@ namespace sdd {
 
           if (!occSchRefElement.isNull()){
             std::string scheduleName = escapeName(occSchRefElement.text());
-            boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+            boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
             if (schedule){
               people.setNumberofPeopleSchedule(*schedule);
             }else{
@@ -672,7 +672,7 @@ namespace sdd {
 
             if (!infSchRefElement.isNull()){
               std::string scheduleName = escapeName(infSchRefElement.text());
-              boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+              boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
               if (schedule){
                 spaceInfiltrationDesignFlowRate.setSchedule(*schedule);
               }else{
@@ -753,7 +753,7 @@ namespace sdd {
 
         if (!intLtgRegSchRefElement.isNull()){
           std::string scheduleName = escapeName(intLtgRegSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             lights.setSchedule(*schedule);
           }else{
@@ -803,7 +803,7 @@ namespace sdd {
 
         if (!intLtgNonRegSchRefElement.isNull()){
           std::string scheduleName = escapeName(intLtgNonRegSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             lights.setSchedule(*schedule);
           }else{
@@ -868,7 +868,7 @@ namespace sdd {
 
         if (!recptPwrDensSchRefElement.isNull()){
           std::string scheduleName = escapeName(recptPwrDensSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -920,7 +920,7 @@ namespace sdd {
 
         if (!gasEqpPwrDensSchRefElement.isNull()){
           std::string scheduleName = escapeName(gasEqpPwrDensSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             gasEquipment.setSchedule(*schedule);
           }else{
@@ -971,7 +971,7 @@ namespace sdd {
 
         if (!procElecSchRefElement.isNull()){
           std::string scheduleName = escapeName(procElecSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -1022,7 +1022,7 @@ namespace sdd {
 
         if (!commRfrgEqpSchRefElement.isNull()){
           std::string scheduleName = escapeName(commRfrgEqpSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -1068,7 +1068,7 @@ namespace sdd {
 
         if (!elevSchRefElement.isNull()){
           std::string scheduleName = escapeName(elevSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -1114,7 +1114,7 @@ namespace sdd {
 
         if (!escalSchRefElement.isNull()){
           std::string scheduleName = escapeName(escalSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -1165,7 +1165,7 @@ namespace sdd {
 
         if (!procGasSchRefElement.isNull()){
           std::string scheduleName = escapeName(procGasSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             gasEquipment.setSchedule(*schedule);
           }else{
@@ -1308,7 +1308,7 @@ namespace sdd {
     QDomElement constructionReferenceElement = element.firstChildElement("ConsAssmRef");
     if(!constructionReferenceElement.isNull()){
       std::string constructionName = escapeName(constructionReferenceElement.text());
-      boost::optional<model::ConstructionBase> construction = space.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+      boost::optional<model::ConstructionBase> construction = getModelObjectByName<model::ConstructionBase>(space.model(), constructionName);
       if(construction){
         surface.setConstruction(*construction);
       }else{
@@ -1436,7 +1436,7 @@ namespace sdd {
     QDomElement adjacentSpaceElement = element.firstChildElement("AdjacentSpcRef");
     if (!adjacentSpaceElement.isNull()){
       std::string adjacentSpaceName = escapeName(adjacentSpaceElement.text());
-      boost::optional<model::Space> otherSpace = space.model().getModelObjectByName<model::Space>(adjacentSpaceName);
+      boost::optional<model::Space> otherSpace = getModelObjectByName<model::Space>(space.model(), adjacentSpaceName);
 
       if (!otherSpace){
         LOG(Error, "Cannot retrieve adjacent Space '" << adjacentSpaceName << "' for Surface named '" << name << "'");
@@ -1539,7 +1539,7 @@ namespace sdd {
       QDomElement constructionReferenceElement = element.firstChildElement("FenConsRef");
       if(!constructionReferenceElement.isNull()){
         std::string constructionName = escapeName(constructionReferenceElement.text());
-        boost::optional<model::ConstructionBase> construction = surface.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+        boost::optional<model::ConstructionBase> construction = getModelObjectByName<model::ConstructionBase>(surface.model(), constructionName);
         if(construction){
           subSurface.setConstruction(*construction);
         }else{
@@ -1557,7 +1557,7 @@ namespace sdd {
       QDomElement constructionReferenceElement = element.firstChildElement("DrConsRef");
       if(!constructionReferenceElement.isNull()){
         std::string constructionName = escapeName(constructionReferenceElement.text());
-        boost::optional<model::ConstructionBase> construction = surface.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+        boost::optional<model::ConstructionBase> construction = getModelObjectByName<model::ConstructionBase>(surface.model(), constructionName);
         if(construction){
           subSurface.setConstruction(*construction);
         }else{
@@ -1575,7 +1575,7 @@ namespace sdd {
       QDomElement constructionReferenceElement = element.firstChildElement("FenConsRef");
       if(!constructionReferenceElement.isNull()){
         std::string constructionName = escapeName(constructionReferenceElement.text());
-        boost::optional<model::ConstructionBase> construction = surface.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+        boost::optional<model::ConstructionBase> construction = getModelObjectByName<model::ConstructionBase>(surface.model(), constructionName);
         if(construction){
           subSurface.setConstruction(*construction);
         }else{
@@ -1702,7 +1702,7 @@ namespace sdd {
           QDomElement scheduleReferenceElement = element.firstChildElement("TransSchRef");
           if (!scheduleReferenceElement.isNull()){
             scheduleName = escapeName(scheduleReferenceElement.text());
-            schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+            schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
             if (!schedule){
               LOG(Error, "Cannot find shading schedule '" << scheduleName << "' for shading surface '" << name << "'");
             }
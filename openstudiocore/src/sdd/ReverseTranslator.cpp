@@ -29,6 +29,7 @@
 
 #include "ReverseTranslator.hpp"
 #include "../model/Model.hpp"
+#include "../model/Model_Impl.hpp"
 #include "../model/Component.hpp"
 #include "../model/ModelObject.hpp"
 #include "../model/ModelObject_Impl.hpp"
@@ -88,6 +89,26 @@
 #include "../model/SiteWaterMainsTemperature_Impl.hpp"
 #include "../model/Schedule.hpp"
 #include "../model/Schedule_Impl.hpp"
+#include "../model/ScheduleDay.hpp"
+#include "../model/ScheduleDay_Impl.hpp"
+#include "../model/ScheduleWeek.hpp"
+#include "../model/ScheduleWeek_Impl.hpp"
+#include "../model/ScheduleTypeLimits.hpp"
+#include "../model/ScheduleTypeLimits_Impl.hpp"
+#include "../model/Curve.hpp"
+#include "../model/Curve_Impl.hpp"
+#include "../model/CurveBiquadratic.hpp"
+#include "../model/CurveBiquadratic_Impl.hpp"
+#include "../model/CurveCubic.hpp"
+#include "../model/CurveCubic_Impl.hpp"
+#include "../model/CurveQuadratic.hpp"
+#include "../model/CurveQuadratic_Impl.hpp"
+#include "../model/Material.hpp"
+#include "../model/Material_Impl.hpp"
+#include "../model/ConstructionBase_Impl.hpp"
+#include "../model/Space.hpp"
+#include "../model/Space_Impl.hpp"
+#include "../model/AirConditionerVariableRefrigerantFlow_Impl.hpp"
 #include "../model/Splitter.hpp"
 #include "../model/Splitter_Impl.hpp"
 #include "../model/Mixer.hpp"
@@ -117,6 +138,7 @@
 #include "../energyplus/ReverseTranslator.hpp"
 #include "../osversion/VersionTranslator.hpp"
 #include "../utilities/filetypes/EpwFile.hpp"
+#include "../utilities/idf/IdfObject_Impl.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
@@ -136,6 +158,8 @@
 #include <QDomElement>
 #include <QThread>
 
+#include <boost/algorithm/string.hpp>
+
 namespace openstudio {
 namespace sdd {
 
@@ -228,7 +252,179 @@ namespace sdd {
 
   boost::optional<model::Model> ReverseTranslator::convert(const QDomDocument& doc)
   {
-    return translateSDD(doc.documentElement(), doc);
+    indexElements(doc);
+
+    boost::optional<model::Model> result = translateSDD(doc.documentElement(), doc);
+
+    clearElementIndex();
+
+    return result;
+  }
+
+  void ReverseTranslator::indexElements(const QDomDocument& doc)
+  {
+    clearElementIndex();
+
+    QDomElement projectElement = doc.documentElement().firstChildElement("Proj");
+
+    QDomNodeList znSysElements = projectElement.elementsByTagName("ZnSys");
+    for (int i = 0; i < znSysElements.count(); i++){
+      QDomElement znSysElement = znSysElements.at(i).toElement();
+      m_znSysElements.insert(std::make_pair(znSysElement.firstChildElement("Name").text(), znSysElement));
+    }
+
+    QDomNodeList thrmlZnElements = projectElement.elementsByTagName("ThrmlZn");
+    for (int i = 0; i < thrmlZnElements.count(); i++){
+      QDomElement thrmlZnElement = thrmlZnElements.at(i).toElement();
+      m_thrmlZnElements.insert(std::make_pair(thrmlZnElement.firstChildElement("Name").text().toLower(), thrmlZnElement));
+    }
+
+    QDomNodeList airSysElements = doc.documentElement().elementsByTagName("AirSys");
+    for (int i = 0; i < airSysElements.count(); i++){
+      QDomElement airSysElement = airSysElements.at(i).toElement();
+      m_airSysElements.insert(std::make_pair(airSysElement.firstChildElement("Name").text().toLower(), airSysElement));
+
+      QDomNodeList trmlUnitElements = airSysElement.elementsByTagName("TrmlUnit");
+      for (int j = 0; j < trmlUnitElements.count(); j++){
+        QDomElement trmlUnitElement = trmlUnitElements.at(j).toElement();
+        m_trmlUnitElementsByZone.insert(std::make_pair(trmlUnitElement.firstChildElement("ZnServedRef").text().toLower(), trmlUnitElement));
+      }
+    }
+
+    QDomNodeList fluidSysElements = projectElement.elementsByTagName("FluidSys");
+    for (int i = 0; i < fluidSysElements.count(); i++){
+      QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
+      bool isServiceHotWater = (fluidSysElement.firstChildElement("Type").text().toLower() == "servicehotwater");
+
+      QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
+      for (int j = 0; j < fluidSegmentElements.count(); j++){
+        QDomElement fluidSegmentElement = fluidSegmentElements.at(j).toElement();
+        QString type = fluidSegmentElement.firstChildElement("Type").text().toLower();
+        if( type != "secondarysupply" && type != "primarysupply" ) {
+          continue;
+        }
+
+        QString name = fluidSegmentElement.firstChildElement("Name").text().toLower();
+        m_supplySegmentElements.insert(std::make_pair(name, fluidSegmentElement));
+        if( isServiceHotWater ) {
+          m_serviceHotWaterFluidSysElements.insert(std::make_pair(name, fluidSysElement));
+        }
+      }
+    }
+  }
+
+  void ReverseTranslator::clearElementIndex()
+  {
+    m_znSysElements.clear();
+    m_airSysElements.clear();
+    m_trmlUnitElementsByZone.clear();
+    m_thrmlZnElements.clear();
+    m_supplySegmentElements.clear();
+    m_serviceHotWaterFluidSysElements.clear();
+  }
+
+  template <typename T>
+  boost::optional<T> ReverseTranslator::getModelObjectByName(const model::Model& model, const std::string& name)
+  {
+    indexModelObjectNames(model);
+
+    std::string key = boost::to_upper_copy(name);
+
+    auto it = m_modelObjectsByName.find(key);
+    if( it != m_modelObjectsByName.end() ) {
+      for( const auto& handle : it->second ) {
+        // the object may have been removed or renamed since it was indexed
+        if( boost::optional<T> modelObject = model.getModelObject<T>(handle) ) {
+          boost::optional<std::string> currentName = modelObject->name();
+          if( currentName && istringEqual(*currentName, name) ) {
+            return modelObject;
+          }
+        }
+      }
+    }
+
+    return boost::none;
+  }
+
+  template boost::optional<model::AirConditionerVariableRefrigerantFlow> ReverseTranslator::getModelObjectByName<model::AirConditionerVariableRefrigerantFlow>(const model::Model&, const std::string&);
+  template boost::optional<model::AirLoopHVAC> ReverseTranslator::getModelObjectByName<model::AirLoopHVAC>(const model::Model&, const std::string&);
+  template boost::optional<model::ConstructionBase> ReverseTranslator::getModelObjectByName<model::ConstructionBase>(const model::Model&, const std::string&);
+  template boost::optional<model::Curve> ReverseTranslator::getModelObjectByName<model::Curve>(const model::Model&, const std::string&);
+  template boost::optional<model::CurveBiquadratic> ReverseTranslator::getModelObjectByName<model::CurveBiquadratic>(const model::Model&, const std::string&);
+  template boost::optional<model::CurveCubic> ReverseTranslator::getModelObjectByName<model::CurveCubic>(const model::Model&, const std::string&);
+  template boost::optional<model::CurveQuadratic> ReverseTranslator::getModelObjectByName<model::CurveQuadratic>(const model::Model&, const std::string&);
+  template boost::optional<model::Material> ReverseTranslator::getModelObjectByName<model::Material>(const model::Model&, const std::string&);
+  template boost::optional<model::PlantLoop> ReverseTranslator::getModelObjectByName<model::PlantLoop>(const model::Model&, const std::string&);
+  template boost::optional<model::Schedule> ReverseTranslator::getModelObjectByName<model::Schedule>(const model::Model&, const std::string&);
+  template boost::optional<model::ScheduleDay> ReverseTranslator::getModelObjectByName<model::ScheduleDay>(const model::Model&, const std::string&);
+  template boost::optional<model::ScheduleTypeLimits> ReverseTranslator::getModelObjectByName<model::ScheduleTypeLimits>(const model::Model&, const std::string&);
+  template boost::optional<model::ScheduleWeek> ReverseTranslator::getModelObjectByName<model::ScheduleWeek>(const model::Model&, const std::string&);
+  template boost::optional<model::Space> ReverseTranslator::getModelObjectByName<model::Space>(const model::Model&, const std::string&);
+  template boost::optional<model::ThermalZone> ReverseTranslator::getModelObjectByName<model::ThermalZone>(const model::Model&, const std::string&);
+
+  // Re-queues an indexed object for indexing under its new name when it is renamed
+  class ReverseTranslator::ModelObjectNameWatcher : public Nano::Observer
+  {
+   public:
+
+    ModelObjectNameWatcher(ReverseTranslator& translator, const WorkspaceObject& object)
+      : m_translator(translator), m_handle(object.handle())
+    {
+      object.getImpl<openstudio::detail::IdfObject_Impl>()->onNameChange.connect<ModelObjectNameWatcher, &ModelObjectNameWatcher::onNameChange>(this);
+    }
+
+    void onNameChange()
+    {
+      m_translator.m_unindexedModelObjects.push_back(m_handle);
+    }
+
+   private:
+
+    ReverseTranslator& m_translator;
+    openstudio::Handle m_handle;
+  };
+
+  void ReverseTranslator::onAddWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& type, const openstudio::UUID& uuid)
+  {
+    // most objects are named after construction, so defer indexing until the next lookup
+    m_unindexedModelObjects.push_back(uuid);
+  }
+
+  void ReverseTranslator::indexModelObjectNames(const model::Model& model)
+  {
+    for( const auto& handle : m_unindexedModelObjects ) {
+      if( boost::optional<WorkspaceObject> object = model.getObject(handle) ) {
+        if( boost::optional<std::string> name = object->name() ) {
+          m_modelObjectsByName[boost::to_upper_copy(*name)].push_back(handle);
+        }
+        if( m_modelObjectNameWatchers.find(handle) == m_modelObjectNameWatchers.end() ) {
+          m_modelObjectNameWatchers[handle] = std::make_shared<ModelObjectNameWatcher>(*this, *object);
+        }
+      }
+    }
+    m_unindexedModelObjects.clear();
+  }
+
+  void ReverseTranslator::startModelObjectIndex(const model::Model& model)
+  {
+    clearModelObjectIndex();
+    for( const auto& object : model.objects() ) {
+      m_unindexedModelObjects.push_back(object.handle());
+    }
+    model.getImpl<model::detail::Model_Impl>()->addWorkspaceObject.connect<ReverseTranslator, &ReverseTranslator::onAddWorkspaceObject>(this);
+  }
+
+  void ReverseTranslator::stopModelObjectIndex(const model::Model& model)
+  {
+    model.getImpl<model::detail::Model_Impl>()->addWorkspaceObject.disconnect<ReverseTranslator, &ReverseTranslator::onAddWorkspaceObject>(this);
+    clearModelObjectIndex();
+  }
+
+  void ReverseTranslator::clearModelObjectIndex()
+  {
+    m_modelObjectsByName.clear();
+    m_unindexedModelObjects.clear();
+    m_modelObjectNameWatchers.clear();
   }
 
   boost::optional<model::Model> ReverseTranslator::translateSDD(const QDomElement& element, const QDomDocument& doc)
@@ -255,6 +451,8 @@ namespace sdd {
       result = openstudio::model::Model();
       result->setFastNaming(true);
 
+      startModelObjectIndex(*result);
+
       // do runperiod
       boost::optional<model::ModelObject> runPeriod = translateRunPeriod(projectElement, doc, *result);
       //if (!runPeriod){
@@ -1791,6 +1989,8 @@ namespace sdd {
       model::OutputControlReportingTolerances rt = result->getUniqueModelObject<model::OutputControlReportingTolerances>();
       rt.setToleranceforTimeCoolingSetpointNotMet(0.56);
       rt.setToleranceforTimeHeatingSetpointNotMet(0.56);
+
+      stopModelObjectIndex(*result);
     }
 
     return result;
@@ -1961,7 +2161,7 @@ namespace sdd {
 
     QDomElement wtrMnTempSchRefElement = element.firstChildElement("WtrMnTempSchRef");
     if (!wtrMnTempSchRefElement.isNull()){
-      boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(wtrMnTempSchRefElement.text().toStdString());
+      boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, wtrMnTempSchRefElement.text().toStdString());
       if (schedule){
         model::SiteWaterMainsTemperature waterMains = model.getUniqueModelObject<model::SiteWaterMainsTemperature>();
         waterMains.setTemperatureSchedule(*schedule);
@@ -2056,24 +2256,9 @@ namespace sdd {
 
 QDomElement ReverseTranslator::supplySegment(const QString & fluidSegmentName, const QDomDocument& doc)
 {
-  QDomNodeList fluidSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("FluidSys");
-
-  for (int i = 0; i < fluidSysElements.count(); i++) {
-    QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
-    QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
-
-    for (int i = 0; i < fluidSegmentElements.count(); i++) {
-      QDomElement fluidSegmentElement = fluidSegmentElements.at(i).toElement();
-
-      QDomElement nameElement = fluidSegmentElement.firstChildElement("Name");
-      QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
-
-      if( (typeElement.text().toLower() == "secondarysupply" ||
-           typeElement.text().toLower() == "primarysupply" ) &&
-           nameElement.text().toLower() == fluidSegmentName.toLower() ) {
-        return fluidSegmentElement;
-      }
-    }
+  auto it = m_supplySegmentElements.find(fluidSegmentName.toLower());
+  if( it != m_supplySegmentElements.end() ) {
+    return it->second;
   }
 
   return QDomElement();
@@ -2085,52 +2270,30 @@ boost::optional<model::PlantLoop> ReverseTranslator::loopForSupplySegment(const
   auto fluidSysElement = fluidSegmentElement.parentNode().toElement();
   auto fluidSysNameElement = fluidSysElement.firstChildElement("Name");
 
-  return model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().toStdString());
+  return getModelObjectByName<model::PlantLoop>(model, fluidSysNameElement.text().toStdString());
 }
 
 boost::optional<model::PlantLoop> ReverseTranslator::serviceHotWaterLoopForSupplySegment(const QString & fluidSegmentName, const QDomDocument & doc, openstudio::model::Model& model)
 {
   boost::optional<model::PlantLoop> result;
 
-  QDomNodeList fluidSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("FluidSys");
-
-  for (int i = 0; i < fluidSysElements.count(); i++)
-  {
-    QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
-
-    QDomElement fluidSysNameElement = fluidSysElement.firstChildElement("Name");
+  auto it = m_serviceHotWaterFluidSysElements.find(fluidSegmentName.toLower());
+  if( it == m_serviceHotWaterFluidSysElements.end() ) {
+    return result;
+  }
 
-    QDomElement fluidSysTypeElement = fluidSysElement.firstChildElement("Type");
+  QDomElement fluidSysElement = it->second;
+  QDomElement fluidSysNameElement = fluidSysElement.firstChildElement("Name");
 
-    if( fluidSysTypeElement.text().toLower() == "servicehotwater" )
+  if( boost::optional<model::PlantLoop> loop = getModelObjectByName<model::PlantLoop>(model, fluidSysNameElement.text().toStdString()) )
+  {
+    return loop;
+  }
+  else
+  {
+    if( boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement,doc,model) )
     {
-      QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
-
-      for (int i = 0; i < fluidSegmentElements.count(); i++)
-      {
-        QDomElement fluidSegmentElement = fluidSegmentElements.at(i).toElement();
-
-        QDomElement nameElement = fluidSegmentElement.firstChildElement("Name");
-        QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
-
-        if( (typeElement.text().toLower() == "secondarysupply" ||
-             typeElement.text().toLower() == "primarysupply" ) &&
-            nameElement.text().toLower() == fluidSegmentName.toLower()
-          )
-        {
-          if( boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().toStdString()) )
-          {
-            return loop;
-          }
-          else
-          {
-            if( boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement,doc,model) )
-            {
-              return mo->optionalCast<model::PlantLoop>();
-            }
-          }
-        }
-      }
+      return mo->optionalCast<model::PlantLoop>();
     }
   }
 
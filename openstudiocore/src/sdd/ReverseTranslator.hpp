@@ -47,6 +47,8 @@ class QDomDocument;
 class QDomElement;
 class QDomNodeList;
 
+class SDDFixture_ReverseTranslator_ModelObjectNameIndex_Test;
+
 namespace openstudio {
 
 class ProgressBar;
@@ -83,6 +85,8 @@ namespace sdd {
 
   private:
 
+    friend class ::SDDFixture_ReverseTranslator_ModelObjectNameIndex_Test; // for testing
+
     std::string escapeName(QString name);
 
     // listed in translation order
@@ -159,6 +163,37 @@ namespace sdd {
     // Return the "TrmlUnit" element serving zoneName
     QDomElement findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc);
 
+    // Return the "ThrmlZn" element with the name zoneName
+    QDomElement findThrmlZnElement(const QString & zoneName,const QDomDocument & doc);
+
+    // Build the element lookup tables used by the find* methods above, once per document.
+    // Keys are lower case where the lookup is case insensitive, first element in document order wins.
+    void indexElements(const QDomDocument & doc);
+    void clearElementIndex();
+    std::map<QString, QDomElement> m_znSysElements;
+    std::map<QString, QDomElement> m_airSysElements;
+    std::map<QString, QDomElement> m_trmlUnitElementsByZone;
+    std::map<QString, QDomElement> m_thrmlZnElements;
+    std::map<QString, QDomElement> m_supplySegmentElements;
+    // Supply segment name => "FluidSys" element of type ServiceHotWater
+    std::map<QString, QDomElement> m_serviceHotWaterFluidSysElements;
+
+    // Return the object of type T named name, equivalent to model.getModelObjectByName<T>(name).
+    // Objects are indexed by upper case name as they are added to the model and re-indexed when
+    // they are renamed, so the index is authoritative and lookups never scan the workspace. Hits are
+    // validated against the object's current name and type to skip removed objects and old names.
+    template <typename T>
+    boost::optional<T> getModelObjectByName(const openstudio::model::Model& model, const std::string& name);
+    void onAddWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+    void indexModelObjectNames(const openstudio::model::Model& model);
+    void startModelObjectIndex(const openstudio::model::Model& model);
+    void stopModelObjectIndex(const openstudio::model::Model& model);
+    void clearModelObjectIndex();
+    class ModelObjectNameWatcher;
+    std::map<std::string, std::vector<openstudio::Handle> > m_modelObjectsByName;
+    std::vector<openstudio::Handle> m_unindexedModelObjects;
+    std::map<openstudio::Handle, std::shared_ptr<ModelObjectNameWatcher> > m_modelObjectNameWatchers;
+
     model::Schedule alwaysOnSchedule(openstudio::model::Model& model);
     boost::optional<model::Schedule> m_alwaysOnSchedule;
 
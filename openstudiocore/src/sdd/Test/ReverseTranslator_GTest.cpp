@@ -54,6 +54,8 @@
 #include "../../model/YearDescription_Impl.hpp"
 #include "../../model/RunPeriodControlSpecialDays.hpp"
 #include "../../model/RunPeriodControlSpecialDays_Impl.hpp"
+#include "../../model/ScheduleDay.hpp"
+#include "../../model/ScheduleDay_Impl.hpp"
 
 
 #include "../../utilities/idf/Workspace.hpp"
@@ -66,4 +68,79 @@
 using namespace openstudio::model;
 using namespace openstudio;
 
+TEST_F(SDDFixture, ReverseTranslator_ModelObjectNameIndex)
+{
+  Model model;
 
+  // created before indexing starts
+  Space space1(model);
+  space1.setName("Space 1");
+
+  sdd::ReverseTranslator reverseTranslator;
+  reverseTranslator.startModelObjectIndex(model);
+
+  // created and named after indexing starts
+  Space space2(model);
+  space2.setName("Space 2");
+  ThermalZone zone(model);
+  zone.setName("Zone 1");
+
+  boost::optional<Space> space = reverseTranslator.getModelObjectByName<Space>(model, "Space 1");
+  ASSERT_TRUE(space);
+  EXPECT_EQ(space1.handle(), space->handle());
+  space = reverseTranslator.getModelObjectByName<Space>(model, "SPACE 2");
+  ASSERT_TRUE(space);
+  EXPECT_EQ(space2.handle(), space->handle());
+  EXPECT_FALSE(reverseTranslator.getModelObjectByName<Space>(model, "Zone 1"));
+  EXPECT_FALSE(reverseTranslator.getModelObjectByName<ScheduleDay>(model, "Space 1"));
+  boost::optional<ThermalZone> thermalZone = reverseTranslator.getModelObjectByName<ThermalZone>(model, "zone 1");
+  ASSERT_TRUE(thermalZone);
+  EXPECT_EQ(zone.handle(), thermalZone->handle());
+
+  // old names no longer match, new names do
+  space1.setName("Renamed Space");
+  EXPECT_FALSE(reverseTranslator.getModelObjectByName<Space>(model, "Space 1"));
+  space = reverseTranslator.getModelObjectByName<Space>(model, "Renamed Space");
+  ASSERT_TRUE(space);
+  EXPECT_EQ(space1.handle(), space->handle());
+
+  // a name given up by one object resolves to the object that took it
+  space2.setName("Space 1");
+  EXPECT_FALSE(reverseTranslator.getModelObjectByName<Space>(model, "Space 2"));
+  space = reverseTranslator.getModelObjectByName<Space>(model, "Space 1");
+  ASSERT_TRUE(space);
+  EXPECT_EQ(space2.handle(), space->handle());
+
+  // removed objects are not returned
+  space2.remove();
+  EXPECT_FALSE(reverseTranslator.getModelObjectByName<Space>(model, "Space 1"));
+
+  Space space3(model);
+  space3.setName("Space 1");
+  space = reverseTranslator.getModelObjectByName<Space>(model, "Space 1");
+  ASSERT_TRUE(space);
+  EXPECT_EQ(space3.handle(), space->handle());
+
+  // renames after the lookups are tracked as well
+  space1.setName("Space 4");
+  space3.setName("Space 5");
+  space = reverseTranslator.getModelObjectByName<Space>(model, "Space 4");
+  ASSERT_TRUE(space);
+  EXPECT_EQ(space1.handle(), space->handle());
+  space = reverseTranslator.getModelObjectByName<Space>(model, "Space 5");
+  ASSERT_TRUE(space);
+  EXPECT_EQ(space3.handle(), space->handle());
+  EXPECT_FALSE(reverseTranslator.getModelObjectByName<Space>(model, "Renamed Space"));
+  EXPECT_FALSE(reverseTranslator.getModelObjectByName<Space>(model, "Space 1"));
+
+  reverseTranslator.stopModelObjectIndex(model);
+
+  // objects added while indexing is stopped are picked up when it restarts
+  Space space6(model);
+  space6.setName("Space 6");
+  reverseTranslator.startModelObjectIndex(model);
+  space = reverseTranslator.getModelObjectByName<Space>(model, "Space 6");
+  ASSERT_TRUE(space);
+  EXPECT_EQ(space6.handle(), space->handle());
+  reverseTranslator.stopModelObjectIndex(model);
+}
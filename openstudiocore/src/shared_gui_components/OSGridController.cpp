@@ -109,8 +109,7 @@ namespace openstudio {
     Holder *t_holder,
     int t_row,
     int t_column,
-    const boost::optional<int> &t_subrow,
-    const bool t_selector)
+    const boost::optional<int> &t_subrow)
   {
     WidgetLocation * widgetLoc = new WidgetLocation(t_holder, t_row, t_column, t_subrow);
 
@@ -119,10 +118,49 @@ namespace openstudio {
     connect(widgetLoc, &WidgetLocation::inFocus, this, &ObjectSelector::inFocus);
 
     m_widgetMap.insert(std::make_pair(t_obj, widgetLoc));
+  }
 
-    if (t_selector && t_obj)
-    {
-      m_selectorObjects.insert(*t_obj);
+  void ObjectSelector::refreshObjects()
+  {
+    m_selectorObjects.clear();
+    m_objectLocations.clear();
+    m_subrowCounts.assign(m_grid->rowCount(), 1);
+
+    // Mirrors the holders that OSGridController::widgetAt makes for each cell
+    for (int row = m_grid->m_hasHorizontalHeader ? 1 : 0; row < m_grid->rowCount(); ++row) {
+      model::ModelObject mo = m_grid->modelObject(row);
+
+      for (const auto &baseConcept : m_grid->m_baseConcepts) {
+        if (QSharedPointer<DataSourceAdapter> dataSource = baseConcept.dynamicCast<DataSourceAdapter>()) {
+          const bool selector = baseConcept->isSelector() || dataSource->innerConcept()->isSelector();
+          int subrow = 0;
+
+          for (auto &item : dataSource->source().items(mo)) {
+            if (item && selector) {
+              auto obj = item->cast<model::ModelObject>();
+              m_selectorObjects.insert(obj);
+              m_objectLocations.insert(std::make_pair(obj, std::make_pair(row, boost::optional<int>(subrow))));
+            }
+            ++subrow;
+          }
+
+          if (dataSource->source().wantsPlaceholder()) {
+            ++subrow;
+          }
+
+          if (dataSource->source().dropZoneConcept()) {
+            ++subrow;
+          }
+
+          if (subrow > m_subrowCounts[row]) {
+            m_subrowCounts[row] = subrow;
+          }
+        }
+        else if (baseConcept->isSelector()) {
+          m_selectorObjects.insert(mo);
+          m_objectLocations.insert(std::make_pair(mo, std::make_pair(row, boost::optional<int>())));
+        }
+      }
     }
   }
 
@@ -132,6 +170,9 @@ namespace openstudio {
     m_selectedObjects.clear();
     m_selectorObjects.clear();
     m_filteredObjects.clear();
+    m_objectLocations.clear();
+    m_subrowCounts.clear();
+    m_rowFilteredObjects.clear();
     m_objectFilter = getDefaultFilter();
   }
 
@@ -142,6 +183,8 @@ namespace openstudio {
     m_selectedObjects.erase(t_obj);
     m_selectorObjects.erase(t_obj);
     m_filteredObjects.erase(t_obj);
+    m_objectLocations.erase(t_obj);
+    m_rowFilteredObjects.erase(t_obj);
     m_widgetMap.erase(boost::optional<model::ModelObject>(t_obj));
   }
 
@@ -230,6 +273,37 @@ namespace openstudio {
     updateWidgets();
   }
 
+  int ObjectSelector::subrowCount(const int t_row) const
+  {
+    if (t_row < 0 || t_row >= static_cast<int>(m_subrowCounts.size())) {
+      return 1;
+    }
+    return m_subrowCounts[t_row];
+  }
+
+  bool ObjectSelector::isRowVisible(const int t_row) const
+  {
+    if (m_grid->m_hasHorizontalHeader && t_row == 0) {
+      return true;
+    }
+
+    model::ModelObject obj = m_grid->modelObject(t_row);
+
+    if (m_rowFilteredObjects.count(obj) != 0) {
+      return false;
+    }
+
+    // The row object itself hides the whole row when it is a selector that is filtered, see updateWidgets
+    auto range = m_objectLocations.equal_range(obj);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second.first == t_row && !it->second.second) {
+        return m_objectFilter(obj) && m_filteredObjects.count(obj) == 0;
+      }
+    }
+
+    return true;
+  }
+
   std::function<bool(const model::ModelObject &)> ObjectSelector::getDefaultFilter()
   {
     return [](const model::ModelObject &) { return true; };
@@ -241,12 +315,11 @@ namespace openstudio {
 
     for (auto obj : m_selectorObjects) {
 
-      auto range = m_widgetMap.equal_range(boost::optional<model::ModelObject>(obj));
-
-      assert(range.first != range.second);
+      auto location = m_objectLocations.find(obj);
 
-      // Find the row that contains this object
-      auto row = std::make_tuple(range.first->second->row, range.first->second->subrow);
+      // Find the row that contains this object, whether or not it has widgets
+      auto row = (location != m_objectLocations.end()) ? std::make_tuple(location->second.first, location->second.second)
+                                                       : std::make_tuple(-1, boost::optional<int>());
 
       auto objectVisible = m_objectFilter(obj);
 
@@ -311,12 +384,11 @@ namespace openstudio {
 
     for (auto obj : m_selectorObjects) {
 
-      auto range = m_widgetMap.equal_range(boost::optional<model::ModelObject>(obj));
+      auto location = m_objectLocations.find(obj);
 
-      assert(range.first != range.second);
-
-      // Find the row that contains this object
-      auto row = std::make_tuple(range.first->second->row, range.first->second->subrow);
+      // Find the row that contains this object, whether or not it has widgets
+      auto row = (location != m_objectLocations.end()) ? std::make_tuple(location->second.first, location->second.second)
+                                                       : std::make_tuple(-1, boost::optional<int>());
 
       auto objectVisible = m_objectFilter(obj);
 
@@ -373,19 +445,34 @@ namespace openstudio {
     m_grid->requestRefreshGrid();
   }
 
-  boost::optional<const model::ModelObject &> ObjectSelector::getObject(const int t_row, const int t_column, const boost::optional<int> &t_subrow)
+  boost::optional<model::ModelObject> ObjectSelector::getObject(const int t_row, const int t_column, const boost::optional<int> &t_subrow)
   {
-    boost::optional<const model::ModelObject &> object;
-
     for (auto &widgetLoc : m_widgetMap)
     {
       if (widgetLoc.second->row == t_row && widgetLoc.second->column == t_column && (!t_subrow || t_subrow == widgetLoc.second->subrow))
       {
-        object = widgetLoc.first;
-        break;
+        return widgetLoc.first;
       }
     }
-    return object;
+
+    // The row may have scrolled out of view since, look the object up in the model the way widgetAt does
+    if (t_row < (m_grid->m_hasHorizontalHeader ? 1 : 0) || t_row >= m_grid->rowCount()
+        || t_column < 0 || t_column >= static_cast<int>(m_grid->m_baseConcepts.size())) {
+      return boost::none;
+    }
+
+    model::ModelObject mo = m_grid->modelObject(t_row);
+    if (QSharedPointer<DataSourceAdapter> dataSource = m_grid->m_baseConcepts[t_column].dynamicCast<DataSourceAdapter>()) {
+      if (t_subrow) {
+        auto items = dataSource->source().items(mo);
+        if (*t_subrow >= 0 && *t_subrow < static_cast<int>(items.size()) && items[*t_subrow]) {
+          return items[*t_subrow]->cast<model::ModelObject>();
+        }
+      }
+      return boost::none;
+    }
+
+    return mo;
   }
 
   QWidget * ObjectSelector::getWidget(const int t_row, const int t_column, const boost::optional<int> &t_subrow)
@@ -405,6 +492,11 @@ namespace openstudio {
 
   void ObjectSelector::updateWidgets(const int t_row, const boost::optional<int> &t_subrow, bool t_objectSelected, bool t_objectVisible)
   {
+    // Rows out of view keep their widgets hidden, updateRowWidgets catches them up once they are shown
+    if (!m_grid->gridView()->isRowShown(t_row)) {
+      return;
+    }
+
     std::set<std::pair<QWidget *, int>> widgetsToUpdate;
     bool isSubRow = t_subrow;
 
@@ -434,17 +526,21 @@ namespace openstudio {
   void ObjectSelector::updateWidgets(bool isRowLevel)
   {
     if( isRowLevel ) {
+      // Kept so that rows built later are hidden too
+      m_rowFilteredObjects = m_filteredObjects;
+
       // We loop on all object in the leftmost colum (eg: 'Space' for all SpaceSubtabs)
       for( int t_row=0; t_row < this->m_grid->rowCount(); ++t_row ) {
         bool objectVisible = true;
         bool objectSelected = false;
 
         // If that object is present in m_filteredObjects
-        boost::optional<const model::ModelObject &> _rowLevelObj = getObject(t_row, 0, boost::optional<int>());
-        if( _rowLevelObj && (m_filteredObjects.count(_rowLevelObj.get()) != 0 ) ) {
-          // LOG(Debug, "Hidding t_row=" << t_row << " matched as rowLevelObj (=" << _rowLevelObj.get().briefDescription() << ")");
-          objectVisible = false;
-          objectSelected = m_selectedObjects.count(_rowLevelObj.get()) != 0;
+        if( !(m_grid->m_hasHorizontalHeader && t_row == 0) ) {
+          model::ModelObject rowLevelObj = m_grid->modelObject(t_row);
+          if( m_filteredObjects.count(rowLevelObj) != 0 ) {
+            objectVisible = false;
+            objectSelected = m_selectedObjects.count(rowLevelObj) != 0;
+          }
         }
 
         // We'll hide the entire row
@@ -457,6 +553,44 @@ namespace openstudio {
         updateWidgets(obj);
       }
     }
+
+    // Rows may have been shown or hidden, which changes which rows are in view
+    m_grid->gridView()->requestUpdateVisibleRows();
+  }
+
+  void ObjectSelector::updateRowWidgets(const int t_firstRow, const int t_lastRow)
+  {
+    // Row level filters first, as updateWidgets(true) followed by updateWidgets(false) would
+    if (!m_rowFilteredObjects.empty()) {
+      for (int t_row = std::max(t_firstRow, m_grid->m_hasHorizontalHeader ? 1 : 0); t_row <= t_lastRow && t_row < m_grid->rowCount(); ++t_row) {
+        model::ModelObject rowLevelObj = m_grid->modelObject(t_row);
+        const bool objectVisible = m_rowFilteredObjects.count(rowLevelObj) == 0;
+        const bool objectSelected = !objectVisible && m_selectedObjects.count(rowLevelObj) != 0;
+        updateWidgets(t_row, boost::optional<int>(), objectSelected, objectVisible);
+      }
+    }
+
+    std::set<model::ModelObject> objects;
+
+    for (const auto &widgetLoc : m_widgetMap) {
+      if (widgetLoc.first && widgetLoc.second->row >= t_firstRow && widgetLoc.second->row <= t_lastRow
+          && m_selectorObjects.count(widgetLoc.first.get()) != 0) {
+        objects.insert(widgetLoc.first.get());
+      }
+    }
+
+    for (const auto &obj : objects) {
+      updateWidgets(obj);
+    }
+  }
+
+  void ObjectSelector::shiftRows(const int t_fromRow, const int t_delta)
+  {
+    for (auto &widgetLoc : m_widgetMap) {
+      if (widgetLoc.second->row >= t_fromRow) {
+        widgetLoc.second->row += t_delta;
+      }
+    }
   }
 
   // TODO: this overloaded function isn't called anywhere...
@@ -491,8 +625,11 @@ namespace openstudio {
     // Find all entries in m_widgetMap that matches t_obj
     auto range = m_widgetMap.equal_range(boost::optional<model::ModelObject>(t_obj));
 
-    // Check that it did return something
-    assert(range.first != range.second);
+    // Nothing to do if the row holding this object has no widgets,
+    // updateRowWidgets will be called for it once it is built
+    if (range.first == range.second) {
+      return;
+    }
 
     // Note JM: leaving it here in case you need to look at the contents of m_widgetMap...
     /*
@@ -1405,7 +1542,6 @@ namespace openstudio {
     OS_ASSERT(static_cast<int>(m_baseConcepts.size()) > column);
 
     auto layout = new QGridLayout(this->gridView());
-    const int widgetHeight = 30;
     int numWidgets = 0;
 
     // start with a default sane value
@@ -1420,7 +1556,7 @@ namespace openstudio {
     layout->setSpacing(0);
     layout->setVerticalSpacing(0);
     layout->setHorizontalSpacing(0);
-    layout->setContentsMargins(5, 5, 5, 5);
+    layout->setContentsMargins(CELL_MARGIN, CELL_MARGIN, CELL_MARGIN, CELL_MARGIN);
     wrapper->setLayout(layout);
     // end wrapper
 
@@ -1431,14 +1567,14 @@ namespace openstudio {
     // Also adds to layout, which is the layout of the main cell (wrapper).
     // holders and layout are accessible in the lambda through capture.
     // t_widget will be provided by ::makeWidget, it is the bindable control
-    auto addWidget = [&](QWidget *t_widget, const boost::optional<model::ModelObject> &t_obj, const bool t_selector)
+    auto addWidget = [&](QWidget *t_widget, const boost::optional<model::ModelObject> &t_obj)
     {
       if (column == 0) {
         m_subrowsInherited.clear();
       }
 
       auto holder = new Holder(this->gridView());
-      holder->setMinimumHeight(widgetHeight);
+      holder->setMinimumHeight(SUBROW_HEIGHT);
       auto l = new QVBoxLayout(this->gridView());
       l->setAlignment(Qt::AlignCenter);
       l->setSpacing(0);
@@ -1497,7 +1633,7 @@ namespace openstudio {
         }
       }
 
-      m_objectSelector->addWidget(t_obj, holder, row, column, hasSubRows ? numWidgets : boost::optional<int>(), t_selector);
+      m_objectSelector->addWidget(t_obj, holder, row, column, hasSubRows ? numWidgets : boost::optional<int>());
 
       ++numWidgets;
     }; // End of lambda
@@ -1509,7 +1645,7 @@ namespace openstudio {
         OS_ASSERT(m_horizontalHeader.size() == m_baseConcepts.size());
       }
       layout->setContentsMargins(0, 1, 1, 0);
-      addWidget(m_horizontalHeader.at(column), boost::none, false);
+      addWidget(m_horizontalHeader.at(column), boost::none);
       QSharedPointer<BaseConcept> baseConcept = m_baseConcepts[column];
       const Heading &heading = baseConcept->heading();
       HorizontalHeaderWidget * horizontalHeaderWidget = qobject_cast<HorizontalHeaderWidget *>(m_horizontalHeader.at(column));
@@ -1562,11 +1698,10 @@ namespace openstudio {
               }
             }
             m_subrowsInherited.push_back(subrowInherited);
-            addWidget(makeWidget(item->cast<model::ModelObject>(), dataSource->innerConcept()), item->cast<model::ModelObject>(),
-              baseConcept->isSelector() || dataSource->innerConcept()->isSelector());
+            addWidget(makeWidget(item->cast<model::ModelObject>(), dataSource->innerConcept()), item->cast<model::ModelObject>());
           }
           else {
-            addWidget(new QWidget(this->gridView()), boost::none, false);
+            addWidget(new QWidget(this->gridView()), boost::none);
           }
           m_subrowCounter++;
         }
@@ -1575,7 +1710,7 @@ namespace openstudio {
         {
           // use this space to put in a blank placeholder of some kind to make sure the
           // widget is evenly laid out relative to its friends in the adjacent columns
-          addWidget(new QWidget(this->gridView()), boost::none, false);
+          addWidget(new QWidget(this->gridView()), boost::none);
         }
 
         if (dataSource->source().dropZoneConcept())
@@ -1583,7 +1718,7 @@ namespace openstudio {
           // it makes sense to me that the drop zone would need a reference to the parent containing object
           // not an object the rest in the list was derived from
           // this should also be working and doing what you want
-          addWidget(makeWidget(mo, dataSource->source().dropZoneConcept()), boost::none, false);
+          addWidget(makeWidget(mo, dataSource->source().dropZoneConcept()), boost::none);
         }
 
         // right here you probably want some kind of container that's smart enough to know how to grow
@@ -1596,7 +1731,7 @@ namespace openstudio {
         // This case is exactly what it used to do before the DataSource idea was added.
 
         // just the one
-        addWidget(makeWidget(mo, baseConcept), mo, baseConcept->isSelector());
+        addWidget(makeWidget(mo, baseConcept), mo);
       }
     }
 
@@ -1894,10 +2029,18 @@ namespace openstudio {
     //if (m_iddObjectType == iddObjectType) { TODO uncomment, currently used to update views with extensible dropzones, which need to issue their own signal to refresh
     // Update model list
     // m_modelObjects.push_back(object.cast<model::ModelObject>());
+    auto numModelObjects = m_modelObjects.size();
     refreshModelObjects();
 
-    // Update row
-    gridView()->requestAddRow(rowCount() - 1);
+    // Update row, the model objects are sorted so the new one is not necessarily the last
+    auto it = std::find(m_modelObjects.begin(), m_modelObjects.end(), object.cast<model::ModelObject>());
+    if (it != m_modelObjects.end() && m_modelObjects.size() == numModelObjects + 1) {
+      gridView()->requestAddRow(rowIndexFromModelIndex(std::distance(m_modelObjects.begin(), it)));
+    }
+    else {
+      // Not one of the row-major objects, it may show up in a subrow or a drop zone
+      requestRefreshGrid();
+    }
     //}
   }
 
@@ -1946,7 +2089,7 @@ namespace openstudio {
         // Sub rows present, either in a widget, or in a row
         const DataSource &source = dataSource->source();
         QSharedPointer<BaseConcept> dropZoneConcept = source.dropZoneConcept();
-        boost::optional<const model::ModelObject &> object = this->m_objectSelector->getObject(selectedRow, selectedColumn, selectedSubrow);
+        boost::optional<model::ModelObject> object = this->m_objectSelector->getObject(selectedRow, selectedColumn, selectedSubrow);
         if (object) {
           for (auto modelObject : selectedObjects) {
             // Don't set the chosen object when iterating through the selected objects
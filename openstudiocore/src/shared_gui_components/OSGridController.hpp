@@ -207,10 +207,13 @@ class ObjectSelector : public QObject, public Nano::Observer
     ObjectSelector(OSGridController *t_grid);
 
     void addWidget(const boost::optional<model::ModelObject> &t_obj, Holder *t_holder, int row, int column,
-        const boost::optional<int> &subrow, bool t_selector);
+        const boost::optional<int> &subrow);
+    // rebuild the selector objects, their locations and the sub row counts from the grid's model objects,
+    // independently of which rows have widgets
+    void refreshObjects();
     void setObjectSelection(const model::ModelObject &t_obj, bool t_selected);
     bool getObjectSelection(const model::ModelObject &t_obj) const;
-    boost::optional<const model::ModelObject &> getObject(const int t_row, const int t_column, const boost::optional<int> &t_subrow);
+    boost::optional<model::ModelObject> getObject(const int t_row, const int t_column, const boost::optional<int> &t_subrow);
     QWidget * getWidget(const int t_row, const int t_column, const boost::optional<int> &t_subrow);
     std::set<model::ModelObject> getSelectedObjects() const;
     std::vector<QWidget *> getColumnsSelectedWidgets(int column);
@@ -222,8 +225,17 @@ class ObjectSelector : public QObject, public Nano::Observer
     void selectAll();
     void clearSelection();
     void updateWidgets(bool isRowLevel=false);
+    // update selection and filter state of the widgets in rows [t_firstRow, t_lastRow] only
+    void updateRowWidgets(const int t_firstRow, const int t_lastRow);
+    // offset the row of every widget at or below t_fromRow, used when a single row is inserted or removed
+    void shiftRows(const int t_fromRow, const int t_delta);
+    // number of sub rows in a row, 1 for rows without sub rows
+    int subrowCount(const int t_row) const;
+    // whether a row is shown under the current filters, whether or not it has widgets
+    bool isRowVisible(const int t_row) const;
 
     std::set<model::ModelObject> m_selectedObjects;
+    // every object that can be selected, whether or not its row has widgets
     std::set<model::ModelObject> m_selectorObjects;
     std::set<model::ModelObject> m_filteredObjects;
 
@@ -245,6 +257,11 @@ class ObjectSelector : public QObject, public Nano::Observer
     OSGridController *m_grid;
     std::multimap<boost::optional<model::ModelObject>, WidgetLocation *> m_widgetMap;
     std::function<bool (const model::ModelObject &)> m_objectFilter;
+    // row and sub row of each selector object, an object may appear in several rows
+    std::multimap<model::ModelObject, std::pair<int, boost::optional<int> > > m_objectLocations;
+    std::vector<int> m_subrowCounts;
+    // objects whose whole row was hidden by the last row level updateWidgets, applied to rows as they are built
+    std::set<model::ModelObject> m_rowFilteredObjects;
 };
 
 class OSGridController : public QObject, public Nano::Observer
@@ -583,6 +600,11 @@ public:
   // In that case a QWidget with sub rows (inner grid layout) will be returned.
   QWidget * widgetAt(int row, int column);
 
+  // Minimum height of a sub row and margin around the sub rows of a cell built by widgetAt
+  static const int SUBROW_HEIGHT = 30;
+
+  static const int CELL_MARGIN = 5;
+
   // Call this function on a model update
   virtual void refreshModelObjects() = 0;
 
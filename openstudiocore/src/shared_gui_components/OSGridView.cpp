@@ -52,9 +52,12 @@
 #include <QLabel>
 #include <QPushButton>
 #include <QScrollArea>
+#include <QScrollBar>
 #include <QShowEvent>
 #include <QStackedWidget>
 
+#include <algorithm>
+
 #ifdef Q_OS_MAC
   #define WIDTH  110
   #define HEIGHT 60
@@ -175,6 +178,9 @@ OSGridView::OSGridView(OSGridController * gridController,
   m_timer.setSingleShot(true);
   connect(&m_timer, &QTimer::timeout, this, &OSGridView::doRefresh);
 
+  m_updateRowsTimer.setSingleShot(true);
+  connect(&m_updateRowsTimer, &QTimer::timeout, this, &OSGridView::updateVisibleRows);
+
   if (this->isVisible()) {
     m_gridController->connectToModel();
     refreshAll();
@@ -227,10 +233,18 @@ void OSGridView::requestRemoveRow(int row)
 
 QLayoutItem * OSGridView::itemAtPosition(int row, int column)
 {
-  auto layoutnum = row / ROWS_PER_LAYOUT;
-  auto relativerow = row % ROWS_PER_LAYOUT;
+  // The row may be out of view, in which case it has nothing in the grid
+  if (!m_gridLayout || !isRowShown(row)) {
+    return nullptr;
+  }
 
-  return m_gridLayouts.at(layoutnum)->itemAtPosition(relativerow, column);
+  return m_gridLayout->itemAtPosition(gridRow(row), column);
+}
+
+bool OSGridView::isRowShown(int row) const
+{
+  auto it = m_rows.find(row);
+  return it != m_rows.end() && it->second.inLayout;
 }
 
 //void OSGridView::removeWidget(int row, int column)
@@ -273,24 +287,24 @@ QLayoutItem * OSGridView::itemAtPosition(int row, int column)
 
 void OSGridView::deleteAll()
 {
-  for (auto layout : m_gridLayouts)
-  {
-    QLayoutItem * child;
-    while((child = layout->takeAt(0)) != nullptr)
-    {
-      QWidget * widget = child->widget();
-
-      OS_ASSERT(widget);
+  m_updateRowsTimer.stop();
 
-      delete widget;
-      // Using deleteLater is actually slower than calling delete directly on the widget
-      // deleteLater also introduces a strange redraw issue where the select all check box
-      // is not redrawn, after being checked.
-      //widget->deleteLater();
+  while (!m_rows.empty())
+  {
+    deleteRow(m_rows.begin()->first);
+  }
 
-      delete child;
+  if (m_gridLayout)
+  {
+    m_gridLayout->setRowMinimumHeight(1, 0);
+    if (m_bottomSpacerRow > 0) {
+      m_gridLayout->setRowMinimumHeight(m_bottomSpacerRow, 0);
     }
   }
+
+  m_firstRow = 0;
+  m_lastRow = -1;
+  m_bottomSpacerRow = -1;
 }
 
 //void OSGridView::refreshGrid()
@@ -361,8 +375,23 @@ void OSGridView::doRefresh()
     if (r == RefreshAll) has_refresh_all = true;
   }
 
+  auto numRequests = m_queueRequests.size();
+
   m_queueRequests.clear();
 
+  // A lone add or remove (the common case of a single object being created or deleted) only touches
+  // the affected row, anything else requires the rows to be rebuilt
+  if (numRequests == 1 && !has_refresh_all && !has_refresh_grid) {
+    if (has_add_row) {
+      addRow(m_rowToAdd);
+    }
+    else if (has_remove_row) {
+      removeRow(m_rowToRemove);
+    }
+    setEnabled(true);
+    return;
+  }
+
   //if (has_refresh_all) {
   //  refreshAll();
   //}
@@ -380,7 +409,7 @@ void OSGridView::doRefresh()
   //  OS_ASSERT(false);
   //}
 
-  refreshAll(); // TODO remove this and uncomment the block above for finer granularity refreshes
+  refreshAll();
   setEnabled(true);
 }
 
@@ -392,22 +421,330 @@ void OSGridView::refreshAll()
 
   if (m_gridController)
   {
+    if (!m_gridLayout)
+    {
+      m_gridLayout = makeGridLayout();
+      OS_ASSERT(m_contentLayout);
+      m_contentLayout->addLayout(m_gridLayout);
+    }
+
     m_gridController->refreshModelObjects();
+    m_gridController->getObjectSelector()->refreshObjects();
 
-    for (int i = 0; i < m_gridController->rowCount(); i++)
-    {
-      for (int j = 0; j < m_gridController->columnCount(); j++)
-      {
-        addWidget(i, j);
-      }
+    if (m_gridController->m_hasHorizontalHeader && m_gridController->rowCount() > 0) {
+      buildRow(0);
+      showRow(0);
     }
 
-    this->m_gridController->getObjectSelector()->updateWidgets();
+    updateVisibleRows();
 
     QTimer::singleShot(0, this, SLOT(selectRowDeterminedByModelSubTabView()));
   }
 }
 
+void OSGridView::requestUpdateVisibleRows()
+{
+  m_updateRowsTimer.start();
+}
+
+void OSGridView::updateVisibleRows()
+{
+  if (!m_gridController || !m_gridLayout) return;
+
+  // Row indices of queued add/remove requests refer to the current rows, wait for doRefresh
+  if (!m_queueRequests.empty()) return;
+
+  auto objectSelector = m_gridController->getObjectSelector();
+  const int rowCount = m_gridController->rowCount();
+
+  std::vector<int> heights(rowCount, 0);
+  for (int i = firstDataRow(); i < rowCount; i++) {
+    heights[i] = rowHeight(i);
+  }
+
+  // Without a scroll area every row is in view
+  int firstRow = firstDataRow();
+  int lastRow = rowCount - 1;
+
+  if (m_scrollArea && m_scrollArea->widget() && m_scrollArea->widget()->isAncestorOf(this)) {
+    // Where the data rows start in the scrolled widget
+    auto top = m_gridLayout->parentWidget()->mapTo(m_scrollArea->widget(), m_gridLayout->geometry().topLeft()).y();
+    if (firstDataRow() > 0) {
+      top += rowHeight(0);
+    }
+
+    const int viewTop = m_scrollArea->verticalScrollBar()->value() - top;
+    const int viewBottom = viewTop + m_scrollArea->viewport()->height();
+
+    firstRow = -1;
+    lastRow = -1;
+    int y = 0;
+    for (int i = firstDataRow(); i < rowCount && y < viewBottom; i++) {
+      y += heights[i];
+      if (firstRow < 0 && y > viewTop) {
+        firstRow = i;
+      }
+      lastRow = i;
+    }
+
+    if (lastRow < 0) {
+      lastRow = firstDataRow();
+    }
+    if (firstRow < 0) {
+      firstRow = lastRow;
+    }
+
+    firstRow = std::max(firstDataRow(), firstRow - ROW_MARGIN);
+    lastRow = std::min(rowCount - 1, lastRow + ROW_MARGIN);
+  }
+
+  m_firstRow = firstRow;
+  m_lastRow = lastRow;
+
+  std::vector<int> rowsToHide;
+  for (const auto &row : m_rows) {
+    if (row.first >= firstDataRow() && row.second.inLayout && (row.first < firstRow || row.first > lastRow)) {
+      rowsToHide.push_back(row.first);
+    }
+  }
+  for (auto row : rowsToHide) {
+    hideRow(row);
+  }
+
+  for (int i = firstRow; i <= lastRow; i++) {
+    auto it = m_rows.find(i);
+    if (it != m_rows.end()) {
+      if (!it->second.inLayout) {
+        showRow(i);
+      }
+    }
+    // Filtered rows are only built once they are shown
+    else if (objectSelector->isRowVisible(i)) {
+      buildRow(i);
+      showRow(i);
+    }
+  }
+
+  evictRows();
+
+  int heightAbove = 0;
+  for (int i = firstDataRow(); i < firstRow && i < rowCount; i++) {
+    heightAbove += heights[i];
+  }
+
+  int heightBelow = 0;
+  for (int i = std::max(firstDataRow(), lastRow + 1); i < rowCount; i++) {
+    heightBelow += heights[i];
+  }
+
+  const int bottomSpacerRow = gridRow(rowCount);
+  if (m_bottomSpacerRow > 0 && m_bottomSpacerRow != bottomSpacerRow) {
+    m_gridLayout->setRowMinimumHeight(m_bottomSpacerRow, 0);
+  }
+  m_bottomSpacerRow = bottomSpacerRow;
+
+  m_gridLayout->setRowMinimumHeight(1, heightAbove);
+  m_gridLayout->setRowMinimumHeight(m_bottomSpacerRow, heightBelow);
+}
+
+int OSGridView::gridRow(int row) const
+{
+  if (row < firstDataRow()) {
+    return 0;
+  }
+
+  return row - firstDataRow() + 2;
+}
+
+int OSGridView::firstDataRow() const
+{
+  return m_gridController->m_hasHorizontalHeader ? 1 : 0;
+}
+
+int OSGridView::rowHeight(int row)
+{
+  if (!m_gridController->getObjectSelector()->isRowVisible(row)) {
+    return 0;
+  }
+
+  auto it = m_rows.find(row);
+  if (it != m_rows.end()) {
+    if (it->second.inLayout) {
+      measureRow(it->second);
+    }
+    return it->second.height;
+  }
+
+  // Same as what widgetAt lays out: one holder per sub row, inside the cell margins
+  return m_gridController->getObjectSelector()->subrowCount(row) * OSGridController::SUBROW_HEIGHT + 2 * OSGridController::CELL_MARGIN;
+}
+
+void OSGridView::measureRow(Row & row) const
+{
+  row.height = 0;
+  for (auto widget : row.widgets) {
+    if (!widget->isHidden()) {
+      row.height = std::max(row.height, widget->sizeHint().height());
+    }
+  }
+}
+
+void OSGridView::buildRow(int row)
+{
+  OS_ASSERT(m_gridController);
+  OS_ASSERT(m_rows.find(row) == m_rows.end());
+
+  Row & newRow = m_rows[row];
+  for (int j = 0; j < m_gridController->columnCount(); j++)
+  {
+    newRow.widgets.push_back(m_gridController->widgetAt(row, j));
+  }
+}
+
+void OSGridView::showRow(int row)
+{
+  Row & shownRow = m_rows.at(row);
+
+  for (unsigned j = 0; j < shownRow.widgets.size(); j++)
+  {
+    m_gridLayout->addWidget(shownRow.widgets[j], gridRow(row), j);
+    shownRow.widgets[j]->show();
+  }
+  shownRow.inLayout = true;
+
+  // Apply the current selection and filters to the row
+  m_gridController->getObjectSelector()->updateRowWidgets(row, row);
+
+  if (row == m_gridController->m_oldIndex) {
+    m_gridController->selectRow(row, true);
+  }
+}
+
+void OSGridView::hideRow(int row)
+{
+  Row & hiddenRow = m_rows.at(row);
+
+  // Its height stands in for it while it is out of the grid
+  measureRow(hiddenRow);
+
+  for (auto widget : hiddenRow.widgets)
+  {
+    m_gridLayout->removeWidget(widget);
+    widget->hide();
+  }
+  hiddenRow.inLayout = false;
+}
+
+void OSGridView::deleteRow(int row)
+{
+  auto it = m_rows.find(row);
+  if (it == m_rows.end()) return;
+
+  for (auto widget : it->second.widgets)
+  {
+    if (it->second.inLayout) {
+      m_gridLayout->removeWidget(widget);
+    }
+    delete widget;
+    // Using deleteLater is actually slower than calling delete directly on the widget
+    // deleteLater also introduces a strange redraw issue where the select all check box
+    // is not redrawn, after being checked.
+    //widget->deleteLater();
+  }
+
+  m_rows.erase(it);
+}
+
+void OSGridView::evictRows()
+{
+  // distance to the rows in view, row
+  std::vector<std::pair<int, int> > cachedRows;
+
+  for (const auto &row : m_rows) {
+    if (row.first >= firstDataRow() && !row.second.inLayout) {
+      auto distance = (row.first < m_firstRow) ? m_firstRow - row.first : row.first - m_lastRow;
+      cachedRows.push_back(std::make_pair(distance, row.first));
+    }
+  }
+
+  if (cachedRows.size() <= MAX_CACHED_ROWS) return;
+
+  std::sort(cachedRows.begin(), cachedRows.end());
+
+  for (auto it = cachedRows.begin() + MAX_CACHED_ROWS; it != cachedRows.end(); ++it) {
+    deleteRow(it->second);
+  }
+}
+
+void OSGridView::addRow(int row)
+{
+  OS_ASSERT(m_gridController);
+
+  // The layout positions of every row below change, take them all out and let updateVisibleRows put them back
+  std::vector<int> shownRows;
+  for (const auto &r : m_rows) {
+    if (r.first >= firstDataRow() && r.second.inLayout) {
+      shownRows.push_back(r.first);
+    }
+  }
+  for (auto r : shownRows) {
+    hideRow(r);
+  }
+
+  shiftRows(row, 1);
+
+  auto objectSelector = m_gridController->getObjectSelector();
+  objectSelector->shiftRows(row, 1);
+  objectSelector->refreshObjects();
+
+  updateVisibleRows();
+}
+
+void OSGridView::removeRow(int row)
+{
+  OS_ASSERT(m_gridController);
+
+  std::vector<int> shownRows;
+  for (const auto &r : m_rows) {
+    if (r.first >= firstDataRow() && r.second.inLayout) {
+      shownRows.push_back(r.first);
+    }
+  }
+  for (auto r : shownRows) {
+    hideRow(r);
+  }
+
+  deleteRow(row);
+  shiftRows(row + 1, -1);
+
+  auto objectSelector = m_gridController->getObjectSelector();
+  objectSelector->shiftRows(row + 1, -1);
+  objectSelector->refreshObjects();
+
+  updateVisibleRows();
+}
+
+void OSGridView::shiftRows(int fromRow, int delta)
+{
+  std::map<int, Row> rows;
+
+  for (auto &r : m_rows) {
+    if (r.first < fromRow) {
+      rows[r.first] = r.second;
+      continue;
+    }
+
+    const int toRow = r.first + delta;
+    for (unsigned j = 0; j < r.second.widgets.size(); j++) {
+      // The alternating row color depends on the row index
+      r.second.widgets[j]->setStyleSheet(m_gridController->cellStyle(toRow, j, false, true));
+    }
+    rows[toRow] = r.second;
+  }
+
+  m_rows.swap(rows);
+}
+
 void OSGridView::selectRowDeterminedByModelSubTabView()
 {
   // Get selected item
@@ -435,33 +772,6 @@ void OSGridView::doRowSelect()
   }
 }
 
-void OSGridView::addWidget(int row, int column)
-{
-  OS_ASSERT(m_gridController);
-
-  QWidget * widget = m_gridController->widgetAt(row,column);
-
-  addWidget(widget, row, column);
-}
-
-void OSGridView::addWidget(QWidget *w, int row, int column)
-{
-  unsigned layoutindex = row / ROWS_PER_LAYOUT;
-  auto relativerow = row % ROWS_PER_LAYOUT;
-
-  if (layoutindex >= m_gridLayouts.size())
-  {
-    auto grid = makeGridLayout();
-    OS_ASSERT(grid);
-
-    m_gridLayouts.push_back(grid);
-    OS_ASSERT(m_contentLayout);
-    m_contentLayout->addLayout(grid);
-  }
-
-  m_gridLayouts[layoutindex]->addWidget(w, relativerow, column);
-}
-
 void OSGridView::selectCategory(int index)
 {
   m_gridController->categorySelected(index);
@@ -503,11 +813,25 @@ void OSGridView::hideEvent(QHideEvent * event)
 {
   m_gridController->disconnectFromModel();
 
+  // showEvent refreshes everything
+  m_updateRowsTimer.stop();
+
   QWidget::hideEvent(event);
 }
 
 void OSGridView::showEvent(QShowEvent * event)
 {
+  if (!m_scrollArea) {
+    for (QWidget * widget = parentWidget(); widget; widget = widget->parentWidget()) {
+      m_scrollArea = qobject_cast<QScrollArea *>(widget);
+      if (m_scrollArea) {
+        connect(m_scrollArea->verticalScrollBar(), &QScrollBar::valueChanged, this, &OSGridView::requestUpdateVisibleRows);
+        connect(m_scrollArea->verticalScrollBar(), &QScrollBar::rangeChanged, this, &OSGridView::requestUpdateVisibleRows);
+        break;
+      }
+    }
+  }
+
   m_gridController->connectToModel();
   refreshAll();
 
@@ -33,6 +33,9 @@
 #include <QTimer>
 #include <QWidget>
 
+#include <map>
+#include <vector>
+
 #include "../openstudio_lib/OSItem.hpp"
 
 #include "../model/ModelObject.hpp"
@@ -44,6 +47,7 @@ class QLabel;
 class QShowEvent;
 class QString;
 class QLayoutItem;
+class QScrollArea;
 
 namespace openstudio{
 
@@ -67,9 +71,12 @@ public:
 
   virtual ~OSGridView() {};
 
-  // return the QLayoutItem at a particular partition, accounting for multiple grid layouts
+  // return the QLayoutItem at a particular row and column, nullptr if that row is not shown
   QLayoutItem * itemAtPosition(int row, int column);
 
+  // true if the row has widgets and they are in the grid, rows out of view have none
+  bool isRowShown(int row) const;
+
   OSDropZone * m_dropZone;
 
   virtual ModelSubTabView * modelSubTabView();
@@ -78,6 +85,9 @@ public:
 
   void requestAddRow(int row);
 
+  // recompute which rows are in view from the event loop, eg: after filters hid or showed rows
+  void requestUpdateVisibleRows();
+
   QVBoxLayout * m_contentLayout;
 
 protected:
@@ -106,8 +116,6 @@ private slots:
 
   void deleteAll();
 
-  void addWidget(int row, int column);
-
   void selectCategory(int index);
 
   void doRefresh();
@@ -116,6 +124,8 @@ private slots:
 
   void selectRowDeterminedByModelSubTabView();
 
+  void updateVisibleRows();
+
 private:
 
   enum QueueType
@@ -130,14 +140,58 @@ private:
   // construct a grid layout to our specs
   QGridLayout * makeGridLayout();
 
-  // Add a widget, adding a new layout if necessary
-  void addWidget(QWidget *w, int row, int column);
-
   void setGridController(OSGridController * gridController);
 
-  static const int ROWS_PER_LAYOUT = 100;
+  // incremental row updates, rows at and below row are shifted and restyled
+  void addRow(int row);
+
+  void removeRow(int row);
+
+  // move the widgets kept for rows at and below fromRow by delta rows
+  void shiftRows(int fromRow, int delta);
+
+  // row of m_gridLayout holding a grid row, layout rows 1 and gridRow(rowCount()) are the spacers
+  int gridRow(int row) const;
+
+  int firstDataRow() const;
+
+  // actual height of a shown row, the last known or estimated height of any other one
+  int rowHeight(int row);
+
+  void buildRow(int row);
+
+  // put the widgets of a built row in the grid and apply the current selection and filters to them
+  void showRow(int row);
+
+  // take the widgets of a shown row out of the grid, keeping them for when the row comes back in view
+  void hideRow(int row);
 
-  std::vector<QGridLayout *> m_gridLayouts;
+  void deleteRow(int row);
+
+  // delete the kept rows furthest from the view past MAX_CACHED_ROWS
+  void evictRows();
+
+  // Only the rows in view plus ROW_MARGIN rows on either side have their widgets in the grid, the rest are stood
+  // in for by two empty layout rows of the same height so that the scroll range is unchanged.  Row 0 is
+  // always built as it is the header.  Selection and filters work on the objects, see ObjectSelector.
+  static const int ROW_MARGIN = 20;
+
+  // rows scrolled out of view keep their widgets, up to this many, so that scrolling back does not rebuild them
+  static const int MAX_CACHED_ROWS = 100;
+
+  struct Row
+  {
+    std::vector<QWidget *> widgets;
+    bool inLayout = false;
+    int height = 0;
+  };
+
+  // the height the grid gives a shown row, that of its tallest visible cell
+  void measureRow(Row & row) const;
+
+  std::map<int, Row> m_rows;
+
+  QGridLayout * m_gridLayout = nullptr;
 
   OSCollapsibleView * m_CollapsibleView;
 
@@ -150,6 +204,17 @@ private:
   int m_rowToAdd = -1;
 
   int m_rowToRemove = -1;
+
+  // rows in the grid, [m_firstRow, m_lastRow] plus the header
+  int m_firstRow = 0;
+
+  int m_lastRow = -1;
+
+  int m_bottomSpacerRow = -1;
+
+  QTimer m_updateRowsTimer;
+
+  QScrollArea * m_scrollArea = nullptr;
 };
 
 } // openstudio
@@ -34,6 +34,7 @@
 #include "../core/FilesystemHelpers.hpp"
 #include "../core/StringHelpers.hpp"
 #include "../core/FileReference.hpp"
+#include "../core/Checksum.hpp"
 #include "../core/Assert.hpp"
 
 #include <OpenStudio.hxx>
@@ -42,6 +43,13 @@
 #include <QSettings>
 #include <QRegularExpression>
 
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <map>
+#include <set>
+#include <sstream>
+#include <thread>
 
 #include <src/utilities/embedded_files.hxx>
 
@@ -1055,13 +1063,200 @@ namespace openstudio{
     return missing;
   }
 
+  namespace {
+
+    /// Checksums of the files in a measure directory along with the size and modification time they were computed
+    /// for. The cache is persisted in the measure directory so checkForUpdatesFiles only hashes files that changed.
+    class MeasureChecksumCache
+    {
+    public:
+
+      explicit MeasureChecksumCache(const openstudio::path& directory)
+        : m_directory(directory), m_cachePath(directory / toPath(".measure_checksums")), m_dirty(false)
+      {
+        openstudio::filesystem::ifstream file(m_cachePath);
+        std::string line;
+        if (!file || !std::getline(file, line) || line != cacheHeader()){
+          return;
+        }
+
+        // a cache that does not parse completely is not used at all, it is rewritten after hashing
+        std::map<std::string, Entry> entries;
+        while (std::getline(file, line)){
+          std::istringstream ss(line);
+          Entry entry;
+          std::string key;
+          if (!(ss >> entry.checksum >> entry.size >> entry.lastWriteTime) || !std::getline(ss >> std::ws, key) || key.empty()){
+            return;
+          }
+          entries[key] = entry;
+        }
+        if (file.bad()){
+          return;
+        }
+        m_entries.swap(entries);
+      }
+
+      /// Returns the checksum of each path. Files whose size or modification time do not match the cache are hashed
+      /// in parallel.
+      std::vector<std::string> checksums(const std::vector<openstudio::path>& paths)
+      {
+        std::vector<std::string> result(paths.size());
+        std::vector<size_t> toHash;
+        for (size_t i = 0; i < paths.size(); ++i){
+          Entry stat;
+          std::string key = this->key(paths[i]);
+          auto it = m_entries.find(key);
+          if (fileStat(paths[i], stat) && (it != m_entries.end()) &&
+              (it->second.size == stat.size) && (it->second.lastWriteTime == stat.lastWriteTime)){
+            result[i] = it->second.checksum;
+            m_seen.insert(key);
+          }else{
+            toHash.push_back(i);
+          }
+        }
+
+        std::atomic<size_t> next(0);
+        auto worker = [&](){
+          for (size_t j = next++; j < toHash.size(); j = next++){
+            result[toHash[j]] = openstudio::checksum(paths[toHash[j]]);
+          }
+        };
+
+        size_t numThreads = std::min<size_t>(std::thread::hardware_concurrency(), toHash.size());
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < numThreads; ++i){
+          threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads){
+          thread.join();
+        }
+
+        for (size_t i : toHash){
+          record(paths[i], result[i]);
+        }
+
+        return result;
+      }
+
+      /// Record the checksum of a file hashed elsewhere.
+      void record(const openstudio::path& path, const std::string& checksum)
+      {
+        Entry entry;
+        if (!fileStat(path, entry)){
+          return;
+        }
+        entry.checksum = checksum;
+        std::string key = this->key(path);
+        m_entries[key] = entry;
+        m_seen.insert(key);
+        m_dirty = true;
+      }
+
+      /// Write the cache if anything changed, dropping files that were not seen. The cache is written to a temporary
+      /// file in the measure directory and renamed over the old one, so readers never see a partially written cache.
+      /// Failures are ignored, measures in read only directories just do not get a cache.
+      void save()
+      {
+        if (!m_dirty && m_seen.size() == m_entries.size()){
+          return;
+        }
+
+        // a file modified again within the timestamp resolution would keep its size and time, only keep entries
+        // that are old enough for a later change to show up
+        time_t trustedBefore = std::time(nullptr) - 2;
+
+        openstudio::path tempPath;
+        try{
+          tempPath = m_directory / openstudio::filesystem::unique_path(".measure_checksums-%%%%-%%%%-%%%%");
+          {
+            openstudio::filesystem::ofstream file(tempPath, std::ios_base::trunc);
+            if (!file){
+              return;
+            }
+            file << cacheHeader() << '\n';
+            for (const auto& entry : m_entries){
+              if (m_seen.count(entry.first) && entry.second.lastWriteTime < trustedBefore){
+                file << entry.second.checksum << ' ' << entry.second.size << ' ' << entry.second.lastWriteTime << ' ' << entry.first << '\n';
+              }
+            }
+            file.close();
+            if (!file){
+              removeTempFile(tempPath);
+              return;
+            }
+          }
+          openstudio::filesystem::rename(tempPath, m_cachePath);
+        }catch(...){
+          removeTempFile(tempPath);
+        }
+      }
+
+    private:
+
+      struct Entry
+      {
+        Entry() : size(0), lastWriteTime(0) {}
+
+        std::string checksum;
+        uintmax_t size;
+        time_t lastWriteTime;
+      };
+
+      static const std::string& cacheHeader()
+      {
+        static const std::string header = "OpenStudio measure checksums 1";
+        return header;
+      }
+
+      static bool fileStat(const openstudio::path& path, Entry& entry)
+      {
+        try{
+          if (!openstudio::filesystem::is_regular_file(path)){
+            return false;
+          }
+          entry.size = openstudio::filesystem::file_size(path);
+          entry.lastWriteTime = openstudio::filesystem::last_write_time_as_time_t(path);
+          return true;
+        }catch(...){
+        }
+        return false;
+      }
+
+      static void removeTempFile(const openstudio::path& path)
+      {
+        if (path.empty()){
+          return;
+        }
+        boost::system::error_code ec;
+        openstudio::filesystem::remove(path, ec);
+      }
+
+      std::string key(const openstudio::path& path) const
+      {
+        return toString(relativePath(path, m_directory));
+      }
+
+      openstudio::path m_directory;
+      openstudio::path m_cachePath;
+      std::map<std::string, Entry> m_entries;
+      std::set<std::string> m_seen;
+      bool m_dirty;
+    };
+
+  }
+
   bool BCLMeasure::checkForUpdatesFiles()
   {
     bool result = false;
 
+    MeasureChecksumCache checksumCache(m_directory);
+
     std::vector<BCLFileReference> filesToRemove;
     std::vector<BCLFileReference> filesToAdd;
-    for (BCLFileReference file : m_bclXML.files()) {
+    std::vector<BCLFileReference> filesToCheck;
+    for (const BCLFileReference& file : m_bclXML.files()) {
       std::string filename = file.fileName();
       if (!exists(file.path())){
         result = true;
@@ -1074,9 +1269,22 @@ namespace openstudio{
           result = true;
           filesToRemove.push_back(file);
         }
-      }else if (file.checkForUpdate()){
+      }else{
+        filesToCheck.push_back(file);
+      }
+    }
+
+    // unchanged files get their checksum from the cache, the rest are hashed together
+    std::vector<openstudio::path> pathsToCheck;
+    for (const BCLFileReference& file : filesToCheck) {
+      pathsToCheck.push_back(file.path());
+    }
+    std::vector<std::string> checksums = checksumCache.checksums(pathsToCheck);
+    for (size_t i = 0; i < filesToCheck.size(); ++i) {
+      if (filesToCheck[i].checksum() != checksums[i]){
+        filesToCheck[i].setChecksum(checksums[i]);
         result = true;
-        filesToAdd.push_back(file);
+        filesToAdd.push_back(filesToCheck[i]);
       }
     }
 
@@ -1214,7 +1422,9 @@ namespace openstudio{
 
     for (const BCLFileReference& file : filesToAdd) {
       m_bclXML.addFile(file);
+      checksumCache.record(file.path(), file.checksum());
     }
+    checksumCache.save();
 
     // increment version if anything changed
     if (result){
@@ -40,6 +40,10 @@
 #include <QSettings>
 #include <QSqlQuery>
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+
 
 
 namespace openstudio{
@@ -47,7 +51,8 @@ namespace openstudio{
   LocalBCL::LocalBCL(const path& libraryPath):
     m_libraryPath(QDir().cleanPath(toQString(libraryPath))),
     m_dbName(QString("/components.sql")),
-    dbVersion("1.3")
+    dbVersion("1.3"),
+    m_searchIndexAvailable(false)
   {
     //Make sure a QApplication exists
     openstudio::Application::instance().application(false);
@@ -77,6 +82,9 @@ namespace openstudio{
     //Check for out-of-date database
     updateLocalDb();
 
+    //Create or refresh the full text search index
+    m_searchIndexAvailable = initializeSearchIndex();
+
     //Retrieve oauthConsumerKeys from database
     QSqlQuery query(database);
     query.exec("SELECT data FROM Settings WHERE name='prodAuthKey'");
@@ -112,7 +120,7 @@ namespace openstudio{
   LocalBCL &LocalBCL::instance(const path& libraryPath)
   {
     std::shared_ptr<LocalBCL> &ptr = instanceInternal();
-    if (ptr) {
+    if (!ptr) {
       ptr = std::shared_ptr<LocalBCL>(new LocalBCL(libraryPath));
     }
     else
@@ -282,6 +290,293 @@ namespace openstudio{
     return false;
   }
 
+  bool LocalBCL::initializeSearchIndex()
+  {
+    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
+    QSqlQuery query(database);
+
+    bool exists = query.exec("SELECT name FROM sqlite_master WHERE type='table' AND name='SearchIndex'") && query.next();
+    if (!exists)
+    {
+      // uid, version_id, and type are stored for lookup but not tokenized
+      if (!query.exec("CREATE VIRTUAL TABLE SearchIndex USING fts4(uid, version_id, type, name, description, tags, "
+        "attributes, notindexed=uid, notindexed=version_id, notindexed=type)"))
+      {
+        LOG(Warn, "Full text search is not available for the local BCL, searches will scan the library");
+        return false;
+      }
+    }
+
+    // the index may be missing rows if it was just created or if the library was modified by an older version
+    bool inSync = query.exec("SELECT (SELECT COUNT(*) FROM Components) + (SELECT COUNT(*) FROM Measures), "
+      "(SELECT COUNT(*) FROM SearchIndex)") && query.next() && (query.value(0).toLongLong() == query.value(1).toLongLong());
+    if (!inSync)
+    {
+      return rebuildSearchIndex();
+    }
+    return true;
+  }
+
+  bool LocalBCL::rebuildSearchIndex()
+  {
+    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
+    QSqlQuery query(database);
+    QSqlQuery insertQuery(database);
+
+    database.transaction();
+    bool success = query.exec("DELETE FROM SearchIndex");
+
+    std::map<std::pair<QString, QString>, QString> attributes;
+    success = success && query.exec("SELECT uid, version_id, name, value FROM Attributes");
+    while (success && query.next())
+    {
+      QString& text = attributes[std::make_pair(query.value(0).toString(), query.value(1).toString())];
+      text += query.value(2).toString() + " " + query.value(3).toString() + " ";
+    }
+
+    insertQuery.prepare("INSERT INTO SearchIndex (uid, version_id, type, name, description, tags, attributes) "
+      "VALUES (:uid, :versionId, :type, :name, :description, :tags, :attributes)");
+
+    success = success && query.exec("SELECT uid, version_id, name, description FROM Components");
+    while (success && query.next())
+    {
+      insertQuery.bindValue(":uid", query.value(0));
+      insertQuery.bindValue(":versionId", query.value(1));
+      insertQuery.bindValue(":type", "component");
+      insertQuery.bindValue(":name", query.value(2));
+      insertQuery.bindValue(":description", query.value(3));
+      insertQuery.bindValue(":tags", "");
+      insertQuery.bindValue(":attributes", attributes[std::make_pair(query.value(0).toString(), query.value(1).toString())]);
+      success = insertQuery.exec();
+    }
+
+    success = success && query.exec("SELECT uid, version_id, name, description, modeler_description FROM Measures");
+    while (success && query.next())
+    {
+      // tags are only stored in measure.xml
+      QString tags;
+      boost::optional<BCLMeasure> measure = BCLMeasure::load(toPath(m_libraryPath) / toPath(query.value(0).toString()) / toPath(query.value(1).toString()));
+      if (measure)
+      {
+        for (const std::string& tag : measure->tags())
+        {
+          tags += toQString(tag) + " ";
+        }
+      }
+
+      insertQuery.bindValue(":uid", query.value(0));
+      insertQuery.bindValue(":versionId", query.value(1));
+      insertQuery.bindValue(":type", "measure");
+      insertQuery.bindValue(":name", query.value(2));
+      insertQuery.bindValue(":description", query.value(3).toString() + " " + query.value(4).toString());
+      insertQuery.bindValue(":tags", tags);
+      insertQuery.bindValue(":attributes", attributes[std::make_pair(query.value(0).toString(), query.value(1).toString())]);
+      success = insertQuery.exec();
+    }
+
+    if (success)
+    {
+      success = database.commit();
+    }
+    else
+    {
+      database.rollback();
+      LOG(Warn, "Unable to build the full text search index for the local BCL, searches will scan the library");
+    }
+    return success;
+  }
+
+  bool LocalBCL::indexComponent(BCLComponent& component)
+  {
+    if (!m_searchIndexAvailable)
+    {
+      return true;
+    }
+
+    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
+    QSqlQuery query(database);
+    if (!removeFromSearchIndex(component.uid(), component.versionId()))
+    {
+      return false;
+    }
+    query.prepare("INSERT INTO SearchIndex (uid, version_id, type, name, description, tags, attributes) "
+      "VALUES (:uid, :versionId, 'component', :name, :description, '', :attributes)");
+    query.bindValue(":uid", toQString(component.uid()));
+    query.bindValue(":versionId", toQString(component.versionId()));
+    query.bindValue(":name", toQString(component.name()));
+    query.bindValue(":description", toQString(component.description()));
+    query.bindValue(":attributes", toQString(attributesSearchText(component.attributes())));
+    return query.exec();
+  }
+
+  bool LocalBCL::indexMeasure(BCLMeasure& measure)
+  {
+    if (!m_searchIndexAvailable)
+    {
+      return true;
+    }
+
+    std::string tags;
+    for (const std::string& tag : measure.tags())
+    {
+      tags += tag + " ";
+    }
+
+    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
+    QSqlQuery query(database);
+    if (!removeFromSearchIndex(measure.uid(), measure.versionId()))
+    {
+      return false;
+    }
+    query.prepare("INSERT INTO SearchIndex (uid, version_id, type, name, description, tags, attributes) "
+      "VALUES (:uid, :versionId, 'measure', :name, :description, :tags, :attributes)");
+    query.bindValue(":uid", toQString(measure.uid()));
+    query.bindValue(":versionId", toQString(measure.versionId()));
+    query.bindValue(":name", toQString(measure.name()));
+    query.bindValue(":description", toQString(measure.description() + " " + measure.modelerDescription()));
+    query.bindValue(":tags", toQString(tags));
+    query.bindValue(":attributes", toQString(attributesSearchText(measure.attributes())));
+    return query.exec();
+  }
+
+  bool LocalBCL::removeFromSearchIndex(const std::string& uid, const std::string& versionId)
+  {
+    if (!m_searchIndexAvailable)
+    {
+      return true;
+    }
+
+    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
+    QSqlQuery query(database);
+    query.prepare("DELETE FROM SearchIndex WHERE uid = :uid AND version_id = :versionId");
+    query.bindValue(":uid", toQString(uid));
+    query.bindValue(":versionId", toQString(versionId));
+    return query.exec();
+  }
+
+  std::string LocalBCL::attributesSearchText(const std::vector<Attribute>& attributes)
+  {
+    std::string result;
+    for (const Attribute& attribute : attributes)
+    {
+      result += attribute.name() + " ";
+      if (attribute.valueType().value() == AttributeValueType::String) {
+        result += attribute.valueAsString() + " ";
+      } else if (attribute.valueType().value() == AttributeValueType::Double) {
+        result += formatString(attribute.valueAsDouble()) + " ";
+      } else if (attribute.valueType().value() == AttributeValueType::Integer) {
+        result += boost::lexical_cast<std::string>(attribute.valueAsInteger()) + " ";
+      }
+    }
+    return result;
+  }
+
+  std::vector<std::pair<std::string, std::string> > LocalBCL::searchIndex(const std::string& searchTerm,
+    const std::string& type, unsigned offset, unsigned limit) const
+  {
+    std::vector<std::pair<std::string, std::string> > result;
+
+    // split into the same words the default fts tokenizer produces and match each as a prefix
+    QString matchExpression;
+    QString word;
+    QString term = toQString(searchTerm) + " ";
+    for (const QChar& c : term)
+    {
+      ushort u = c.unicode();
+      bool wordChar = (u >= 128) || (u >= '0' && u <= '9') || (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z');
+      if (wordChar)
+      {
+        word += c;
+      }
+      else if (!word.isEmpty())
+      {
+        matchExpression += "\"" + word + "\"* ";
+        word.clear();
+      }
+    }
+
+    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
+    QSqlQuery query(database);
+
+    if (matchExpression.isEmpty())
+    {
+      query.prepare("SELECT uid, version_id FROM SearchIndex WHERE type = :type ORDER BY name");
+      query.bindValue(":type", toQString(type));
+      if (query.exec())
+      {
+        for (unsigned i = 0; query.next(); ++i)
+        {
+          if (i < offset) continue;
+          if (limit != 0 && result.size() >= limit) break;
+          result.push_back(std::make_pair(toString(query.value(0).toString()), toString(query.value(1).toString())));
+        }
+      }
+      return result;
+    }
+
+    // 'pcx' is the number of phrases, the number of columns, then for each phrase and column the hits in
+    // this row, the hits in all rows, and the number of rows with hits
+    query.prepare("SELECT uid, version_id, matchinfo(SearchIndex, 'pcx') FROM SearchIndex "
+      "WHERE SearchIndex MATCH :match AND type = :type");
+    query.bindValue(":match", matchExpression.trimmed());
+    query.bindValue(":type", toQString(type));
+    if (!query.exec())
+    {
+      LOG(Warn, "Full text search for '" << searchTerm << "' failed");
+      return result;
+    }
+
+    // weights for uid, version_id, type, name, description, tags, attributes
+    static const double columnWeights[] = {0.0, 0.0, 0.0, 8.0, 2.0, 4.0, 1.0};
+    static const unsigned numWeights = sizeof(columnWeights) / sizeof(columnWeights[0]);
+
+    std::vector<std::pair<double, std::pair<std::string, std::string> > > ranked;
+    while (query.next())
+    {
+      QByteArray matchInfo = query.value(2).toByteArray();
+      std::vector<uint32_t> info(matchInfo.size() / sizeof(uint32_t));
+      if (!info.empty())
+      {
+        std::memcpy(info.data(), matchInfo.constData(), info.size() * sizeof(uint32_t));
+      }
+
+      double score = 0.0;
+      if (info.size() >= 2)
+      {
+        unsigned numPhrases = info[0];
+        unsigned numColumns = info[1];
+        if (info.size() >= 2 + 3 * numPhrases * numColumns)
+        {
+          for (unsigned p = 0; p < numPhrases; ++p)
+          {
+            for (unsigned c = 0; c < numColumns && c < numWeights; ++c)
+            {
+              const uint32_t* x = &info[2 + 3 * (p * numColumns + c)];
+              if (x[0] > 0)
+              {
+                score += columnWeights[c] * static_cast<double>(x[0]) / static_cast<double>(std::max<uint32_t>(x[1], 1u));
+              }
+            }
+          }
+        }
+      }
+
+      ranked.push_back(std::make_pair(score, std::make_pair(toString(query.value(0).toString()), toString(query.value(1).toString()))));
+    }
+
+    std::stable_sort(ranked.begin(), ranked.end(),
+      [](const std::pair<double, std::pair<std::string, std::string> >& a, const std::pair<double, std::pair<std::string, std::string> >& b) {
+        return a.first > b.first;
+      });
+
+    for (size_t i = offset; i < ranked.size(); ++i)
+    {
+      if (limit != 0 && result.size() >= limit) break;
+      result.push_back(ranked[i].second);
+    }
+    return result;
+  }
+
   /// Inherited members
 
   boost::optional<BCLComponent> LocalBCL::getComponent(const std::string& uid, const std::string& versionId) const
@@ -398,6 +693,11 @@ namespace openstudio{
   std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm,
     const std::string& componentType) const
   {
+    if (m_searchIndexAvailable)
+    {
+      return searchComponents(searchTerm, componentType, 0, 0);
+    }
+
     std::vector<BCLComponent> results;
     QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
     QSqlQuery query(database);
@@ -420,9 +720,39 @@ namespace openstudio{
     return searchComponents(searchTerm, "");
   }
 
+  std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm,
+    const std::string& componentType, unsigned page, unsigned resultsPerPage) const
+  {
+    if (!m_searchIndexAvailable)
+    {
+      std::vector<BCLComponent> all = searchComponents(searchTerm, componentType);
+      size_t begin = std::min<size_t>(static_cast<size_t>(page) * resultsPerPage, all.size());
+      size_t end = (resultsPerPage == 0) ? all.size() : std::min<size_t>(begin + resultsPerPage, all.size());
+      return std::vector<BCLComponent>(all.begin() + begin, all.begin() + end);
+    }
+
+    // only the requested page is loaded from disk
+    std::vector<BCLComponent> results;
+    for (const auto& uid : searchIndex(searchTerm, "component", page * resultsPerPage, resultsPerPage))
+    {
+      // DLM: this does not look like it is handling error of missing file correctly
+      boost::optional<BCLComponent> current(toString(toPath(m_libraryPath) / toPath(uid.first) / toPath(uid.second)));
+      if (current)
+      {
+        results.push_back(*current);
+      }
+    }
+    return results;
+  }
+
   std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm,
     const std::string& componentType) const
   {
+    if (m_searchIndexAvailable)
+    {
+      return searchMeasures(searchTerm, componentType, 0, 0);
+    }
+
     std::vector<BCLMeasure> results;
     QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
     QSqlQuery query(database);
@@ -445,6 +775,30 @@ namespace openstudio{
     return searchMeasures(searchTerm, "");
   }
 
+  std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm,
+    const std::string& componentType, unsigned page, unsigned resultsPerPage) const
+  {
+    if (!m_searchIndexAvailable)
+    {
+      std::vector<BCLMeasure> all = searchMeasures(searchTerm, componentType);
+      size_t begin = std::min<size_t>(static_cast<size_t>(page) * resultsPerPage, all.size());
+      size_t end = (resultsPerPage == 0) ? all.size() : std::min<size_t>(begin + resultsPerPage, all.size());
+      return std::vector<BCLMeasure>(all.begin() + begin, all.begin() + end);
+    }
+
+    // only the requested page is loaded from disk
+    std::vector<BCLMeasure> results;
+    for (const auto& uid : searchIndex(searchTerm, "measure", page * resultsPerPage, resultsPerPage))
+    {
+      boost::optional<BCLMeasure> current = BCLMeasure::load(toPath(m_libraryPath) / toPath(uid.first) / toPath(uid.second));
+      if (current)
+      {
+        results.push_back(*current);
+      }
+    }
+    return results;
+  }
+
   /// Class members
 
   bool LocalBCL::addComponent(BCLComponent& component)
@@ -508,7 +862,7 @@ namespace openstudio{
             return false;
         }
       }
-      return true;
+      return indexComponent(component);
     }
 
     return false;
@@ -546,6 +900,9 @@ namespace openstudio{
       escape(component.versionId())));
     OS_ASSERT(test);
 
+    test = removeFromSearchIndex(component.uid(), component.versionId());
+    OS_ASSERT(test);
+
     return true;
   }
 
@@ -611,7 +968,7 @@ namespace openstudio{
             return false;
         }
       }
-      return true;
+      return indexMeasure(measure);
     }
     return false;
   }
@@ -648,6 +1005,9 @@ namespace openstudio{
       escape(measure.versionId())));
     OS_ASSERT(test);
 
+    test = removeFromSearchIndex(measure.uid(), measure.versionId());
+    OS_ASSERT(test);
+
     return true;
   }
 
@@ -110,6 +110,18 @@ namespace openstudio{
     virtual std::vector<BCLMeasure> searchMeasures(const std::string& searchTerm,
       const unsigned componentTypeTID) const;
 
+    /// Perform a ranked component search of the library, results are returned in 'pages' of resultsPerPage.
+    /// Each word in searchTerm must match the start of a word in the name, description, or attributes,
+    /// results with matches in the name rank first. An empty searchTerm lists all components.
+    std::vector<BCLComponent> searchComponents(const std::string& searchTerm,
+      const std::string& componentType, unsigned page, unsigned resultsPerPage) const;
+
+    /// Perform a ranked measure search of the library, results are returned in 'pages' of resultsPerPage.
+    /// Each word in searchTerm must match the start of a word in the name, description, modeler description,
+    /// tags, or attributes, results with matches in the name rank first. An empty searchTerm lists all measures.
+    std::vector<BCLMeasure> searchMeasures(const std::string& searchTerm,
+      const std::string& componentType, unsigned page, unsigned resultsPerPage) const;
+
     //@}
     /** @name Class members */
     //@{
@@ -168,6 +180,24 @@ namespace openstudio{
 
     bool updateLocalDb();
 
+    /// Creates the full text search index if needed and rebuilds it if it is out of sync with the library
+    bool initializeSearchIndex();
+
+    bool rebuildSearchIndex();
+
+    bool indexComponent(BCLComponent& component);
+
+    bool indexMeasure(BCLMeasure& measure);
+
+    bool removeFromSearchIndex(const std::string& uid, const std::string& versionId);
+
+    std::string attributesSearchText(const std::vector<Attribute>& attributes);
+
+    /// Returns ranked (uid, version_id) pairs of type "component" or "measure" from the search index,
+    /// skipping the first offset results and returning at most limit results if limit is not 0
+    std::vector<std::pair<std::string, std::string> > searchIndex(const std::string& searchTerm,
+      const std::string& type, unsigned offset, unsigned limit) const;
+
     bool validateProdAuthKey(const std::string& authKey);
     bool validateDevAuthKey(const std::string& authKey);
 
@@ -181,11 +211,14 @@ namespace openstudio{
 
     static std::shared_ptr<LocalBCL> &instanceInternal();
 
+    REGISTER_LOGGER("openstudio.LocalBCL");
+
     QString m_libraryPath;
     const QString m_dbName;
     QString dbVersion;
     std::string m_prodAuthKey;
     std::string m_devAuthKey;
+    bool m_searchIndexAvailable;
   };
 
 } // openstudio
@@ -33,6 +33,8 @@
 
 #include "../BCLMeasure.hpp"
 
+#include <ctime>
+
 
 using namespace openstudio;
 
@@ -122,6 +124,73 @@ TEST_F(BCLFixture, BCLMeasure)
   ASSERT_TRUE(measure2->primaryRubyScriptPath());
 }
 
+TEST_F(BCLFixture, BCLMeasure_ChecksumCache)
+{
+  openstudio::path dir = resourcesPath() / toPath("/utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/");
+  boost::optional<BCLMeasure> measure = BCLMeasure::load(dir);
+  ASSERT_TRUE(measure);
+
+  openstudio::path dir2 = resourcesPath() / toPath("/utilities/BCL/Measures/v2/SetWindowToWallRatioByFacadeCache/");
+  if (openstudio::filesystem::exists(dir2)){
+    ASSERT_TRUE(removeDirectory(dir2));
+  }
+  boost::optional<BCLMeasure> measure2 = measure->clone(dir2);
+  ASSERT_TRUE(measure2);
+
+  // recently written files are hashed every time, age them so they can be cached
+  std::time_t anHourAgo = std::time(nullptr) - 3600;
+  for (const BCLFileReference& file : measure2->files()) {
+    openstudio::filesystem::last_write_time(file.path(), anHourAgo);
+  }
+
+  openstudio::path cachePath = dir2 / toPath(".measure_checksums");
+  EXPECT_FALSE(openstudio::filesystem::exists(cachePath));
+  EXPECT_FALSE(measure2->checkForUpdatesFiles());
+  EXPECT_TRUE(openstudio::filesystem::exists(cachePath));
+
+  measure2 = BCLMeasure::load(dir2);
+  ASSERT_TRUE(measure2);
+  EXPECT_FALSE(measure2->checkForUpdatesFiles());
+  EXPECT_EQ(6u, measure2->files().size());
+
+  // same size but different contents and time is still picked up
+  openstudio::path scriptPath = measure2->primaryRubyScriptPath().get();
+  std::uintmax_t size = openstudio::filesystem::file_size(scriptPath);
+  {
+    openstudio::filesystem::ofstream file(scriptPath, std::ios_base::trunc);
+    ASSERT_TRUE(file.is_open());
+    file << std::string(static_cast<size_t>(size), '#');
+  }
+  openstudio::filesystem::last_write_time(scriptPath, anHourAgo + 60);
+  EXPECT_EQ(size, openstudio::filesystem::file_size(scriptPath));
+  EXPECT_TRUE(measure2->checkForUpdatesFiles());
+  EXPECT_FALSE(measure2->checkForUpdatesFiles());
+
+  // a cache that does not parse completely is not used, even the entries before the bad line
+  {
+    openstudio::filesystem::ofstream file(cachePath, std::ios_base::trunc);
+    ASSERT_TRUE(file.is_open());
+    file << "OpenStudio measure checksums 1\n";
+    file << "00000000-00000000 " << size << ' ' << (anHourAgo + 60) << ' ' << toString(scriptPath.filename()) << '\n';
+    file << "truncated\n";
+  }
+  EXPECT_FALSE(measure2->checkForUpdatesFiles());
+
+  // the cache is rewritten in place without leaving temporary files behind
+  EXPECT_TRUE(openstudio::filesystem::exists(cachePath));
+  for (openstudio::filesystem::directory_iterator it(dir2); it != openstudio::filesystem::directory_iterator(); ++it){
+    EXPECT_EQ(std::string::npos, toString(it->path().filename()).find(".measure_checksums-"));
+  }
+
+  // the cache file is not part of the measure
+  for (const BCLFileReference& file : measure2->files()) {
+    EXPECT_NE(".measure_checksums", file.fileName());
+  }
+
+  measure2.reset();
+  ASSERT_TRUE(removeDirectory(dir2));
+}
+
 TEST_F(BCLFixture, BCLMeasure_CTor)
 {
   openstudio::path dir = openstudio::filesystem::system_complete(toPath("./TestMeasure/"));
@@ -35,6 +35,7 @@
 #include "../../idd/IddFile.hpp"
 #include "../../idf/Workspace.hpp"
 #include "../../core/FilesystemHelpers.hpp"
+#include "../../core/PathHelpers.hpp"
 
 #include <QDir>
 
@@ -51,6 +52,44 @@ TEST_F(BCLFixture, LocalBCL_AuthKey)
   //EXPECT_EQ(defaultDevAuthKey, LocalBCL::instance().devAuthKey());
 }
 
+TEST_F(BCLFixture, LocalBCL_SearchIndex)
+{
+  openstudio::path libraryPath = resourcesPath() / toPath("utilities/BCL/LocalBCLSearchIndex");
+  if (openstudio::filesystem::exists(libraryPath)){
+    ASSERT_TRUE(removeDirectory(libraryPath));
+  }
+  LocalBCL::close();
+  LocalBCL& bcl = LocalBCL::instance(libraryPath);
+
+  boost::optional<BCLMeasure> source = BCLMeasure::load(resourcesPath() / toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/"));
+  ASSERT_TRUE(source);
+  boost::optional<BCLMeasure> measure = source->clone(libraryPath / toPath(source->uid()) / toPath(source->versionId()));
+  ASSERT_TRUE(measure);
+  EXPECT_TRUE(bcl.addMeasure(*measure));
+
+  // each word matches the start of a word in any field, ignoring case
+  EXPECT_EQ(1u, bcl.searchMeasures("window", "").size());
+  EXPECT_EQ(1u, bcl.searchMeasures("Wind FACADE", "").size());
+  EXPECT_EQ(1u, bcl.searchMeasures("fenestration", "").size());
+  EXPECT_EQ(1u, bcl.searchMeasures("", "").size());
+  EXPECT_TRUE(bcl.searchMeasures("window zzzz", "").empty());
+  EXPECT_TRUE(bcl.searchComponents("window", "").empty());
+
+  EXPECT_EQ(1u, bcl.searchMeasures("window", "", 0, 10).size());
+  EXPECT_TRUE(bcl.searchMeasures("window", "", 1, 10).empty());
+
+  // the index persists with the library
+  LocalBCL::close();
+  LocalBCL& reopened = LocalBCL::instance(libraryPath);
+  EXPECT_EQ(1u, reopened.searchMeasures("window", "").size());
+
+  EXPECT_TRUE(reopened.removeMeasure(*measure));
+  EXPECT_TRUE(reopened.searchMeasures("window", "").empty());
+
+  LocalBCL::close();
+  removeDirectory(libraryPath);
+}
+
 TEST_F(BCLFixture, RemoteBCLTest)
 {
   RemoteBCL remoteBCL;
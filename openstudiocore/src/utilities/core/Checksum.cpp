@@ -29,9 +29,10 @@
 
 #include "Checksum.hpp"
 
-#include <sstream>
+#include <QFile>
 
-#include <boost/crc.hpp>
+#include <cstdint>
+#include <cstring>
 
 
 namespace openstudio {
@@ -48,41 +49,127 @@ namespace openstudio {
 
       return result;
     }
+
+    namespace {
+
+      /// lookup tables for slice-by-8 evaluation of the reflected CRC-32 (polynomial 0x04C11DB7),
+      /// the same CRC computed by boost::crc_32_type
+      struct Crc32Tables
+      {
+        uint32_t table[8][256];
+
+        Crc32Tables()
+        {
+          for (uint32_t i = 0; i < 256; ++i){
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k){
+              c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            }
+            table[0][i] = c;
+          }
+          for (uint32_t i = 0; i < 256; ++i){
+            for (int slice = 1; slice < 8; ++slice){
+              uint32_t previous = table[slice - 1][i];
+              table[slice][i] = (previous >> 8) ^ table[0][previous & 0xFFu];
+            }
+          }
+        }
+      };
+
+      const Crc32Tables& crc32Tables()
+      {
+        static const Crc32Tables tables;
+        return tables;
+      }
+
+      inline uint32_t loadLittleEndian32(const unsigned char* p)
+      {
+        return static_cast<uint32_t>(p[0]) |
+               (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) |
+               (static_cast<uint32_t>(p[3]) << 24);
+      }
+
+      /// update the running (pre-inverted) crc with n bytes, 8 bytes per step
+      uint32_t crc32Update(uint32_t crc, const unsigned char* p, size_t n)
+      {
+        const Crc32Tables& tables = crc32Tables();
+        const uint32_t (*t)[256] = tables.table;
+
+        while (n >= 8){
+          uint32_t one = crc ^ loadLittleEndian32(p);
+          uint32_t two = loadLittleEndian32(p + 4);
+          crc = t[7][one & 0xFFu] ^ t[6][(one >> 8) & 0xFFu] ^ t[5][(one >> 16) & 0xFFu] ^ t[4][one >> 24] ^
+                t[3][two & 0xFFu] ^ t[2][(two >> 8) & 0xFFu] ^ t[1][(two >> 16) & 0xFFu] ^ t[0][two >> 24];
+          p += 8;
+          n -= 8;
+        }
+
+        while (n > 0){
+          crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFFu];
+          ++p;
+          --n;
+        }
+
+        return crc;
+      }
+
+      /// update the running crc with the bytes of data, skipping any checksumIgnore characters in place
+      uint32_t crc32UpdateSkippingIgnored(uint32_t crc, const char* data, size_t n)
+      {
+        const char* end = data + n;
+        while (data < end){
+          const void* found = std::memchr(data, '\r', static_cast<size_t>(end - data));
+          const char* runEnd = found ? static_cast<const char*>(found) : end;
+          crc = crc32Update(crc, reinterpret_cast<const unsigned char*>(data), static_cast<size_t>(runEnd - data));
+          data = runEnd;
+          while (data < end && checksumIgnore(*data)){
+            ++data;
+          }
+        }
+        return crc;
+      }
+
+      std::string checksumString(uint32_t crc)
+      {
+        static const char digits[] = "0123456789ABCDEF";
+        std::string result(8, '0');
+        for (int i = 7; i >= 0; --i){
+          result[i] = digits[crc & 0xFu];
+          crc >>= 4;
+        }
+        return result;
+      }
+
+    }
   }
 
   /// return 8 character hex checksum of string
   std::string checksum(const std::string& s)
   {
-    std::stringstream ss(s);
-    return checksum(ss);
+    return checksum(s.data(), s.size());
+  }
+
+  /// return 8 character hex checksum of a buffer
+  std::string checksum(const char* data, size_t size)
+  {
+    uint32_t crc = detail::crc32UpdateSkippingIgnored(0xFFFFFFFFu, data, size);
+    return detail::checksumString(crc ^ 0xFFFFFFFFu);
   }
 
   /// return 8 character hex checksum of istream
   std::string checksum(std::istream& is)
   {
-    boost::crc_32_type  crc;
+    uint32_t crc = 0xFFFFFFFFu;
+    const std::streamsize n = 16384;
+    char buffer[n];
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
       is.read(buffer, n);
       std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-
-      crc.process_bytes(str.c_str(), stringSize);
+      crc = detail::crc32UpdateSkippingIgnored(crc, buffer, static_cast<size_t>(readSize));
     } while ( is );
 
-    std::stringstream ss;
-    ss << std::hex << std::uppercase << crc.checksum();
-    std::string result = "00000000";
-    std::string checksum = ss.str();
-    result.replace(8-checksum.size(), checksum.size(), checksum);
-
-    return result;
+    return detail::checksumString(crc ^ 0xFFFFFFFFu);
   }
 
   /// return 8 character hex checksum of file contents
@@ -90,6 +177,18 @@ namespace openstudio {
   {
     std::string result = "00000000";
     try{
+      // map regular files so the crc runs over the page cache without copying
+      QFile file(toQString(p));
+      if (file.open(QIODevice::ReadOnly) && file.size() > 0){
+        qint64 size = file.size();
+        uchar* data = file.map(0, size);
+        if (data){
+          result = checksum(reinterpret_cast<const char*>(data), static_cast<size_t>(size));
+          file.unmap(data);
+          return result;
+        }
+      }
+
       openstudio::filesystem::ifstream  ifs(p, std::ios_base::binary );
       if ( ifs ){
         result = checksum(ifs);
@@ -41,6 +41,9 @@ namespace openstudio {
   /// return 8 character hex checksum of string
   UTILITIES_API std::string checksum(const std::string& s);
 
+  /// return 8 character hex checksum of a buffer of size bytes
+  UTILITIES_API std::string checksum(const char* data, size_t size);
+
   /// return 8 character hex checksum of istream
   UTILITIES_API std::string checksum(std::istream& is);
 
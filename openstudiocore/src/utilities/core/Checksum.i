@@ -5,6 +5,9 @@
   #include <utilities/core/Checksum.hpp>
 %}
 
+// raw buffers are not wrapped, use the string overload
+%ignore openstudio::checksum(const char*, size_t);
+
 %include <utilities/core/Checksum.hpp>
 
 #endif //UTILITIES_CORE_CHECKSUM_I
@@ -45,6 +45,7 @@
 %include <utilities/core/Singleton.i>
 %include <utilities/core/Application.i>
 %include <utilities/core/Logger.i>
+%include <utilities/core/Trace.i>
 %include <utilities/core/UpdateManager.i>
 %include <utilities/core/Url.i>
 %include <utilities/core/UUID.i>
@@ -53,6 +53,8 @@ namespace openstudio{
 
     LogSink_Impl::~LogSink_Impl()
     {
+      releaseSink(m_sink.get());
+
       delete m_mutex;
     }
 
@@ -212,6 +214,8 @@ namespace openstudio{
         filterLogLevel = *m_logLevel;
       }
 
+      setSinkLogLevel(m_sink.get(), filterLogLevel);
+
       boost::regex filterChannelRegex(".*");
       if (m_channelRegex){
         filterChannelRegex = *m_channelRegex;
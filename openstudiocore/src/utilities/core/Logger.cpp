@@ -31,9 +31,18 @@
 
 #include <boost/log/common.hpp>
 #include <boost/log/attributes/function.hpp>
+#include <boost/log/attributes/mutable_constant.hpp>
+
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/tss.hpp>
 
 #include <boost/utility/empty_deleter.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 #include <QReadWriteLock>
 #include <QThread>
@@ -73,14 +82,347 @@ namespace openstudio{
     std::cout << "[Qt] <" << type << "> " << msg << std::endl;
   }
 
+  namespace detail {
+
+    namespace {
+
+      struct SinkLogLevel
+      {
+        LogLevel logLevel;
+        bool enabled;
+        // false once the LogSink_Impl is destroyed, the sink may still be registered in the core
+        bool owned;
+      };
+
+      // constant initialized, nothing is enabled until a sink is added
+      std::atomic<int> minimumLogLevel(Fatal + 1);
+
+      // intentionally leaked, sinks may be destroyed during static destruction
+      boost::mutex& sinkLogLevelsMutex()
+      {
+        static auto mutex = new boost::mutex();
+        return *mutex;
+      }
+
+      std::map<const LogSinkBackend*, SinkLogLevel>& sinkLogLevels()
+      {
+        static auto sinkLogLevels = new std::map<const LogSinkBackend*, SinkLogLevel>();
+        return *sinkLogLevels;
+      }
+
+      // caller must hold sinkLogLevelsMutex
+      void updateMinimumLogLevel()
+      {
+        int result = Fatal + 1;
+        for (const auto& sinkLogLevel : sinkLogLevels()) {
+          if (sinkLogLevel.second.enabled) {
+            result = std::min(result, static_cast<int>(sinkLogLevel.second.logLevel));
+          }
+        }
+        minimumLogLevel.store(result, std::memory_order_relaxed);
+      }
+
+      SinkLogLevel& sinkLogLevel(const LogSinkBackend* sink)
+      {
+        auto it = sinkLogLevels().find(sink);
+        if (it == sinkLogLevels().end()) {
+          // a sink without a filter accepts everything
+          SinkLogLevel newSinkLogLevel = {Trace, false, true};
+          it = sinkLogLevels().insert(std::make_pair(sink, newSinkLogLevel)).first;
+        }
+        return it->second;
+      }
+
+    } // anonymous namespace
+
+    void setSinkLogLevel(const LogSinkBackend* sink, LogLevel logLevel)
+    {
+      boost::lock_guard<boost::mutex> l(sinkLogLevelsMutex());
+
+      sinkLogLevel(sink).logLevel = logLevel;
+
+      updateMinimumLogLevel();
+    }
+
+    void setSinkEnabled(const LogSinkBackend* sink, bool enabled)
+    {
+      boost::lock_guard<boost::mutex> l(sinkLogLevelsMutex());
+
+      SinkLogLevel& entry = sinkLogLevel(sink);
+      entry.enabled = enabled;
+      if (!entry.enabled && !entry.owned) {
+        sinkLogLevels().erase(sink);
+      }
+
+      updateMinimumLogLevel();
+    }
+
+    void releaseSink(const LogSinkBackend* sink)
+    {
+      boost::lock_guard<boost::mutex> l(sinkLogLevelsMutex());
+
+      auto it = sinkLogLevels().find(sink);
+      if (it != sinkLogLevels().end()) {
+        if (it->second.enabled) {
+          // still in the logging core with its filter, keep its level until it is removed
+          it->second.owned = false;
+        } else {
+          sinkLogLevels().erase(it);
+        }
+      }
+    }
+
+    /// Per thread map of channel to logger, entries of LoggerSingleton::m_loggerMap are never removed
+    /// so the pointers stay valid for the lifetime of the singleton
+    class LoggerCache
+    {
+     public:
+
+      LoggerType* find(const LogChannel& logChannel)
+      {
+        CacheType* cache = m_cache.get();
+        if (!cache) {
+          return nullptr;
+        }
+
+        auto it = cache->find(logChannel);
+        if (it == cache->end()) {
+          return nullptr;
+        }
+
+        return it->second;
+      }
+
+      void insert(const LogChannel& logChannel, LoggerType* logger)
+      {
+        CacheType* cache = m_cache.get();
+        if (!cache) {
+          cache = new CacheType();
+          m_cache.reset(cache);
+        }
+
+        (*cache)[logChannel] = logger;
+      }
+
+     private:
+
+      typedef std::map<std::string, LoggerType*, openstudio::IstringCompare> CacheType;
+
+      boost::thread_specific_ptr<CacheType> m_cache;
+    };
+
+    struct AsyncLogRecord
+    {
+      LogLevel logLevel;
+      LogChannel logChannel;
+      std::string message;
+      QThread* thread;
+    };
+
+    /// Each logging thread appends to its own buffer, the only lock taken on that path is the buffer's
+    /// mutex which is contended only while the writer thread swaps the buffer out.
+    class AsyncLogQueue
+    {
+     public:
+
+      explicit AsyncLogQueue(LoggerSingleton& logger)
+        : m_logger(logger), m_running(false), m_stopRequested(false), m_threadAttribute(nullptr)
+      {}
+
+      ~AsyncLogQueue()
+      {
+        stop();
+      }
+
+      void start()
+      {
+        boost::lock_guard<boost::mutex> l(m_threadMutex);
+
+        if (m_running) {
+          return;
+        }
+
+        {
+          boost::lock_guard<boost::mutex> l2(m_wakeMutex);
+          m_stopRequested = false;
+        }
+
+        m_running = true;
+        m_thread = boost::thread(&AsyncLogQueue::run, this);
+      }
+
+      void stop()
+      {
+        boost::lock_guard<boost::mutex> l(m_threadMutex);
+
+        if (!m_running) {
+          return;
+        }
+
+        // producers check m_running while holding their buffer mutex, drain() below takes every
+        // buffer mutex so nothing can be appended once it has run
+        m_running = false;
+
+        {
+          boost::lock_guard<boost::mutex> l2(m_wakeMutex);
+          m_stopRequested = true;
+        }
+        m_wakeCondition.notify_one();
+        m_thread.join();
+
+        drain();
+      }
+
+      bool isRunning() const
+      {
+        return m_running;
+      }
+
+      /// returns false if the queue is stopped, the caller should then write the message itself
+      bool push(LogLevel logLevel, const LogChannel& logChannel, const std::string& message)
+      {
+        ThreadBuffer& buffer = threadBuffer();
+
+        boost::lock_guard<boost::mutex> l(buffer.mutex);
+
+        if (!m_running) {
+          return false;
+        }
+
+        AsyncLogRecord record = {logLevel, logChannel, message, QThread::currentThread()};
+        buffer.records.push_back(std::move(record));
+
+        if (buffer.records.size() == WAKE_THRESHOLD) {
+          m_wakeCondition.notify_one();
+        }
+
+        return true;
+      }
+
+      /// write every queued record to the sinks from the calling thread
+      void drain()
+      {
+        boost::lock_guard<boost::mutex> l(m_drainMutex);
+
+        std::vector<std::shared_ptr<ThreadBuffer> > buffers;
+        {
+          boost::lock_guard<boost::mutex> l2(m_buffersMutex);
+          buffers = m_buffers;
+        }
+
+        // records are written with the QThread attribute of the thread that logged them so that
+        // LogSink::setThreadId keeps working, thread attributes take precedence over global ones
+        auto added = boost::log::core::get()->add_thread_attribute("QThread", m_threadAttribute);
+
+        std::vector<AsyncLogRecord> records;
+        for (const auto& buffer : buffers) {
+          {
+            boost::lock_guard<boost::mutex> l2(buffer->mutex);
+            // swap so the buffer keeps its capacity
+            records.swap(buffer->records);
+          }
+
+          for (const auto& record : records) {
+            m_threadAttribute.set(record.thread);
+            BOOST_LOG_SEV(m_logger.loggerFromChannel(record.logChannel), record.logLevel) << record.message;
+          }
+
+          records.clear();
+        }
+
+        if (added.second) {
+          boost::log::core::get()->remove_thread_attribute(added.first);
+        }
+
+        buffers.clear();
+
+        // forget buffers of threads that have exited
+        boost::lock_guard<boost::mutex> l2(m_buffersMutex);
+        m_buffers.erase(std::remove_if(m_buffers.begin(), m_buffers.end(), [](const std::shared_ptr<ThreadBuffer>& buffer) {
+          return buffer.use_count() == 1 && buffer->records.empty();
+        }), m_buffers.end());
+      }
+
+     private:
+
+      struct ThreadBuffer
+      {
+        boost::mutex mutex;
+        std::vector<AsyncLogRecord> records;
+      };
+
+      // wake the writer early when a buffer grows this large
+      static const size_t WAKE_THRESHOLD = 1024;
+
+      ThreadBuffer& threadBuffer()
+      {
+        std::shared_ptr<ThreadBuffer>* buffer = m_threadBuffer.get();
+        if (!buffer) {
+          buffer = new std::shared_ptr<ThreadBuffer>(std::make_shared<ThreadBuffer>());
+          m_threadBuffer.reset(buffer);
+
+          boost::lock_guard<boost::mutex> l(m_buffersMutex);
+          m_buffers.push_back(*buffer);
+        }
+        return **buffer;
+      }
+
+      void run()
+      {
+        while (true) {
+          {
+            boost::unique_lock<boost::mutex> l(m_wakeMutex);
+            if (!m_stopRequested) {
+              m_wakeCondition.timed_wait(l, boost::posix_time::milliseconds(50));
+            }
+            if (m_stopRequested) {
+              break;
+            }
+          }
+
+          drain();
+        }
+      }
+
+      LoggerSingleton& m_logger;
+
+      std::atomic<bool> m_running;
+
+      boost::mutex m_threadMutex;
+      boost::thread m_thread;
+
+      boost::mutex m_wakeMutex;
+      boost::condition_variable m_wakeCondition;
+      bool m_stopRequested;
+
+      // held while records are written so that records of a given thread are never reordered
+      boost::mutex m_drainMutex;
+      boost::log::attributes::mutable_constant<QThread*> m_threadAttribute;
+
+      boost::mutex m_buffersMutex;
+      std::vector<std::shared_ptr<ThreadBuffer> > m_buffers;
+
+      // the thread's own reference to its buffer, released when the thread exits
+      boost::thread_specific_ptr<std::shared_ptr<ThreadBuffer> > m_threadBuffer;
+    };
+
+  } // detail
+
   /// convenience function for SWIG, prefer macros in C++
   void logFree(LogLevel level, const std::string& channel, const std::string& message)
   {
-    BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
+    if (logLevelEnabled(level)) {
+      openstudio::Logger::instance().logMessage(level, channel, message);
+    }
+  }
+
+  bool logLevelEnabled(LogLevel level)
+  {
+    return static_cast<int>(level) >= detail::minimumLogLevel.load(std::memory_order_relaxed);
   }
 
   LoggerSingleton::LoggerSingleton()
-    : m_mutex(new QReadWriteLock())
+    : m_mutex(new QReadWriteLock()), m_loggerCache(new detail::LoggerCache()), m_asyncQueue(nullptr)
   {
     // Make QThread attribute available to logging
     boost::log::core::get()->add_global_attribute("QThread", boost::log::attributes::make_function(&QThread::currentThread));
@@ -106,6 +448,11 @@ namespace openstudio{
     // unregister Qt message handler
     //qInstallMsgHandler(consoleLogQtMessage);
 
+    // writes out anything still queued
+    delete m_asyncQueue.load();
+
+    delete m_loggerCache;
+
     delete m_mutex;
   }
 
@@ -125,8 +472,15 @@ namespace openstudio{
 
   LoggerType& LoggerSingleton::loggerFromChannel(const LogChannel& logChannel)
   {
+    // Common case, this thread already used this channel
+    if (LoggerType* cached = m_loggerCache->find(logChannel)) {
+      return *cached;
+    }
+
     QReadLocker l(m_mutex);
 
+    LoggerType* result = nullptr;
+
     auto it = m_loggerMap.find(logChannel);
     if (it == m_loggerMap.end()){
       //LoggerType newLogger(keywords::channel = logChannel, keywords::severity = Debug);
@@ -141,11 +495,62 @@ namespace openstudio{
 
       std::pair<LoggerMapType::iterator, bool> inserted = m_loggerMap.insert(newPair);
 
-      return inserted.first->second;
+      result = &inserted.first->second;
+    } else {
+      result = &it->second;
+    }
+
+    m_loggerCache->insert(logChannel, result);
+
+    return *result;
+  }
 
+  void LoggerSingleton::logMessage(LogLevel level, const LogChannel& logChannel, const std::string& message)
+  {
+    detail::AsyncLogQueue* asyncQueue = m_asyncQueue.load(std::memory_order_acquire);
+    if (asyncQueue && asyncQueue->push(level, logChannel, message)) {
+      return;
+    }
+
+    BOOST_LOG_SEV(loggerFromChannel(logChannel), level) << message;
+  }
+
+  void LoggerSingleton::enableAsynchronousLogging()
+  {
+    QWriteLocker l(m_mutex);
+
+    detail::AsyncLogQueue* asyncQueue = m_asyncQueue.load();
+    if (!asyncQueue) {
+      asyncQueue = new detail::AsyncLogQueue(*this);
+      m_asyncQueue.store(asyncQueue, std::memory_order_release);
+    }
+
+    // not under our lock, the writer thread calls loggerFromChannel
+    l.unlock();
+
+    asyncQueue->start();
+  }
+
+  void LoggerSingleton::disableAsynchronousLogging()
+  {
+    detail::AsyncLogQueue* asyncQueue = m_asyncQueue.load(std::memory_order_acquire);
+    if (asyncQueue) {
+      asyncQueue->stop();
     }
+  }
 
-    return it->second;
+  bool LoggerSingleton::isAsynchronousLogging() const
+  {
+    detail::AsyncLogQueue* asyncQueue = m_asyncQueue.load(std::memory_order_acquire);
+    return asyncQueue && asyncQueue->isRunning();
+  }
+
+  void LoggerSingleton::flush()
+  {
+    detail::AsyncLogQueue* asyncQueue = m_asyncQueue.load(std::memory_order_acquire);
+    if (asyncQueue && asyncQueue->isRunning()) {
+      asyncQueue->drain();
+    }
   }
 
   bool LoggerSingleton::findSink(boost::shared_ptr<LogSinkBackend> sink)
@@ -173,6 +578,8 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->add_sink(sink);
+
+      detail::setSinkEnabled(sink.get(), true);
     }
   }
 
@@ -192,6 +599,8 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->remove_sink(sink);
+
+      detail::setSinkEnabled(sink.get(), false);
     }
   }
 
@@ -39,6 +39,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
 #include <sstream>
 #include <set>
 #include <map>
@@ -58,12 +59,14 @@ class QWriteLocker;
 #define LOG_AND_THROW(__message__) \
   LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
+/// log a message from outside a registered class, the message is not formatted if no sink accepts the level
 #define LOG_FREE(__level__, __channel__, __message__) \
   { \
-    std::stringstream _ss1; \
-    _ss1 << __message__; \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    if (openstudio::logLevelEnabled(__level__)) { \
+      std::stringstream _ss1; \
+      _ss1 << __message__; \
+      openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    } \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -80,6 +83,22 @@ namespace openstudio{
   /// convenience function for SWIG, prefer macros in C++
   UTILITIES_API void logFree(LogLevel level, const std::string& channel, const std::string& message);
 
+  /// returns false if no enabled sink accepts messages at this level, does not take any lock
+  UTILITIES_API bool logLevelEnabled(LogLevel level);
+
+  namespace detail {
+
+    class AsyncLogQueue;
+    class LoggerCache;
+
+    // Track the level of each sink so that logLevelEnabled does not have to evaluate sink filters.
+    // These do not go through Logger::instance() as sinks are set up while the singleton is constructed.
+    UTILITIES_API void setSinkLogLevel(const LogSinkBackend* sink, LogLevel logLevel);
+    UTILITIES_API void setSinkEnabled(const LogSinkBackend* sink, bool enabled);
+    UTILITIES_API void releaseSink(const LogSinkBackend* sink);
+
+  } // detail
+
   /** Singleton logger class.  Singleton Logger object maintains logging state throughout
    *   program execution.
    */
@@ -102,6 +121,23 @@ namespace openstudio{
     /// exist a new logger will be set up at the default level
     LoggerType& loggerFromChannel(const LogChannel& logChannel);
 
+    /// send a message to the sinks, from the calling thread or through the asynchronous queue
+    void logMessage(LogLevel level, const LogChannel& logChannel, const std::string& message);
+
+    /// queue messages in per thread buffers that are written to the sinks by a background thread,
+    /// messages from a given thread stay in order but messages from different threads may be interleaved
+    void enableAsynchronousLogging();
+
+    /// write all queued messages and go back to writing messages from the logging thread
+    void disableAsynchronousLogging();
+
+    /// are messages written by a background thread
+    bool isAsynchronousLogging() const;
+
+    /// block until every message queued so far has been written to the sinks,
+    /// does nothing if asynchronous logging is not enabled
+    void flush();
+
    protected:
 
     friend class detail::LogSink_Impl;
@@ -122,6 +158,12 @@ namespace openstudio{
 
     mutable QReadWriteLock* m_mutex;
 
+    /// per thread cache of loggerFromChannel results
+    detail::LoggerCache* m_loggerCache;
+
+    /// created the first time asynchronous logging is enabled, never deleted before the singleton
+    std::atomic<detail::AsyncLogQueue*> m_asyncQueue;
+
     /// standard out logger
     LogSink m_standardOutLogger;
 
@@ -15,6 +15,9 @@
 %ignore std::vector<openstudio::LogMessage>::vector(size_type);
 %ignore std::vector<openstudio::LogMessage>::resize(size_type);
 %ignore openstudio::LoggerSingleton::loggerFromChannel;
+%ignore openstudio::detail::setSinkLogLevel;
+%ignore openstudio::detail::setSinkEnabled;
+%ignore openstudio::detail::releaseSink;
 
 %template(LogMessageVector) std::vector<openstudio::LogMessage>;
 %template(OptionalLogMessage) boost::optional<openstudio::LogMessage>;
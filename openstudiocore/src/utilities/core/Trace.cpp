@@ -0,0 +1,301 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "Trace.hpp"
+#include "Assert.hpp"
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <vector>
+
+namespace openstudio {
+
+namespace detail {
+
+  struct TraceEvent
+  {
+    const char* category;
+    std::string name;
+    std::string path;
+    unsigned threadIndex;
+    long long startUs;
+    long long durationUs;
+  };
+
+  struct TraceThreadState
+  {
+    unsigned threadIndex;
+    std::vector<std::string> stack;
+  };
+
+  class TraceRegistry
+  {
+   public:
+
+    static TraceRegistry& instance()
+    {
+      // leaked so that scopes closing during static destruction are safe
+      static TraceRegistry* registry = new TraceRegistry();
+      return *registry;
+    }
+
+    std::atomic<bool> enabled;
+
+    std::chrono::steady_clock::time_point epoch;
+
+    TraceThreadState& threadState()
+    {
+      TraceThreadState* state = m_threadState.get();
+      if (!state){
+        state = new TraceThreadState();
+        {
+          boost::mutex::scoped_lock l(m_mutex);
+          state->threadIndex = m_nextThreadIndex++;
+        }
+        m_threadState.reset(state);
+      }
+      return *state;
+    }
+
+    void addEvent(TraceEvent&& event)
+    {
+      boost::mutex::scoped_lock l(m_mutex);
+      m_events.push_back(std::move(event));
+    }
+
+    std::vector<TraceEvent> events() const
+    {
+      boost::mutex::scoped_lock l(m_mutex);
+      return m_events;
+    }
+
+    unsigned numEvents() const
+    {
+      boost::mutex::scoped_lock l(m_mutex);
+      return m_events.size();
+    }
+
+    void clear()
+    {
+      boost::mutex::scoped_lock l(m_mutex);
+      m_events.clear();
+    }
+
+   private:
+
+    TraceRegistry()
+      : enabled(false), epoch(std::chrono::steady_clock::now()), m_nextThreadIndex(0)
+    {}
+
+    mutable boost::mutex m_mutex;
+    std::vector<TraceEvent> m_events;
+    unsigned m_nextThreadIndex;
+    boost::thread_specific_ptr<TraceThreadState> m_threadState;
+  };
+
+  static std::string jsonEscape(const std::string& s)
+  {
+    std::string result;
+    result.reserve(s.size());
+    for (char c : s){
+      switch (c){
+        case '"': result += "\\\""; break;
+        case '\\': result += "\\\\"; break;
+        case '\n': result += "\\n"; break;
+        case '\r': result += "\\r"; break;
+        case '\t': result += "\\t"; break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20){
+            std::stringstream ss;
+            ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+            result += ss.str();
+          }else{
+            result += c;
+          }
+      }
+    }
+    return result;
+  }
+
+} // detail
+
+void enableTracing()
+{
+  detail::TraceRegistry::instance().enabled = true;
+}
+
+void disableTracing()
+{
+  detail::TraceRegistry::instance().enabled = false;
+}
+
+bool tracingEnabled()
+{
+  return detail::TraceRegistry::instance().enabled.load(std::memory_order_relaxed);
+}
+
+void clearTraceEvents()
+{
+  detail::TraceRegistry::instance().clear();
+}
+
+unsigned numTraceEvents()
+{
+  return detail::TraceRegistry::instance().numEvents();
+}
+
+bool writeChromeTrace(const openstudio::path& p)
+{
+  std::ofstream file(toSystemFilename(p), std::ios_base::binary);
+  if (!file.good()){
+    return false;
+  }
+
+  std::vector<detail::TraceEvent> events = detail::TraceRegistry::instance().events();
+
+  file << "{\"traceEvents\":[";
+  bool first = true;
+  for (const detail::TraceEvent& event : events){
+    if (!first){
+      file << ",";
+    }
+    first = false;
+    file << "\n{\"name\":\"" << detail::jsonEscape(event.name) << "\""
+         << ",\"cat\":\"" << detail::jsonEscape(event.category) << "\""
+         << ",\"ph\":\"X\",\"pid\":1"
+         << ",\"tid\":" << event.threadIndex
+         << ",\"ts\":" << event.startUs
+         << ",\"dur\":" << event.durationUs
+         << "}";
+  }
+  file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  file.close();
+  return !file.fail();
+}
+
+std::string traceSummary()
+{
+  struct Row
+  {
+    Row() : calls(0), totalUs(0), maxUs(0) {}
+    unsigned calls;
+    long long totalUs;
+    long long maxUs;
+  };
+
+  std::map<std::string, Row> rows;
+  for (const detail::TraceEvent& event : detail::TraceRegistry::instance().events()){
+    Row& row = rows[event.path];
+    ++row.calls;
+    row.totalUs += event.durationUs;
+    row.maxUs = std::max(row.maxUs, event.durationUs);
+  }
+
+  std::vector<std::pair<std::string, Row> > sorted(rows.begin(), rows.end());
+  std::stable_sort(sorted.begin(), sorted.end(), [](const std::pair<std::string, Row>& a, const std::pair<std::string, Row>& b){
+    return a.second.totalUs > b.second.totalUs;
+  });
+
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << std::setw(10) << "Calls" << std::setw(14) << "Total (ms)" << std::setw(14) << "Mean (ms)" << std::setw(14) << "Max (ms)" << "  Scope" << std::endl;
+  for (const auto& row : sorted){
+    ss << std::setw(10) << row.second.calls
+       << std::setw(14) << row.second.totalUs / 1000.0
+       << std::setw(14) << row.second.totalUs / 1000.0 / row.second.calls
+       << std::setw(14) << row.second.maxUs / 1000.0
+       << "  " << row.first << std::endl;
+  }
+  return ss.str();
+}
+
+TraceScope::TraceScope(const char* category, const char* name)
+  : m_active(tracingEnabled()), m_category(category), m_staticName(name)
+{
+  if (m_active){
+    begin();
+  }
+}
+
+TraceScope::TraceScope(const char* category, const std::string& name)
+  : m_active(tracingEnabled()), m_category(category), m_staticName(nullptr)
+{
+  if (m_active){
+    m_name = name;
+    begin();
+  }
+}
+
+void TraceScope::begin()
+{
+  if (m_staticName){
+    m_name = m_staticName;
+  }
+  detail::TraceRegistry::instance().threadState().stack.push_back(m_name);
+  m_start = std::chrono::steady_clock::now();
+}
+
+TraceScope::~TraceScope()
+{
+  if (!m_active){
+    return;
+  }
+
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  detail::TraceRegistry& registry = detail::TraceRegistry::instance();
+  detail::TraceThreadState& state = registry.threadState();
+  OS_ASSERT(!state.stack.empty());
+
+  detail::TraceEvent event;
+  event.category = m_category;
+  event.threadIndex = state.threadIndex;
+  event.startUs = std::chrono::duration_cast<std::chrono::microseconds>(m_start - registry.epoch).count();
+  event.durationUs = std::chrono::duration_cast<std::chrono::microseconds>(end - m_start).count();
+  for (const std::string& name : state.stack){
+    if (!event.path.empty()){
+      event.path += "/";
+    }
+    event.path += name;
+  }
+  state.stack.pop_back();
+  event.name = std::move(m_name);
+
+  registry.addEvent(std::move(event));
+}
+
+} // openstudio
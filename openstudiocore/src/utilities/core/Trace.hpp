@@ -0,0 +1,117 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_TRACE_HPP
+#define UTILITIES_CORE_TRACE_HPP
+
+#include "Path.hpp"
+#include "../UtilitiesAPI.hpp"
+
+#include <chrono>
+#include <string>
+
+namespace openstudio {
+
+  /** Turns on collection of trace events from OS_TRACE_SCOPE.  Scopes entered while tracing is disabled
+   *  cost a single atomic load. */
+  UTILITIES_API void enableTracing();
+
+  /// Turns off collection of trace events, events already collected are kept
+  UTILITIES_API void disableTracing();
+
+  /// Returns true if trace events are being collected
+  UTILITIES_API bool tracingEnabled();
+
+  /// Discards all collected trace events
+  UTILITIES_API void clearTraceEvents();
+
+  /// Returns the number of collected trace events
+  UTILITIES_API unsigned numTraceEvents();
+
+  /** Writes collected trace events to p in the Chrome trace event format, the file can be loaded in
+   *  chrome://tracing or https://ui.perfetto.dev.  Returns false if the file cannot be written. */
+  UTILITIES_API bool writeChromeTrace(const openstudio::path& p);
+
+  /** Returns a table of collected trace events aggregated by their nesting path, with number of calls,
+   *  total, mean, and max wall time in milliseconds.  Rows are sorted by total time. */
+  UTILITIES_API std::string traceSummary();
+
+  /** TraceScope records the wall time between its construction and destruction as one trace event.
+   *  Use through the OS_TRACE_SCOPE macros so that scopes are compiled out when OPENSTUDIO_ENABLE_TRACING
+   *  is not defined. */
+  class UTILITIES_API TraceScope
+  {
+   public:
+
+    /// category and name must outlive the scope, typically they are string literals
+    TraceScope(const char* category, const char* name);
+
+    TraceScope(const char* category, const std::string& name);
+
+    ~TraceScope();
+
+   private:
+
+    // noncopyable
+    TraceScope(const TraceScope&);
+    TraceScope& operator=(const TraceScope&);
+
+    void begin();
+
+    bool m_active;
+    const char* m_category;
+    const char* m_staticName;
+    std::string m_name;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+} // openstudio
+
+#define OS_TRACE_CONCAT_IMPL(a, b) a##b
+#define OS_TRACE_CONCAT(a, b) OS_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef OPENSTUDIO_ENABLE_TRACING
+
+/// Times the enclosing scope, name must be a string literal
+#define OS_TRACE_SCOPE(__category__, __name__) \
+  openstudio::TraceScope OS_TRACE_CONCAT(osTraceScope_, __LINE__)(__category__, __name__)
+
+/// Times the enclosing scope, __expr__ is converted to std::string only when tracing is enabled
+#define OS_TRACE_SCOPE_DYNAMIC(__category__, __expr__) \
+  openstudio::TraceScope OS_TRACE_CONCAT(osTraceScope_, __LINE__)(__category__, \
+    openstudio::tracingEnabled() ? std::string(__expr__) : std::string())
+
+#else
+
+#define OS_TRACE_SCOPE(__category__, __name__) ((void)0)
+#define OS_TRACE_SCOPE_DYNAMIC(__category__, __expr__) ((void)0)
+
+#endif
+
+#endif // UTILITIES_CORE_TRACE_HPP
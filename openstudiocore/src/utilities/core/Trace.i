@@ -0,0 +1,13 @@
+#ifndef UTILITIES_CORE_TRACE_I
+#define UTILITIES_CORE_TRACE_I
+
+%{
+  #include <utilities/core/Trace.hpp>
+%}
+
+// scopes are only useful from C++
+%ignore openstudio::TraceScope;
+
+%include <utilities/core/Trace.hpp>
+
+#endif //UTILITIES_CORE_TRACE_I
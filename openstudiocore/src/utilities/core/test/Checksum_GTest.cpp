@@ -35,6 +35,11 @@
 
 #include <resources.hxx>
 
+#include <boost/crc.hpp>
+
+#include <algorithm>
+#include <iomanip>
+
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
@@ -113,6 +118,38 @@ TEST(Checksum, Paths)
   EXPECT_EQ("00000000", checksum(p));
 }
 
+TEST(Checksum, MatchesBoostCrc)
+{
+  // reference implementation, bytewise boost crc after removing carriage returns
+  auto reference = [](std::string s) {
+    s.erase(std::remove(s.begin(), s.end(), '\r'), s.end());
+    boost::crc_32_type crc;
+    crc.process_bytes(s.data(), s.size());
+    stringstream ss;
+    ss << std::hex << std::uppercase << std::setw(8) << std::setfill('0') << crc.checksum();
+    return ss.str();
+  };
+
+  // lengths around the 8 byte steps and the stream buffer size, with runs of carriage returns
+  unsigned seed = 12345;
+  for (size_t n : {size_t(1), size_t(7), size_t(8), size_t(9), size_t(63), size_t(1000), size_t(16383), size_t(16384), size_t(40000)}) {
+    string s(n, ' ');
+    for (char& c : s) {
+      seed = seed * 1103515245u + 12345u;
+      unsigned r = (seed >> 16) % 64;
+      c = (r < 4) ? '\r' : (r < 6) ? '\n' : static_cast<char>(r * 3 + 40);
+    }
+    string expected = reference(s);
+    EXPECT_EQ(expected, checksum(s));
+    EXPECT_EQ(expected, checksum(s.data(), s.size()));
+    stringstream ss(s);
+    EXPECT_EQ(expected, checksum(ss));
+  }
+
+  EXPECT_EQ("00000000", checksum(string("\r\r\r")));
+  EXPECT_EQ(checksum(string("Hi there")), checksum(string("\rHi\r there\r")));
+}
+
 TEST(Checksum, UUIDs) {
   StringVector checksums;
   for (unsigned i = 0, n = 1000; i < n; ++i) {
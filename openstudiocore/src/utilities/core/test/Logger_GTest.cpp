@@ -33,6 +33,8 @@
 #include "../FileLogSink.hpp"
 #include "../StringStreamLogSink.hpp"
 
+#include <boost/thread/thread.hpp>
+
 #include <sstream>
 
 using openstudio::toPath;
@@ -343,4 +345,97 @@ namespace
 
     EXPECT_NO_THROW(openstudio::filesystem::remove(path));
   }
+
+  TEST(LoggerTest, logLevelEnabled)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    // other sinks may have been left enabled by other tests
+    bool traceEnabled = openstudio::logLevelEnabled(Trace);
+
+    {
+      // no level, accepts everything
+      StringStreamLogSink sink;
+      EXPECT_TRUE(openstudio::logLevelEnabled(Trace));
+
+      sink.setLogLevel(Error);
+      EXPECT_EQ(traceEnabled, openstudio::logLevelEnabled(Trace));
+      EXPECT_TRUE(openstudio::logLevelEnabled(Error));
+      EXPECT_TRUE(openstudio::logLevelEnabled(Fatal));
+
+      freeLogging();
+      ASSERT_EQ(1u, sink.logMessages().size());
+      EXPECT_EQ("Free Error", sink.logMessages()[0].logMessage());
+
+      sink.setLogLevel(Trace);
+      EXPECT_TRUE(openstudio::logLevelEnabled(Trace));
+
+      sink.disable();
+      EXPECT_EQ(traceEnabled, openstudio::logLevelEnabled(Trace));
+
+      sink.enable();
+      EXPECT_TRUE(openstudio::logLevelEnabled(Trace));
+    }
+
+    EXPECT_EQ(traceEnabled, openstudio::logLevelEnabled(Trace));
+  }
+
+  void logFromThreads(unsigned numThreads, unsigned numMessages)
+  {
+    std::vector<boost::thread> threads;
+    for (unsigned i = 0; i < numThreads; ++i) {
+      threads.emplace_back([i, numMessages]() {
+        for (unsigned j = 0; j < numMessages; ++j) {
+          LOG_FREE(Warn, "thread.channel", i << " " << j);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  TEST(LoggerTest, asynchronous)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    const unsigned numThreads = 8;
+    const unsigned numMessages = 2000;
+
+    StringStreamLogSink sink;
+    sink.setLogLevel(Warn);
+
+    logFromThreads(numThreads, numMessages);
+    EXPECT_EQ(numThreads * numMessages, sink.logMessages().size());
+
+    sink.resetStringStream();
+
+    openstudio::Logger::instance().enableAsynchronousLogging();
+    EXPECT_TRUE(openstudio::Logger::instance().isAsynchronousLogging());
+
+    logFromThreads(numThreads, numMessages);
+    openstudio::Logger::instance().flush();
+
+    std::vector<LogMessage> logMessages = sink.logMessages();
+    ASSERT_EQ(numThreads * numMessages, logMessages.size());
+
+    // messages of each thread are written in order
+    std::vector<unsigned> next(numThreads, 0);
+    for (const auto& logMessage : logMessages) {
+      EXPECT_EQ("thread.channel", logMessage.logChannel());
+      std::stringstream ss(logMessage.logMessage());
+      unsigned i, j;
+      ss >> i >> j;
+      ASSERT_LT(i, numThreads);
+      EXPECT_EQ(next[i], j);
+      next[i] = j + 1;
+    }
+
+    // messages logged after disabling are written right away
+    openstudio::Logger::instance().disableAsynchronousLogging();
+    EXPECT_FALSE(openstudio::Logger::instance().isAsynchronousLogging());
+    sink.resetStringStream();
+    freeLogging();
+    EXPECT_EQ(1u, sink.logMessages().size());
+  }
 }
@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "CoreFixture.hpp"
+
+#include "../Trace.hpp"
+#include "../Path.hpp"
+
+#include <boost/filesystem/fstream.hpp>
+
+#include <sstream>
+
+using namespace openstudio;
+
+namespace {
+
+  void tracedChild()
+  {
+    TraceScope scope("test", "child");
+  }
+
+  void tracedParent()
+  {
+    TraceScope scope("test", std::string("parent"));
+    tracedChild();
+    tracedChild();
+  }
+
+}
+
+TEST_F(CoreFixture, Trace_Disabled)
+{
+  disableTracing();
+  clearTraceEvents();
+
+  tracedParent();
+  EXPECT_FALSE(tracingEnabled());
+  EXPECT_EQ(0u, numTraceEvents());
+}
+
+TEST_F(CoreFixture, Trace_Summary)
+{
+  clearTraceEvents();
+  enableTracing();
+  EXPECT_TRUE(tracingEnabled());
+
+  tracedParent();
+  tracedParent();
+
+  disableTracing();
+  EXPECT_EQ(6u, numTraceEvents());
+
+  std::string summary = traceSummary();
+  EXPECT_NE(std::string::npos, summary.find("parent/child"));
+
+  // children are aggregated by their full path
+  std::stringstream ss(summary);
+  std::string line;
+  unsigned childCalls = 0;
+  while (std::getline(ss, line)){
+    if (line.find("parent/child") != std::string::npos){
+      std::stringstream ls(line);
+      ls >> childCalls;
+    }
+  }
+  EXPECT_EQ(4u, childCalls);
+
+  clearTraceEvents();
+  EXPECT_EQ(0u, numTraceEvents());
+}
+
+TEST_F(CoreFixture, Trace_ChromeTrace)
+{
+  clearTraceEvents();
+  enableTracing();
+  {
+    OS_TRACE_SCOPE("test", "macro \"quoted\"");
+    OS_TRACE_SCOPE_DYNAMIC("test", std::string("dynamic"));
+  }
+  disableTracing();
+
+  path p = toPath("./Trace_ChromeTrace.json");
+  if (boost::filesystem::exists(p)){
+    boost::filesystem::remove(p);
+  }
+  ASSERT_TRUE(writeChromeTrace(p));
+  ASSERT_TRUE(boost::filesystem::exists(p));
+
+  boost::filesystem::ifstream file(p);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  std::string json = contents.str();
+
+  EXPECT_EQ(0u, json.find("{\"traceEvents\":["));
+#ifdef OPENSTUDIO_ENABLE_TRACING
+  EXPECT_EQ(2u, numTraceEvents());
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"macro \\\"quoted\\\"\""));
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"dynamic\""));
+  EXPECT_NE(std::string::npos, json.find("\"ph\":\"X\""));
+#else
+  EXPECT_EQ(0u, numTraceEvents());
+#endif
+
+  clearTraceEvents();
+}
@@ -35,6 +35,10 @@
 #include "../core/StringHelpers.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 
 
 namespace openstudio{
@@ -43,26 +47,25 @@ namespace openstudio{
   {
     // Compute water vapor saturation pressure, eqns 5 and 6 from ASHRAE Fundamentals 2009 Ch. 1
     // This version takes T in C rather than Kelvin since most of the other eqns use C
+    // Coefficients are selected rather than branched on so that loops calling psat vectorize, eqn 6 has no T^4 term
     T += 273.15;
-    double C1 =-5.6745359e+03;
-    double C2 = 6.3925247e+00;
-    double C3 =-9.6778430e-03;
-    double C4 = 6.2215701e-07;
-    double C5 = 2.0747825e-09;
-    double C6 =-9.4840240e-13;
-    double C7 = 4.1635019e+00;
-    double C8 =-5.8002206e+03;
-    double C9 = 1.3914993e+00;
-    double C10=-4.8640239e-02;
-    double C11= 4.1764768e-05;
-    double C12=-1.4452093e-08;
-    double C13= 6.5459673e+00;
-    double rhs;
-    if(T<273.15) {
-      rhs = C1/T + C2 + T*(C3 + T*(C4 + T*(C5 + T*C6))) + C7*std::log(T);
-    } else {
-      rhs = C8/T + C9 + T*(C10 + T*(C11 + T*C12)) + C13*std::log(T);
-    }
+    const double C1 =-5.6745359e+03;
+    const double C2 = 6.3925247e+00;
+    const double C3 =-9.6778430e-03;
+    const double C4 = 6.2215701e-07;
+    const double C5 = 2.0747825e-09;
+    const double C6 =-9.4840240e-13;
+    const double C7 = 4.1635019e+00;
+    const double C8 =-5.8002206e+03;
+    const double C9 = 1.3914993e+00;
+    const double C10=-4.8640239e-02;
+    const double C11= 4.1764768e-05;
+    const double C12=-1.4452093e-08;
+    const double C13= 6.5459673e+00;
+    bool ice = (T < 273.15);
+    double rhs = (ice ? C1 : C8)/T + (ice ? C2 : C9)
+      + T*((ice ? C3 : C10) + T*((ice ? C4 : C11) + T*((ice ? C5 : C12) + T*(ice ? C6 : 0.0))))
+      + (ice ? C7 : C13)*std::log(T);
     return exp(rhs);
   }
 
@@ -72,26 +75,22 @@ namespace openstudio{
     // ASHRAE Fundamentals 2009 Ch. 1)
     // This version takes T in C rather than Kelvin since most of the other eqns use C
     T += 273.15;
-    double C1 = -5.6745359e+03;
-    double C3 = -9.6778430e-03;
-    double C4 = 6.2215701e-07;
-    double C5 = 2.0747825e-09;
-    double C6 = -9.4840240e-13;
-    double C7 = 4.1635019e+00;
-    double C8 = -5.8002206e+03;
-    double C10 = -4.8640239e-02;
-    double C11 = 4.1764768e-05;
-    double C12 = -1.4452093e-08;
-    double C13 = 6.5459673e+00;
-    double fp;
+    const double C1 = -5.6745359e+03;
+    const double C3 = -9.6778430e-03;
+    const double C4 = 6.2215701e-07;
+    const double C5 = 2.0747825e-09;
+    const double C6 = -9.4840240e-13;
+    const double C7 = 4.1635019e+00;
+    const double C8 = -5.8002206e+03;
+    const double C10 = -4.8640239e-02;
+    const double C11 = 4.1764768e-05;
+    const double C12 = -1.4452093e-08;
+    const double C13 = 6.5459673e+00;
     double T2 = T*T;
     double T3 = T*T2;
-    if (T<273.15) {
-      fp = -C1 / T2 + C3 + 2 * T*C4 + 3 * T2*C5 + 4 * T3*C6 + C7 / T;
-    }
-    else {
-      fp = -C8 / T2 + C10 + 2 * T*C11 + 3 * T2*C12 + C13 / T;
-    }
+    bool ice = (T < 273.15);
+    double fp = -(ice ? C1 : C8) / T2 + (ice ? C3 : C10) + 2 * T*(ice ? C4 : C11) + 3 * T2*(ice ? C5 : C12)
+      + 4 * T3*(ice ? C6 : 0.0) + (ice ? C7 : C13) / T;
     //std::cout << "psatp: " << T - 273.15 << " " << fp << " " << fp*psat << std::endl;
     return fp*psat;
   }
@@ -200,6 +199,166 @@ namespace openstudio{
     return boost::none;
   }
 
+  // number of points iterated together by the batched solvers, sized to stay in L1 cache
+  static const size_t psychrometricBlockSize = 64;
+
+  void computeSaturationPressures(const double* drybulb, double* saturationPressure, size_t n)
+  {
+    for (size_t i = 0; i < n; ++i) {
+      bool valid = (drybulb[i] >= -100.0) && (drybulb[i] <= 200.0); // range of our current psat function
+      saturationPressure[i] = valid ? psat(drybulb[i]) : std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+
+  void computeVaporPressuresFromDewPoint(const double* dewpoint, double* vaporPressure, size_t n)
+  {
+    // Partial pressure of water vapor, eqn 38 (uses eqns 5 and 6)
+    computeSaturationPressures(dewpoint, vaporPressure, n);
+  }
+
+  void computeVaporPressuresFromRelativeHumidity(const double* drybulb, const double* relativeHumidity, double* vaporPressure, size_t n)
+  {
+    for (size_t i = 0; i < n; ++i) {
+      bool valid = (drybulb[i] >= -100.0) && (drybulb[i] <= 200.0) && (relativeHumidity[i] >= 0.0) && (relativeHumidity[i] <= 100.0);
+      double phi = 0.01*relativeHumidity[i];
+      double pw = phi * psat(drybulb[i]); // Relative humidity, eqn 24
+      vaporPressure[i] = valid ? pw : std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+
+  void computeHumidityRatios(const double* vaporPressure, const double* pressure, double* humidityRatio, size_t n)
+  {
+    for (size_t i = 0; i < n; ++i) {
+      humidityRatio[i] = 0.621945 * vaporPressure[i] / (pressure[i] - vaporPressure[i]); // Humidity ratio, eqn 22
+    }
+  }
+
+  void computeEnthalpies(const double* drybulb, const double* humidityRatio, double* enthalpy, size_t n)
+  {
+    for (size_t i = 0; i < n; ++i) {
+      enthalpy[i] = 1.006*drybulb[i] + humidityRatio[i]*(2501 + 1.86*drybulb[i]); // Moist air specific enthalpy, eqn 32
+    }
+  }
+
+  void computeSpecificVolumes(const double* drybulb, const double* humidityRatio, const double* pressure, double* specificVolume, size_t n)
+  {
+    for (size_t i = 0; i < n; ++i) {
+      specificVolume[i] = 0.287042*(drybulb[i] + 273.15)*(1 + 1.607858*humidityRatio[i]) / pressure[i]; // Specific volume, eqn 28
+    }
+  }
+
+  void computeDensities(const double* drybulb, const double* humidityRatio, const double* pressure, double* density, size_t n)
+  {
+    computeSpecificVolumes(drybulb, humidityRatio, pressure, density, n);
+    for (size_t i = 0; i < n; ++i) {
+      density[i] = 1.0 / density[i];
+    }
+  }
+
+  // Same Newton iteration as solveForDewPoint run on a block of points at once, each point stops
+  // updating once it converges so results match the scalar solve exactly
+  void computeDewPoints(const double* drybulb, const double* vaporPressure, double* dewpoint, size_t n)
+  {
+    const double deltaLimit = 1e-4;
+    const int itermax = 100;
+    double tdew[psychrometricBlockSize];
+    bool converged[psychrometricBlockSize];
+
+    for (size_t start = 0; start < n; start += psychrometricBlockSize) {
+      size_t m = std::min(psychrometricBlockSize, n - start);
+      const double* pw = vaporPressure + start;
+
+      for (size_t i = 0; i < m; ++i) {
+        tdew[i] = drybulb[start + i];
+        converged[i] = false;
+      }
+
+      for (int iter = 0; iter < itermax; ++iter) {
+        size_t numConverged = 0;
+        for (size_t i = 0; i < m; ++i) {
+          double pws = psat(tdew[i]);
+          double f = pws - pw[i];
+          double fp = psatp(tdew[i], pws);
+          double delta = -f / fp;
+          double next = tdew[i] + delta;
+          bool done = (std::fabs(delta / (273.15 + next)) <= deltaLimit);
+          tdew[i] = converged[i] ? tdew[i] : next;
+          converged[i] = converged[i] || done;
+          numConverged += converged[i];
+        }
+        if (numConverged == m) {
+          break;
+        }
+      }
+
+      for (size_t i = 0; i < m; ++i) {
+        dewpoint[start + i] = converged[i] ? tdew[i] : std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+  }
+
+  // Same Newton iteration as solveForWetBulb run on a block of points at once, each point stops
+  // updating once it converges so results match the scalar solve exactly
+  void computeWetBulbs(const double* drybulb, const double* humidityRatio, const double* pressure, double* wetbulb, size_t n)
+  {
+    const double deltaLimit = 1e-4;
+    const int itermax = 100;
+    double tstar[psychrometricBlockSize];
+    bool converged[psychrometricBlockSize];
+
+    for (size_t start = 0; start < n; start += psychrometricBlockSize) {
+      size_t m = std::min(psychrometricBlockSize, n - start);
+      const double* t = drybulb + start;
+      const double* W = humidityRatio + start;
+      const double* p = pressure + start;
+
+      for (size_t i = 0; i < m; ++i) {
+        tstar[i] = t[i];
+        converged[i] = false;
+      }
+
+      for (int iter = 0; iter < itermax; ++iter) {
+        size_t numConverged = 0;
+        for (size_t i = 0; i < m; ++i) {
+          bool ice = (t[i] < 0);
+          double a0 = ice ? 2830 : 2501;
+          double a1 = ice ? -0.24 : -2.326;
+          double b = 1.006;
+          double c0 = ice ? 2830 : 2501;
+          double c1t = 1.86*t[i];
+          double c2 = ice ? -2.1 : -4.186;
+          double Ap = ice ? -0.24 : -2.326;
+          double Bp = -1.006;
+          double Cp = ice ? -2.1 : -4.186;
+
+          double A = a0 + a1*tstar[i];
+          double B = b*(t[i] - tstar[i]);
+          double C = c0 + c1t + c2*tstar[i];
+          double pwsstar = psat(tstar[i]);
+          double pwsstarp = psatp(tstar[i], pwsstar);
+          double deltap = p[i] - pwsstar;
+          double Wsstar = 0.621945*pwsstar / deltap;
+          double Wsstarp = (0.621945*pwsstarp*deltap + 0.621945*pwsstar*pwsstarp) / (deltap*deltap);
+          double f = W[i]*C - A*Wsstar + B;
+          double fp = W[i]*Cp - A*Wsstarp - Ap*Wsstar + Bp;
+          double delta = -f / fp;
+          double next = tstar[i] + delta;
+          bool done = (std::fabs(delta / (273.15 + next)) <= deltaLimit);
+          tstar[i] = converged[i] ? tstar[i] : next;
+          converged[i] = converged[i] || done;
+          numConverged += converged[i];
+        }
+        if (numConverged == m) {
+          break;
+        }
+      }
+
+      for (size_t i = 0; i < m; ++i) {
+        wetbulb[start + i] = converged[i] ? tstar[i] : std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+  }
+
   AirState::AirState()
   {
     // Set parameters
@@ -4117,39 +4276,101 @@ namespace openstudio{
     }
 
     std::string units = EpwDataPoint::getUnits(id);
-    boost::optional<double>(EpwDataPoint::*compute)() const;
     switch (id.value()) {
       case EpwComputedField::SaturationPressure:
-        compute = &EpwDataPoint::saturationPressure;
-        break;
       case EpwComputedField::Enthalpy:
-        compute = &EpwDataPoint::enthalpy;
-        break;
       case EpwComputedField::HumidityRatio:
-        compute = &EpwDataPoint::humidityRatio;
-        break;
       case EpwComputedField::WetBulbTemperature:
-        compute = &EpwDataPoint::wetbulb;
-        break;
       case EpwComputedField::Density:
-        compute = &EpwDataPoint::density;
-        break;
       case EpwComputedField::SpecificVolume:
-        compute = &EpwDataPoint::specificVolume;
         break;
       default:
         return boost::none;
     }
+
+    // Gather the inputs as columns and compute the whole series with the batched psychrometric functions,
+    // points are skipped where EpwDataPoint::airState would not return a state
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    size_t n = m_data.size();
+    std::vector<double> drybulb(n, nan);
+    std::vector<double> pressure(n, nan);
+    std::vector<double> relativeHumidity(n, nan);
+    std::vector<double> dewpoint(n, nan);
+    for (size_t i = 0; i < n; ++i) {
+      boost::optional<double> value = m_data[i].dryBulbTemperature();
+      if (value) {
+        drybulb[i] = value.get();
+      }
+      value = m_data[i].atmosphericStationPressure();
+      if (value) {
+        pressure[i] = value.get();
+      }
+      value = m_data[i].relativeHumidity();
+      if (value) {
+        relativeHumidity[i] = value.get();
+      } else {
+        value = m_data[i].dewPointTemperature();
+        if (value) {
+          dewpoint[i] = value.get();
+        }
+      }
+    }
+
+    std::vector<double> result(n, nan);
+    if (id == EpwComputedField::SaturationPressure) {
+      computeSaturationPressures(drybulb.data(), result.data(), n);
+    } else {
+      // relative humidity is used when present, as in EpwDataPoint::airState
+      std::vector<double> vaporPressure(n);
+      std::vector<double> dewpointVaporPressure(n);
+      computeVaporPressuresFromRelativeHumidity(drybulb.data(), relativeHumidity.data(), vaporPressure.data(), n);
+      computeVaporPressuresFromDewPoint(dewpoint.data(), dewpointVaporPressure.data(), n);
+      for (size_t i = 0; i < n; ++i) {
+        bool valid = (drybulb[i] >= -100.0) && (drybulb[i] <= 200.0);
+        vaporPressure[i] = !valid ? nan : (std::isnan(relativeHumidity[i]) ? dewpointVaporPressure[i] : vaporPressure[i]);
+      }
+
+      std::vector<double> humidityRatio(n);
+      computeHumidityRatios(vaporPressure.data(), pressure.data(), humidityRatio.data(), n);
+
+      // AirState requires the wet bulb solve, and the dew point solve when starting from relative humidity, to converge
+      std::vector<double> wetbulb(n);
+      computeWetBulbs(drybulb.data(), humidityRatio.data(), pressure.data(), wetbulb.data(), n);
+      computeDewPoints(drybulb.data(), vaporPressure.data(), dewpoint.data(), n);
+
+      switch (id.value()) {
+        case EpwComputedField::Enthalpy:
+          computeEnthalpies(drybulb.data(), humidityRatio.data(), result.data(), n);
+          break;
+        case EpwComputedField::HumidityRatio:
+          result = humidityRatio;
+          break;
+        case EpwComputedField::WetBulbTemperature:
+          result = wetbulb;
+          break;
+        case EpwComputedField::Density:
+          computeDensities(drybulb.data(), humidityRatio.data(), pressure.data(), result.data(), n);
+          break;
+        case EpwComputedField::SpecificVolume:
+          computeSpecificVolumes(drybulb.data(), humidityRatio.data(), pressure.data(), result.data(), n);
+          break;
+        default:
+          break;
+      }
+
+      for (size_t i = 0; i < n; ++i) {
+        bool valid = !std::isnan(humidityRatio[i]) && !std::isnan(wetbulb[i]) && (!std::isnan(dewpoint[i]) || std::isnan(relativeHumidity[i]));
+        result[i] = valid ? result[i] : nan;
+      }
+    }
+
     DateTimeVector dates;
     dates.push_back(DateTime()); // Use a placeholder to avoid an insert
     std::vector<double> values;
-    for (unsigned int i = 0; i<m_data.size(); i++) {
-      Date date = m_data[i].date();
-      Time time = m_data[i].time();
-      boost::optional<double> value = (m_data[i].*compute)();
-      if (value) {
-        dates.push_back(DateTime(date, time));
-        values.push_back(value.get());
+    for (size_t i = 0; i < n; i++) {
+      if (!std::isnan(result[i])) {
+        dates.push_back(DateTime(m_data[i].date(), m_data[i].time()));
+        values.push_back(result[i]);
       }
     }
     if (values.size()) {
@@ -101,6 +101,30 @@ private:
   double m_v;
 };
 
+// Batched versions of the moist air property calculations in AirState, using the same equations from ASHRAE Fundamentals 2009 Ch. 1.
+// Each function reads n values from each input array and writes n values to the output array, no memory is allocated and the
+// loops are written to be vectorized.  Results are identical to the corresponding AirState values, outputs are NaN where AirState
+// would not produce a state because an input is NaN or out of range or an iterative solve did not converge.
+
+/** Computes water vapor saturation pressure in Pa from dry bulb temperature in C */
+UTILITIES_API void computeSaturationPressures(const double* drybulb, double* saturationPressure, size_t n);
+/** Computes partial pressure of water vapor in Pa from dew point temperature in C */
+UTILITIES_API void computeVaporPressuresFromDewPoint(const double* dewpoint, double* vaporPressure, size_t n);
+/** Computes partial pressure of water vapor in Pa from dry bulb temperature in C and relative humidity in percent */
+UTILITIES_API void computeVaporPressuresFromRelativeHumidity(const double* drybulb, const double* relativeHumidity, double* vaporPressure, size_t n);
+/** Computes humidity ratio from partial pressure of water vapor and atmospheric pressure in Pa */
+UTILITIES_API void computeHumidityRatios(const double* vaporPressure, const double* pressure, double* humidityRatio, size_t n);
+/** Computes enthalpy in kJ/kg from dry bulb temperature in C and humidity ratio */
+UTILITIES_API void computeEnthalpies(const double* drybulb, const double* humidityRatio, double* enthalpy, size_t n);
+/** Computes specific volume in m3/kg from dry bulb temperature in C, humidity ratio, and atmospheric pressure in Pa */
+UTILITIES_API void computeSpecificVolumes(const double* drybulb, const double* humidityRatio, const double* pressure, double* specificVolume, size_t n);
+/** Computes density in kg/m3 from dry bulb temperature in C, humidity ratio, and atmospheric pressure in Pa */
+UTILITIES_API void computeDensities(const double* drybulb, const double* humidityRatio, const double* pressure, double* density, size_t n);
+/** Computes dew point temperature in C from dry bulb temperature in C and partial pressure of water vapor in Pa */
+UTILITIES_API void computeDewPoints(const double* drybulb, const double* vaporPressure, double* dewpoint, size_t n);
+/** Computes thermodynamic wet bulb temperature in C from dry bulb temperature in C, humidity ratio, and atmospheric pressure in Pa */
+UTILITIES_API void computeWetBulbs(const double* drybulb, const double* humidityRatio, const double* pressure, double* wetbulb, size_t n);
+
 OPENSTUDIO_ENUM(EpwDataField,
   ((Year)(Year)(0))
   ((Month)(Month))
@@ -35,6 +35,8 @@
 
 #include <resources.hxx>
 
+#include <cmath>
+
 using namespace openstudio;
 
 TEST(Filetypes, EpwFile)
@@ -764,3 +766,90 @@ TEST(Filetypes, EpwFile_DataPoint)
     ASSERT_TRUE(false);
   }
 }
+
+TEST(Filetypes, EpwFile_BatchedPsychrometrics)
+{
+  // Check the batched functions against AirState over a grid of states, including some that AirState rejects
+  std::vector<double> drybulb;
+  std::vector<double> relativeHumidity;
+  std::vector<double> pressure;
+  for (double t = -40.0; t <= 50.0; t += 2.5) {
+    for (double rh = -10.0; rh <= 110.0; rh += 5.0) {
+      drybulb.push_back(t);
+      relativeHumidity.push_back(rh);
+      pressure.push_back(81000.0 + 50.0 * t);
+    }
+  }
+  size_t n = drybulb.size();
+  std::vector<double> psat(n), pw(n), W(n), h(n), v(n), rho(n), dew(n), wetbulb(n), pwdew(n), Wdew(n), wetbulbdew(n);
+  computeSaturationPressures(drybulb.data(), psat.data(), n);
+  computeVaporPressuresFromRelativeHumidity(drybulb.data(), relativeHumidity.data(), pw.data(), n);
+  computeHumidityRatios(pw.data(), pressure.data(), W.data(), n);
+  computeEnthalpies(drybulb.data(), W.data(), h.data(), n);
+  computeSpecificVolumes(drybulb.data(), W.data(), pressure.data(), v.data(), n);
+  computeDensities(drybulb.data(), W.data(), pressure.data(), rho.data(), n);
+  computeDewPoints(drybulb.data(), pw.data(), dew.data(), n);
+  computeWetBulbs(drybulb.data(), W.data(), pressure.data(), wetbulb.data(), n);
+  // Go back around through the dew point
+  computeVaporPressuresFromDewPoint(dew.data(), pwdew.data(), n);
+  computeHumidityRatios(pwdew.data(), pressure.data(), Wdew.data(), n);
+  computeWetBulbs(drybulb.data(), Wdew.data(), pressure.data(), wetbulbdew.data(), n);
+
+  unsigned count = 0;
+  for (size_t i = 0; i < n; ++i) {
+    boost::optional<AirState> state = AirState::fromDryBulbRelativeHumidityPressure(drybulb[i], relativeHumidity[i], pressure[i]);
+    if (!state) {
+      EXPECT_TRUE(std::isnan(pw[i]) || std::isnan(dew[i]) || std::isnan(wetbulb[i]));
+      continue;
+    }
+    ++count;
+    EXPECT_DOUBLE_EQ(state->saturationPressure(), psat[i]);
+    EXPECT_DOUBLE_EQ(state->humidityRatio(), W[i]);
+    EXPECT_DOUBLE_EQ(state->enthalpy(), h[i]);
+    EXPECT_DOUBLE_EQ(state->specificVolume(), v[i]);
+    EXPECT_DOUBLE_EQ(state->density(), rho[i]);
+    EXPECT_DOUBLE_EQ(state->dewpoint(), dew[i]);
+    EXPECT_DOUBLE_EQ(state->wetbulb(), wetbulb[i]);
+
+    state = AirState::fromDryBulbDewPointPressure(drybulb[i], dew[i], pressure[i]);
+    ASSERT_TRUE(state);
+    EXPECT_DOUBLE_EQ(state->humidityRatio(), Wdew[i]);
+    EXPECT_DOUBLE_EQ(state->wetbulb(), wetbulbdew[i]);
+  }
+  EXPECT_LT(0u, count);
+  EXPECT_GT(n, count);
+
+  // The computed time series should match the point by point calculation
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p);
+  std::vector<EpwDataPoint> data = epwFile.data();
+  for (const std::string field : { "SaturationPressure", "Enthalpy", "HumidityRatio", "WetBulbTemperature", "Density", "SpecificVolume" }) {
+    boost::optional<TimeSeries> series = epwFile.getComputedTimeSeries(field);
+    ASSERT_TRUE(series) << field;
+    Vector values = series->values();
+    std::vector<double> expectedValues;
+    for (size_t i = 0; i < data.size(); ++i) {
+      boost::optional<double> expected;
+      if (field == "SaturationPressure") {
+        expected = data[i].saturationPressure();
+      } else if (field == "Enthalpy") {
+        expected = data[i].enthalpy();
+      } else if (field == "HumidityRatio") {
+        expected = data[i].humidityRatio();
+      } else if (field == "WetBulbTemperature") {
+        expected = data[i].wetbulb();
+      } else if (field == "Density") {
+        expected = data[i].density();
+      } else {
+        expected = data[i].specificVolume();
+      }
+      if (expected) {
+        expectedValues.push_back(expected.get());
+      }
+    }
+    ASSERT_EQ(expectedValues.size(), values.size()) << field;
+    for (size_t i = 0; i < expectedValues.size(); ++i) {
+      EXPECT_DOUBLE_EQ(expectedValues[i], values[i]) << field;
+    }
+  }
+}
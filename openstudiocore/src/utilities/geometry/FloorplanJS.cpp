@@ -215,6 +215,46 @@ namespace openstudio{
     return m_objectReferenceMap;
   }
 
+  FloorplanChangeSet::FloorplanChangeSet()
+  {}
+
+  std::vector<FloorplanObject> FloorplanChangeSet::addedObjects() const
+  {
+    return m_addedObjects;
+  }
+
+  std::vector<FloorplanObject> FloorplanChangeSet::removedObjects() const
+  {
+    return m_removedObjects;
+  }
+
+  std::vector<FloorplanObject> FloorplanChangeSet::modifiedObjects() const
+  {
+    return m_modifiedObjects;
+  }
+
+  std::set<std::string> FloorplanChangeSet::affectedIds() const
+  {
+    std::set<std::string> result;
+    for (const auto& object : m_addedObjects){
+      result.insert(object.id());
+    }
+    for (const auto& object : m_modifiedObjects){
+      result.insert(object.id());
+    }
+    return result;
+  }
+
+  std::set<std::string> FloorplanChangeSet::replacedNames() const
+  {
+    return m_replacedNames;
+  }
+
+  bool FloorplanChangeSet::empty() const
+  {
+    return (m_addedObjects.empty() && m_removedObjects.empty() && m_modifiedObjects.empty());
+  }
+
   FloorplanJS::FloorplanJS()
     : m_lastId(0)
   {
@@ -1052,6 +1092,16 @@ namespace openstudio{
   }
 
   ThreeScene FloorplanJS::toThreeScene(bool openstudioFormat) const
+  {
+    return makeThreeScene(openstudioFormat, nullptr);
+  }
+
+  ThreeScene FloorplanJS::toThreeScene(bool openstudioFormat, const std::set<std::string>& spaceAndShadingIds) const
+  {
+    return makeThreeScene(openstudioFormat, &spaceAndShadingIds);
+  }
+
+  ThreeScene FloorplanJS::makeThreeScene(bool openstudioFormat, const std::set<std::string>* spaceAndShadingIds) const
   {
     m_plenumThermalZoneNames.clear();
     m_boundingBox = BoundingBox();
@@ -1073,20 +1123,6 @@ namespace openstudio{
     //}
     // add model specific materials in loop with makeMaterial
 
-    double currentStoryZ = 0;
-
-    // read project config
-    Json::Value project = m_value.get("project", Json::objectValue);
-    if (!project.isNull()){
-      // DLM: TODO move this to a function
-      Json::Value ground = project.get("ground", Json::objectValue);
-      if (!ground.isNull()){
-        if (checkKeyAndType(ground, "floor_offset", Json::realValue)){
-          currentStoryZ = ground.get("floor_offset", 0.0).asDouble();
-        }
-      }
-    }
-
     // DLM: geometry in ThreeJS output is always in meters without north angle applied
     // north angle is applied directly to osm, does not impact this translation
 
@@ -1100,6 +1136,7 @@ namespace openstudio{
 
     // loop over stories
     Json::Value stories = m_value.get("stories", Json::arrayValue);
+    std::vector<Heights> storyHeights = getStoryHeights(lengthToMeters);
     Json::ArrayIndex storyN = stories.size();
     for (Json::ArrayIndex storyIdx = 0; storyIdx < storyN; ++storyIdx){
 
@@ -1119,27 +1156,8 @@ namespace openstudio{
         storyMultiplier = stories[storyIdx].get("multiplier", storyMultiplier).asUInt();
       }
 
-      double storyBelowFloorPlenumHeight = 0;
-      if (checkKeyAndType(stories[storyIdx], "below_floor_plenum_height", Json::realValue)){
-        storyBelowFloorPlenumHeight = lengthToMeters * stories[storyIdx].get("below_floor_plenum_height", storyBelowFloorPlenumHeight).asDouble();
-      }
-
-      double storyFloorToCeilingHeight = 3; // default is 3 m
-      if (checkKeyAndType(stories[storyIdx], "floor_to_ceiling_height", Json::realValue)){
-        storyFloorToCeilingHeight = lengthToMeters * stories[storyIdx].get("floor_to_ceiling_height", storyFloorToCeilingHeight).asDouble();
-      }
-
-      double storyAboveCeilingPlenumHeight = 0;
-      if (checkKeyAndType(stories[storyIdx], "above_ceiling_plenum_height", Json::realValue)){
-        storyAboveCeilingPlenumHeight = lengthToMeters * stories[storyIdx].get("above_ceiling_plenum_height", storyAboveCeilingPlenumHeight).asDouble();
-      }
+      const Heights& currentStoryHeights = storyHeights[storyIdx];
 
-      // DLM: temp code
-      if (storyFloorToCeilingHeight < 0.1){
-        //belowFloorPlenumHeight = 1;
-        storyFloorToCeilingHeight = 3;
-        //aboveCeilingPlenumHeight = 1;
-      }
       if (storyMultiplier == 0){
         storyMultiplier = 1;
       } else if (storyMultiplier > 1){
@@ -1151,10 +1169,10 @@ namespace openstudio{
       ThreeModelObjectMetadata storyMetadata = makeModelObjectMetadata("OS:BuildingStory", stories[storyIdx]);
       storyMetadata.setColor(storyColor);
       storyMetadata.setMultiplier(storyMultiplier);
-      storyMetadata.setNominalZCoordinate(currentStoryZ);
-      storyMetadata.setBelowFloorPlenumHeight(storyBelowFloorPlenumHeight);
-      storyMetadata.setFloorToCeilingHeight(storyFloorToCeilingHeight);
-      storyMetadata.setAboveCeilingPlenumHeight(storyAboveCeilingPlenumHeight);
+      storyMetadata.setNominalZCoordinate(currentStoryHeights.minZ);
+      storyMetadata.setBelowFloorPlenumHeight(currentStoryHeights.belowFloorPlenumHeight);
+      storyMetadata.setFloorToCeilingHeight(currentStoryHeights.floorToCeilingHeight);
+      storyMetadata.setAboveCeilingPlenumHeight(currentStoryHeights.aboveCeilingPlenumHeight);
       modelObjectMetadata.push_back(storyMetadata);
 
       // make story material
@@ -1195,34 +1213,32 @@ namespace openstudio{
             //spaceMultiplier = 1;
           }
 
-          double spaceBelowFloorPlenumHeight = storyBelowFloorPlenumHeight;
-          if (checkKeyAndType(spaces[spaceIdx], "below_floor_plenum_height", Json::realValue)){
-            spaceBelowFloorPlenumHeight = lengthToMeters * spaces[spaceIdx].get("below_floor_plenum_height", spaceBelowFloorPlenumHeight).asDouble();
-          }
-
-          double spaceFloorToCeilingHeight = storyFloorToCeilingHeight;
-          if (checkKeyAndType(spaces[spaceIdx], "floor_to_ceiling_height", Json::realValue)){
-            spaceFloorToCeilingHeight = lengthToMeters * spaces[spaceIdx].get("floor_to_ceiling_height", spaceFloorToCeilingHeight).asDouble();
-          }
-
-          double spaceAboveCeilingPlenumHeight = storyAboveCeilingPlenumHeight;
-          if (checkKeyAndType(spaces[spaceIdx], "above_ceiling_plenum_height", Json::realValue)){
-            spaceAboveCeilingPlenumHeight = lengthToMeters * spaces[spaceIdx].get("above_ceiling_plenum_height", spaceAboveCeilingPlenumHeight).asDouble();
-          }
-
-          double spaceFloorOffset = 0;
-          if (checkKeyAndType(spaces[spaceIdx], "floor_offset", Json::realValue)){
-            spaceFloorOffset = lengthToMeters * spaces[spaceIdx].get("floor_offset", spaceFloorOffset).asDouble();
-          }
+          Heights spaceHeights = getHeights(spaces[spaceIdx], currentStoryHeights, lengthToMeters);
+          double spaceBelowFloorPlenumHeight = spaceHeights.belowFloorPlenumHeight;
+          double spaceFloorToCeilingHeight = spaceHeights.floorToCeilingHeight;
+          double spaceAboveCeilingPlenumHeight = spaceHeights.aboveCeilingPlenumHeight;
 
           bool openToBelow = false;
           if (checkKeyAndType(spaces[spaceIdx], "open_to_below", Json::booleanValue)){
             openToBelow = spaces[spaceIdx].get("open_to_below", openToBelow).asBool();
           }
 
+          // skip objects not requested, plenum zones are still listed so they are kept when merging
+          if (spaceAndShadingIds && (spaceAndShadingIds->find(getId(spaces[spaceIdx])) == spaceAndShadingIds->end())){
+            if (spaceBelowFloorPlenumHeight > 0){
+              anyPlenums = true;
+              addPlenumThermalZoneName(spaces[spaceIdx], BELOWFLOORPLENUMPOSTFIX);
+            }
+            if (spaceAboveCeilingPlenumHeight > 0){
+              anyPlenums = true;
+              addPlenumThermalZoneName(spaces[spaceIdx], ABOVECEILINGPLENUMPOSTFIX);
+            }
+            continue;
+          }
+
           // create geometry
-          double minZ = currentStoryZ + spaceFloorOffset;
-          double maxZ = currentStoryZ + spaceFloorOffset + spaceBelowFloorPlenumHeight;
+          double minZ = spaceHeights.minZ;
+          double maxZ = spaceHeights.minZ + spaceBelowFloorPlenumHeight;
           if (spaceBelowFloorPlenumHeight > 0){
             anyPlenums = true;
             ThreeModelObjectMetadata spaceMetadata("OS:Space", "", spaceName + BELOWFLOORPLENUMPOSTFIX);
@@ -1283,34 +1299,32 @@ namespace openstudio{
             //shadingMultiplier = 1;
           }
 
-          double shadingBelowFloorPlenumHeight = storyBelowFloorPlenumHeight;
-          if (checkKeyAndType(shading[shadingdx], "below_floor_plenum_height", Json::realValue)){
-            shadingBelowFloorPlenumHeight = lengthToMeters * shading[shadingdx].get("below_floor_plenum_height", shadingBelowFloorPlenumHeight).asDouble();
-          }
-
-          double shadingFloorToCeilingHeight = storyFloorToCeilingHeight;
-          if (checkKeyAndType(shading[shadingdx], "floor_to_ceiling_height", Json::realValue)){
-            shadingFloorToCeilingHeight = lengthToMeters * shading[shadingdx].get("floor_to_ceiling_height", shadingFloorToCeilingHeight).asDouble();
-          }
-
-          double shadingAboveCeilingPlenumHeight = storyAboveCeilingPlenumHeight;
-          if (checkKeyAndType(shading[shadingdx], "above_ceiling_plenum_height", Json::realValue)){
-            shadingAboveCeilingPlenumHeight = lengthToMeters * shading[shadingdx].get("above_ceiling_plenum_height", shadingAboveCeilingPlenumHeight).asDouble();
-          }
-
-          double shadingFloorOffset = 0;
-          if (checkKeyAndType(shading[shadingdx], "floor_offset", Json::realValue)){
-            shadingFloorOffset = lengthToMeters * shading[shadingdx].get("floor_offset", shadingFloorOffset).asDouble();
-          }
+          Heights shadingHeights = getHeights(shading[shadingdx], currentStoryHeights, lengthToMeters);
+          double shadingBelowFloorPlenumHeight = shadingHeights.belowFloorPlenumHeight;
+          double shadingFloorToCeilingHeight = shadingHeights.floorToCeilingHeight;
+          double shadingAboveCeilingPlenumHeight = shadingHeights.aboveCeilingPlenumHeight;
 
           bool openToBelow = false;
           if (checkKeyAndType(shading[shadingdx], "open_to_below", Json::booleanValue)){
             openToBelow = shading[shadingdx].get("open_to_below", openToBelow).asBool();
           }
 
+          // skip objects not requested, plenum zones are still listed so they are kept when merging
+          if (spaceAndShadingIds && (spaceAndShadingIds->find(getId(shading[shadingdx])) == spaceAndShadingIds->end())){
+            if (shadingBelowFloorPlenumHeight > 0){
+              anyPlenums = true;
+              addPlenumThermalZoneName(shading[shadingdx], BELOWFLOORPLENUMPOSTFIX);
+            }
+            if (shadingAboveCeilingPlenumHeight > 0){
+              anyPlenums = true;
+              addPlenumThermalZoneName(shading[shadingdx], ABOVECEILINGPLENUMPOSTFIX);
+            }
+            continue;
+          }
+
           // create geometry
-          double minZ = currentStoryZ + shadingFloorOffset;
-          double maxZ = currentStoryZ + shadingFloorOffset + shadingBelowFloorPlenumHeight;
+          double minZ = shadingHeights.minZ;
+          double maxZ = shadingHeights.minZ + shadingBelowFloorPlenumHeight;
           if (shadingBelowFloorPlenumHeight > 0){
             anyPlenums = true;
             ThreeModelObjectMetadata shadingMetadata("OS:ShadingSurfaceGroup", "", shadingName + BELOWFLOORPLENUMPOSTFIX);
@@ -1347,11 +1361,6 @@ namespace openstudio{
 
       } // shading
 
-      // increment height for next story, will be (storyBelowFloorPlenumHeight + storyFloorToCeilingHeight + storyAboveCeilingPlenumHeight) for multiplier == 1
-      // DLM: TODO need to get the intersection and matching code in utilities, move stories after intersecting and matching
-      //currentStoryZ += 0.5*(storyMultiplier + 1)*(storyBelowFloorPlenumHeight + storyFloorToCeilingHeight + storyAboveCeilingPlenumHeight);
-      currentStoryZ += storyBelowFloorPlenumHeight + storyFloorToCeilingHeight + storyAboveCeilingPlenumHeight;
-
     } // stories
 
     // loop over building_units
@@ -1425,6 +1434,325 @@ namespace openstudio{
     return result;
   }
 
+  FloorplanChangeSet FloorplanJS::diff(const FloorplanJS& newFloorplan) const
+  {
+    FloorplanChangeSet result;
+
+    std::map<std::string, Json::Value> oldSignatures;
+    std::map<std::string, Json::Value> oldGeometrySignatures;
+    std::map<std::string, BoundingBox> oldBoundingBoxes;
+    std::map<std::string, Json::Value> oldObjects;
+    makeSignatures(oldSignatures, oldGeometrySignatures, oldBoundingBoxes, oldObjects);
+
+    std::map<std::string, Json::Value> newSignatures;
+    std::map<std::string, Json::Value> newGeometrySignatures;
+    std::map<std::string, BoundingBox> newBoundingBoxes;
+    std::map<std::string, Json::Value> newObjects;
+    newFloorplan.makeSignatures(newSignatures, newGeometrySignatures, newBoundingBoxes, newObjects);
+
+    auto isSpace = [](const Json::Value& object) {
+      return istringEqual(object.get("type", "").asString(), "space");
+    };
+
+    auto addReplacedNames = [&result, this](const Json::Value& object) {
+      std::string name = getName(object);
+      result.m_replacedNames.insert(name);
+      result.m_replacedNames.insert(name + BELOWFLOORPLENUMPOSTFIX);
+      result.m_replacedNames.insert(name + ABOVECEILINGPLENUMPOSTFIX);
+    };
+
+    // spaces which touch a space whose geometry changed must be intersected and matched again
+    std::vector<BoundingBox> changedBoundingBoxes;
+    std::set<std::string> modifiedIds;
+
+    for (const auto& oldSignature : oldSignatures){
+      const std::string& id = oldSignature.first;
+      const Json::Value& oldObject = oldObjects[id];
+
+      const auto& newSignature = newSignatures.find(id);
+      if (newSignature == newSignatures.end()){
+        result.m_removedObjects.push_back(FloorplanObject(oldObject));
+        addReplacedNames(oldObject);
+        if (isSpace(oldObject)){
+          changedBoundingBoxes.push_back(oldBoundingBoxes[id]);
+        }
+      } else if (oldSignature.second != newSignature->second){
+        modifiedIds.insert(id);
+        if (isSpace(oldObject) && (oldGeometrySignatures[id] != newGeometrySignatures[id])){
+          changedBoundingBoxes.push_back(oldBoundingBoxes[id]);
+          changedBoundingBoxes.push_back(newBoundingBoxes[id]);
+        }
+      }
+    }
+
+    for (const auto& newSignature : newSignatures){
+      const std::string& id = newSignature.first;
+      if (oldSignatures.find(id) == oldSignatures.end()){
+        const Json::Value& newObject = newObjects[id];
+        result.m_addedObjects.push_back(FloorplanObject(newObject));
+        if (isSpace(newObject)){
+          changedBoundingBoxes.push_back(newBoundingBoxes[id]);
+        }
+      }
+    }
+
+    if (!changedBoundingBoxes.empty()){
+      for (auto& newBoundingBox : newBoundingBoxes){
+        const std::string& id = newBoundingBox.first;
+        if ((modifiedIds.find(id) != modifiedIds.end()) || (oldSignatures.find(id) == oldSignatures.end())){
+          continue;
+        }
+        if (!isSpace(newObjects[id])){
+          continue;
+        }
+        for (const auto& changedBoundingBox : changedBoundingBoxes){
+          if (newBoundingBox.second.intersects(changedBoundingBox)){
+            modifiedIds.insert(id);
+            break;
+          }
+        }
+      }
+    }
+
+    for (const auto& id : modifiedIds){
+      result.m_modifiedObjects.push_back(FloorplanObject(newObjects[id]));
+      addReplacedNames(oldObjects[id]);
+    }
+
+    return result;
+  }
+
+  void FloorplanJS::makeSignatures(std::map<std::string, Json::Value>& signatures, std::map<std::string, Json::Value>& geometrySignatures,
+    std::map<std::string, BoundingBox>& boundingBoxes, std::map<std::string, Json::Value>& objects) const
+  {
+    const Json::Value windowDefinitions = m_value.get("window_definitions", Json::arrayValue);
+    const Json::Value doorDefinitions = m_value.get("door_definitions", Json::arrayValue);
+    const Json::Value daylightingControlDefinitions = m_value.get("daylighting_control_definitions", Json::arrayValue);
+
+    double lengthToMeters = 1;
+    if (istringEqual(units(), "ip")){
+      lengthToMeters = 0.3048;
+    }
+
+    // referenced objects whose names and handles are written to each surface
+    std::vector<std::pair<std::string, std::string> > references;
+    references.push_back(std::make_pair("building_unit_id", "building_units"));
+    references.push_back(std::make_pair("thermal_zone_id", "thermal_zones"));
+    references.push_back(std::make_pair("space_type_id", "space_types"));
+    references.push_back(std::make_pair("construction_set_id", "construction_sets"));
+
+    Json::Value stories = m_value.get("stories", Json::arrayValue);
+    std::vector<Heights> storyHeights = getStoryHeights(lengthToMeters);
+    Json::ArrayIndex storyN = stories.size();
+    for (Json::ArrayIndex storyIdx = 0; storyIdx < storyN; ++storyIdx){
+      const Json::Value& story = stories[storyIdx];
+
+      // story properties which are written to each surface
+      Json::Value storyProperties(Json::objectValue);
+      storyProperties["name"] = story.get("name", "");
+      storyProperties["handle"] = story.get("handle", "");
+      storyProperties["multiplier"] = story.get("multiplier", 1);
+
+      Json::Value geometry = story.get("geometry", Json::objectValue);
+      Json::Value vertices = geometry.get("vertices", Json::arrayValue);
+      Json::Value edges = geometry.get("edges", Json::arrayValue);
+      Json::Value faces = geometry.get("faces", Json::arrayValue);
+
+      // windows and doors with their definitions by edge
+      std::map<std::string, Json::Value> edgeIdToOpeningsMap;
+      for (const auto& window : story.get("windows", Json::arrayValue)){
+        Json::Value opening(Json::objectValue);
+        opening["window"] = window;
+        if (const Json::Value* windowDefinition = findById(windowDefinitions, window.get("window_definition_id", "").asString())){
+          opening["definition"] = *windowDefinition;
+        }
+        edgeIdToOpeningsMap[window.get("edge_id", "").asString()].append(opening);
+      }
+      for (const auto& door : story.get("doors", Json::arrayValue)){
+        Json::Value opening(Json::objectValue);
+        opening["door"] = door;
+        if (const Json::Value* doorDefinition = findById(doorDefinitions, door.get("door_definition_id", "").asString())){
+          opening["definition"] = *doorDefinition;
+        }
+        edgeIdToOpeningsMap[door.get("edge_id", "").asString()].append(opening);
+      }
+
+      for (const std::string& key : {std::string("spaces"), std::string("shading")}){
+        for (const auto& object : story.get(key, Json::arrayValue)){
+          std::string id = getId(object);
+
+          Heights heights = getHeights(object, storyHeights[storyIdx], lengthToMeters);
+          double minZ = heights.minZ;
+          double maxZ = minZ + heights.belowFloorPlenumHeight + heights.floorToCeilingHeight + heights.aboveCeilingPlenumHeight;
+
+          Json::Value faceVertices(Json::arrayValue);
+          Json::Value openings(Json::arrayValue);
+          BoundingBox boundingBox;
+
+          const Json::Value* face = findById(faces, getFaceId(object));
+          if (face){
+            Json::Value edgeIds = face->get("edge_ids", Json::arrayValue);
+            Json::Value edgeOrders = face->get("edge_order", Json::arrayValue);
+            Json::ArrayIndex edgeN = std::min(edgeIds.size(), edgeOrders.size());
+            for (Json::ArrayIndex edgeIdx = 0; edgeIdx < edgeN; ++edgeIdx){
+              std::string edgeId = edgeIds[edgeIdx].asString();
+
+              const Json::Value* edge = findById(edges, edgeId);
+              if (edge){
+                Json::Value vertexIds = edge->get("vertex_ids", Json::arrayValue);
+                if (vertexIds.size() != 2u){
+                  continue;
+                }
+
+                std::string vertexId = vertexIds[edgeOrders[edgeIdx].asUInt() == 1 ? 0u : 1u].asString();
+                if (const Json::Value* vertex = findById(vertices, vertexId)){
+                  double x = vertex->get("x", 0.0).asDouble();
+                  double y = vertex->get("y", 0.0).asDouble();
+                  faceVertices.append(x);
+                  faceVertices.append(y);
+                  boundingBox.addPoint(Point3d(lengthToMeters * x, lengthToMeters * y, minZ));
+                  boundingBox.addPoint(Point3d(lengthToMeters * x, lengthToMeters * y, maxZ));
+                }
+              }
+
+              const auto& it = edgeIdToOpeningsMap.find(edgeId);
+              if (it != edgeIdToOpeningsMap.end()){
+                openings.append(it->second);
+              }
+            }
+          }
+
+          Json::Value geometrySignature(Json::objectValue);
+          geometrySignature["length_to_meters"] = lengthToMeters;
+          geometrySignature["min_z"] = minZ;
+          geometrySignature["below_floor_plenum_height"] = heights.belowFloorPlenumHeight;
+          geometrySignature["floor_to_ceiling_height"] = heights.floorToCeilingHeight;
+          geometrySignature["above_ceiling_plenum_height"] = heights.aboveCeilingPlenumHeight;
+          geometrySignature["vertices"] = faceVertices;
+          geometrySignature["openings"] = openings;
+
+          Json::Value signature(Json::objectValue);
+          signature["geometry"] = geometrySignature;
+          signature["object"] = object;
+          signature["story"] = storyProperties;
+
+          for (const auto& reference : references){
+            if (checkKeyAndType(object, reference.first, Json::stringValue)){
+              if (const Json::Value* referenced = findById(m_value[reference.second], object.get(reference.first, "").asString())){
+                Json::Value referenceProperties(Json::objectValue);
+                referenceProperties["name"] = referenced->get("name", "");
+                referenceProperties["handle"] = referenced->get("handle", "");
+                signature["references"][reference.first] = referenceProperties;
+              }
+            }
+          }
+
+          for (const auto& daylightingControl : object.get("daylighting_controls", Json::arrayValue)){
+            Json::Value control(Json::objectValue);
+            if (const Json::Value* vertex = findById(vertices, daylightingControl.get("vertex_id", "").asString())){
+              control["x"] = vertex->get("x", 0.0);
+              control["y"] = vertex->get("y", 0.0);
+            }
+            if (const Json::Value* definition = findById(daylightingControlDefinitions, daylightingControl.get("daylighting_control_definition_id", "").asString())){
+              control["definition"] = *definition;
+            }
+            signature["daylighting_controls"].append(control);
+          }
+
+          signatures[id] = signature;
+          geometrySignatures[id] = geometrySignature;
+          boundingBoxes[id] = boundingBox;
+          objects[id] = object;
+        }
+      }
+    }
+  }
+
+  std::vector<FloorplanJS::Heights> FloorplanJS::getStoryHeights(double lengthToMeters) const
+  {
+    std::vector<Heights> result;
+
+    double currentStoryZ = 0;
+    Json::Value project = m_value.get("project", Json::objectValue);
+    if (!project.isNull()){
+      Json::Value ground = project.get("ground", Json::objectValue);
+      if (!ground.isNull()){
+        if (checkKeyAndType(ground, "floor_offset", Json::realValue)){
+          currentStoryZ = ground.get("floor_offset", 0.0).asDouble();
+        }
+      }
+    }
+
+    for (const auto& story : m_value.get("stories", Json::arrayValue)){
+      Heights heights;
+      heights.minZ = currentStoryZ;
+
+      heights.belowFloorPlenumHeight = 0;
+      if (checkKeyAndType(story, "below_floor_plenum_height", Json::realValue)){
+        heights.belowFloorPlenumHeight = lengthToMeters * story.get("below_floor_plenum_height", heights.belowFloorPlenumHeight).asDouble();
+      }
+
+      heights.floorToCeilingHeight = 3; // default is 3 m
+      if (checkKeyAndType(story, "floor_to_ceiling_height", Json::realValue)){
+        heights.floorToCeilingHeight = lengthToMeters * story.get("floor_to_ceiling_height", heights.floorToCeilingHeight).asDouble();
+      }
+
+      heights.aboveCeilingPlenumHeight = 0;
+      if (checkKeyAndType(story, "above_ceiling_plenum_height", Json::realValue)){
+        heights.aboveCeilingPlenumHeight = lengthToMeters * story.get("above_ceiling_plenum_height", heights.aboveCeilingPlenumHeight).asDouble();
+      }
+
+      // DLM: temp code
+      if (heights.floorToCeilingHeight < 0.1){
+        heights.floorToCeilingHeight = 3;
+      }
+
+      result.push_back(heights);
+
+      // increment height for next story, will be (belowFloorPlenumHeight + floorToCeilingHeight + aboveCeilingPlenumHeight) for multiplier == 1
+      // DLM: TODO need to get the intersection and matching code in utilities, move stories after intersecting and matching
+      //currentStoryZ += 0.5*(storyMultiplier + 1)*(belowFloorPlenumHeight + floorToCeilingHeight + aboveCeilingPlenumHeight);
+      currentStoryZ += heights.belowFloorPlenumHeight + heights.floorToCeilingHeight + heights.aboveCeilingPlenumHeight;
+    }
+
+    return result;
+  }
+
+  FloorplanJS::Heights FloorplanJS::getHeights(const Json::Value& spaceOrShading, const Heights& storyHeights, double lengthToMeters) const
+  {
+    Heights result = storyHeights;
+
+    if (checkKeyAndType(spaceOrShading, "below_floor_plenum_height", Json::realValue)){
+      result.belowFloorPlenumHeight = lengthToMeters * spaceOrShading.get("below_floor_plenum_height", result.belowFloorPlenumHeight).asDouble();
+    }
+
+    if (checkKeyAndType(spaceOrShading, "floor_to_ceiling_height", Json::realValue)){
+      result.floorToCeilingHeight = lengthToMeters * spaceOrShading.get("floor_to_ceiling_height", result.floorToCeilingHeight).asDouble();
+    }
+
+    if (checkKeyAndType(spaceOrShading, "above_ceiling_plenum_height", Json::realValue)){
+      result.aboveCeilingPlenumHeight = lengthToMeters * spaceOrShading.get("above_ceiling_plenum_height", result.aboveCeilingPlenumHeight).asDouble();
+    }
+
+    if (checkKeyAndType(spaceOrShading, "floor_offset", Json::realValue)){
+      result.minZ += lengthToMeters * spaceOrShading.get("floor_offset", 0.0).asDouble();
+    }
+
+    return result;
+  }
+
+  void FloorplanJS::addPlenumThermalZoneName(const Json::Value& spaceOrShading, const std::string& postfix) const
+  {
+    if (checkKeyAndType(spaceOrShading, "thermal_zone_id", Json::stringValue)){
+      std::string id = spaceOrShading.get("thermal_zone_id", "").asString();
+      if (const Json::Value* thermalZone = findById(m_value["thermal_zones"], id)){
+        if (checkKeyAndType(*thermalZone, "name", Json::stringValue)){
+          m_plenumThermalZoneNames.insert(thermalZone->get("name", "").asString() + postfix);
+        }
+      }
+    }
+  }
+
   std::string FloorplanJS::units() const
   {
     std::string units = "ip";
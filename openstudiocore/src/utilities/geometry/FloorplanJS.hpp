@@ -43,6 +43,7 @@
 
 #include <vector>
 #include <set>
+#include <map>
 #include <boost/optional.hpp>
 
 namespace openstudio{
@@ -116,6 +117,45 @@ namespace openstudio{
     std::map<std::string, FloorplanObject> m_objectReferenceMap;
   };
 
+  /** FloorplanChangeSet lists the spaces and shading which differ between two FloorplanJS documents, objects are matched by id.
+  *   Objects are considered modified if any input to their generated geometry or properties changed, this includes edits to
+  *   their story or to stories below them.  Spaces whose geometry did not change but which touch a space whose geometry did
+  *   are also listed as modified because their surfaces must be intersected and matched again.
+  *
+  *  The class is not impl-ized in hopes that it can be ported to JavaScript via emscripten
+  */
+  class UTILITIES_API FloorplanChangeSet{
+  public:
+
+    /// spaces and shading in the new floorplan which are not in the old floorplan
+    std::vector<FloorplanObject> addedObjects() const;
+
+    /// spaces and shading in the old floorplan which are not in the new floorplan
+    std::vector<FloorplanObject> removedObjects() const;
+
+    /// spaces and shading in both floorplans which must be regenerated, values are from the new floorplan
+    std::vector<FloorplanObject> modifiedObjects() const;
+
+    /// ids of added and modified objects, pass to FloorplanJS::toThreeScene to regenerate only these objects
+    std::set<std::string> affectedIds() const;
+
+    /// names of all Spaces and ShadingSurfaceGroups generated from removed and modified objects in the old floorplan, including plenums
+    std::set<std::string> replacedNames() const;
+
+    /// true if no objects were added, removed, or modified
+    bool empty() const;
+
+  private:
+    friend class FloorplanJS;
+
+    FloorplanChangeSet();
+
+    std::vector<FloorplanObject> m_addedObjects;
+    std::vector<FloorplanObject> m_removedObjects;
+    std::vector<FloorplanObject> m_modifiedObjects;
+    std::set<std::string> m_replacedNames;
+  };
+
   /** FloorplanJS is an adapter for the FloorspaceJS JSON format.  This class includes code which transforms a FloorspaceJS JSON into a 3D model in ThreeJS format.
   *   There are two variations of the ThreeJS format, one which is suitable for rendering with ThreeJS and one that preserves all vertices in a surface for
   *   conversion to OpenStudio Model format.  Converting from FloorspaceJS to ThreeJS to OpenStudio ensures that the ThreeJS preview of a FloorspaceJS model is as
@@ -148,6 +188,14 @@ namespace openstudio{
     /// ThreeJS file produced will always be in metric units, NorthAxis will not be applied during this conversion
     ThreeScene toThreeScene(bool openstudioFormat) const;
 
+    /// convert to ThreeJS, only spaces and shading with ids in spaceAndShadingIds will have geometry and metadata
+    /// all stories, building units, thermal zones, space types, and construction sets are included
+    /// use with FloorplanChangeSet::affectedIds to update a model without regenerating unchanged spaces
+    ThreeScene toThreeScene(bool openstudioFormat, const std::set<std::string>& spaceAndShadingIds) const;
+
+    /// compare to newFloorplan by object id and return the spaces and shading which must be updated
+    FloorplanChangeSet diff(const FloorplanJS& newFloorplan) const;
+
     /// unit system, "ip" or "si"
     std::string units() const;
     bool setUnits(const std::string& units);
@@ -175,6 +223,30 @@ namespace openstudio{
 
     FloorplanJS(const Json::Value& value);
 
+    ThreeScene makeThreeScene(bool openstudioFormat, const std::set<std::string>* spaceAndShadingIds) const;
+
+    // elevation and heights in meters of a story, space, or shading
+    struct Heights
+    {
+      double minZ;
+      double belowFloorPlenumHeight;
+      double floorToCeilingHeight;
+      double aboveCeilingPlenumHeight;
+    };
+
+    // heights of each story in order, stories are stacked on top of each other starting at the ground floor offset
+    std::vector<Heights> getStoryHeights(double lengthToMeters) const;
+
+    // heights of a space or shading, defaults to its story's heights and is offset from the story's elevation
+    Heights getHeights(const Json::Value& spaceOrShading, const Heights& storyHeights, double lengthToMeters) const;
+
+    // signature of all inputs to the geometry generated for each space and shading, keyed by id
+    // geometrySignatures only includes inputs which change the shape or position of surfaces
+    void makeSignatures(std::map<std::string, Json::Value>& signatures, std::map<std::string, Json::Value>& geometrySignatures,
+      std::map<std::string, BoundingBox>& boundingBoxes, std::map<std::string, Json::Value>& objects) const;
+
+    void addPlenumThermalZoneName(const Json::Value& spaceOrShading, const std::string& postfix) const;
+
     ThreeModelObjectMetadata makeModelObjectMetadata(const std::string& iddObjectType, const Json::Value& object) const;
 
     void makeGeometries(const Json::Value& story, const Json::Value& spaceOrShading, bool belowFloorPlenum, bool aboveCeilingPlenum,
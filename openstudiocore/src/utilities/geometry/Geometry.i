@@ -66,6 +66,9 @@
 %template(ThreeModelObjectMetadataVector) std::vector<openstudio::ThreeModelObjectMetadata>;
 %ignore std::vector<openstudio::ThreeModelObjectMetadata>::vector(size_type);
 %ignore std::vector<openstudio::ThreeModelObjectMetadata>::resize(size_type);
+%ignore std::vector<openstudio::FloorplanObject>::vector(size_type);
+%ignore std::vector<openstudio::FloorplanObject>::resize(size_type);
+%template(FloorplanObjectVector) std::vector<openstudio::FloorplanObject>;
 
 %ignore openstudio::operator<<;
 
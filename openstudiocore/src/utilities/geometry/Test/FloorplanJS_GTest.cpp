@@ -77,3 +77,84 @@ TEST_F(GeometryFixture, FloorplanJS)
   }
 
 }
+
+TEST_F(GeometryFixture, FloorplanJS_Diff)
+{
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/floorplan.json");
+  ASSERT_TRUE(exists(p));
+
+  std::ifstream ifs(toSystemFilename(p));
+  EXPECT_TRUE(ifs.is_open());
+
+  std::istreambuf_iterator<char> eos;
+  std::string contents(std::istreambuf_iterator<char>(ifs), eos);
+  ifs.close();
+  EXPECT_FALSE(contents.empty());
+
+  Json::Reader reader;
+  Json::Value value;
+  ASSERT_TRUE(reader.parse(contents, value));
+  Json::FastWriter writer;
+
+  FloorplanJS floorplan(contents);
+
+  // no changes
+  FloorplanChangeSet changeSet = floorplan.diff(FloorplanJS(contents));
+  EXPECT_TRUE(changeSet.empty());
+  EXPECT_TRUE(changeSet.affectedIds().empty());
+
+  // renaming a space does not change its geometry, spaces it touches are not affected
+  Json::Value renamed = value;
+  ASSERT_EQ("13", renamed["stories"][0]["spaces"][1].get("id", "").asString());
+  renamed["stories"][0]["spaces"][1]["name"] = "Space 2 Renamed";
+  FloorplanJS renamedFloorplan(writer.write(renamed));
+
+  changeSet = floorplan.diff(renamedFloorplan);
+  EXPECT_FALSE(changeSet.empty());
+  EXPECT_TRUE(changeSet.addedObjects().empty());
+  EXPECT_TRUE(changeSet.removedObjects().empty());
+  ASSERT_EQ(1u, changeSet.modifiedObjects().size());
+  EXPECT_EQ("13", changeSet.modifiedObjects()[0].id());
+  EXPECT_EQ("Space 2 Renamed", changeSet.modifiedObjects()[0].name());
+  EXPECT_EQ(1u, changeSet.affectedIds().size());
+  EXPECT_EQ(1u, changeSet.replacedNames().count("Space 2"));
+  EXPECT_EQ(1u, changeSet.replacedNames().count("Space 2 Plenum"));
+
+  ThreeScene scene = renamedFloorplan.toThreeScene(true, changeSet.affectedIds());
+  std::vector<ThreeSceneChild> children = scene.object().children();
+  EXPECT_FALSE(children.empty());
+  for (const auto& child : children){
+    EXPECT_EQ("Space 2 Renamed", child.userData().spaceName());
+  }
+  EXPECT_LT(children.size(), renamedFloorplan.toThreeScene(true).object().children().size());
+
+  // changing the height of the first story moves every space above it
+  Json::Value taller = value;
+  taller["stories"][0]["floor_to_ceiling_height"] = 4.0;
+
+  changeSet = floorplan.diff(FloorplanJS(writer.write(taller)));
+  EXPECT_TRUE(changeSet.addedObjects().empty());
+  EXPECT_TRUE(changeSet.removedObjects().empty());
+  EXPECT_EQ(4u, changeSet.modifiedObjects().size());
+
+  // removing a space affects the spaces it touched
+  Json::Value removed = value;
+  Json::Value removedSpace;
+  ASSERT_TRUE(removed["stories"][1]["spaces"].removeIndex(1, &removedSpace));
+  EXPECT_EQ("38", removedSpace.get("id", "").asString());
+
+  changeSet = floorplan.diff(FloorplanJS(writer.write(removed)));
+  EXPECT_TRUE(changeSet.addedObjects().empty());
+  ASSERT_EQ(1u, changeSet.removedObjects().size());
+  EXPECT_EQ("38", changeSet.removedObjects()[0].id());
+  EXPECT_EQ("Space 4", changeSet.removedObjects()[0].name());
+  EXPECT_EQ(0u, changeSet.affectedIds().count("38"));
+  EXPECT_EQ(1u, changeSet.affectedIds().count("28"));
+  EXPECT_EQ(1u, changeSet.replacedNames().count("Space 4"));
+
+  // the reverse diff adds it back
+  changeSet = FloorplanJS(writer.write(removed)).diff(floorplan);
+  ASSERT_EQ(1u, changeSet.addedObjects().size());
+  EXPECT_EQ("38", changeSet.addedObjects()[0].id());
+  EXPECT_EQ(1u, changeSet.affectedIds().count("38"));
+}
@@ -34,6 +34,8 @@
 
 #include <resources.hxx>
 
+#include <cstring>
+
 using namespace openstudio;
 
 TEST_F(GeometryFixture, ThreeJS)
@@ -60,3 +62,43 @@ TEST_F(GeometryFixture, ThreeJS)
   scene = ThreeScene::load(toString(p));
   ASSERT_TRUE(scene);
 }
+
+TEST_F(GeometryFixture, ThreeJS_BinaryBuffer)
+{
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/threejs.json");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<ThreeScene> scene = ThreeScene::load(toString(p));
+  ASSERT_TRUE(scene);
+
+  std::vector<ThreeGeometry> geometries = scene->geometries();
+  ASSERT_FALSE(geometries.empty());
+
+  size_t expectedSize = 0;
+  for (const auto& geometry : geometries){
+    expectedSize += 4 * (geometry.data().vertices().size() + geometry.data().faces().size());
+  }
+
+  std::vector<unsigned char> buffer;
+  std::string json = scene->toJSON(buffer);
+  EXPECT_FALSE(json.empty());
+  EXPECT_EQ(expectedSize, buffer.size());
+
+  // binary output is not loadable, geometry arrays are replaced by views
+  EXPECT_FALSE(ThreeScene::load(json));
+
+  // first geometry's vertices start the buffer as little endian floats
+  std::vector<double> vertices = geometries[0].data().vertices();
+  ASSERT_FALSE(vertices.empty());
+  uint32_t bits = buffer[0] | (buffer[1] << 8) | (buffer[2] << 16) | (static_cast<uint32_t>(buffer[3]) << 24);
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  EXPECT_FLOAT_EQ(static_cast<float>(vertices[0]), f);
+
+  // faces follow the vertices
+  std::vector<size_t> faces = geometries[0].data().faces();
+  ASSERT_FALSE(faces.empty());
+  size_t facesOffset = 4 * vertices.size();
+  bits = buffer[facesOffset] | (buffer[facesOffset + 1] << 8) | (buffer[facesOffset + 2] << 16) | (static_cast<uint32_t>(buffer[facesOffset + 3]) << 24);
+  EXPECT_EQ(faces[0], bits);
+}
@@ -37,6 +37,8 @@
 
 #include <jsoncpp/json.h>
 
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <string>
 
@@ -342,6 +344,16 @@ namespace openstudio{
   }
 
   std::string ThreeScene::toJSON(bool prettyPrint) const
+  {
+    return writeJSON(nullptr, prettyPrint);
+  }
+
+  std::string ThreeScene::toJSON(std::vector<unsigned char>& buffer, bool prettyPrint) const
+  {
+    return writeJSON(&buffer, prettyPrint);
+  }
+
+  std::string ThreeScene::writeJSON(std::vector<unsigned char>* buffer, bool prettyPrint) const
   {
     Json::Value scene(Json::objectValue);
 
@@ -350,8 +362,19 @@ namespace openstudio{
 
     // geometries
     Json::Value geometries(Json::arrayValue);
+    if (buffer){
+      size_t byteLength = buffer->size();
+      for (const auto& g : m_geometries) {
+        byteLength += g.binaryByteLength();
+      }
+      buffer->reserve(byteLength);
+    }
     for (const auto& g : m_geometries) {
-      geometries.append(g.toJsonValue());
+      if (buffer){
+        geometries.append(g.toJsonValue(*buffer));
+      } else{
+        geometries.append(g.toJsonValue());
+      }
     }
     scene["geometries"] = geometries;
 
@@ -365,6 +388,15 @@ namespace openstudio{
     // object
     scene["object"] = m_sceneObject.toJsonValue();
 
+    // binary buffer referenced by geometry views
+    if (buffer){
+      Json::Value bufferValue(Json::objectValue);
+      bufferValue["byteLength"] = static_cast<Json::UInt64>(buffer->size());
+      Json::Value buffers(Json::arrayValue);
+      buffers.append(bufferValue);
+      scene["buffers"] = buffers;
+    }
+
     // write to string
     std::string result;
     if (prettyPrint){
@@ -504,6 +536,64 @@ namespace openstudio{
   }
 
 
+  // glTF accessor component types
+  static const unsigned threeFloatComponentType = 5126;
+  static const unsigned threeUnsignedIntComponentType = 5125;
+
+  static void appendLittleEndian(uint32_t value, std::vector<unsigned char>& buffer)
+  {
+    buffer.push_back(static_cast<unsigned char>(value & 0xFF));
+    buffer.push_back(static_cast<unsigned char>((value >> 8) & 0xFF));
+    buffer.push_back(static_cast<unsigned char>((value >> 16) & 0xFF));
+    buffer.push_back(static_cast<unsigned char>((value >> 24) & 0xFF));
+  }
+
+  static Json::Value makeBufferView(size_t byteOffset, size_t count, unsigned componentType)
+  {
+    Json::Value result(Json::objectValue);
+    result["buffer"] = 0;
+    result["byteOffset"] = static_cast<Json::UInt64>(byteOffset);
+    result["byteLength"] = static_cast<Json::UInt64>(4 * count);
+    result["componentType"] = componentType;
+    result["count"] = static_cast<Json::UInt64>(count);
+    return result;
+  }
+
+  Json::Value ThreeGeometryData::toJsonValue(std::vector<unsigned char>& buffer) const
+  {
+    Json::Value result;
+
+    size_t verticesOffset = buffer.size();
+    for (const auto& v : m_vertices){
+      float f = static_cast<float>(v);
+      uint32_t bits;
+      std::memcpy(&bits, &f, sizeof(bits));
+      appendLittleEndian(bits, buffer);
+    }
+    result["vertices"] = makeBufferView(verticesOffset, m_vertices.size(), threeFloatComponentType);
+
+    size_t facesOffset = buffer.size();
+    for (const size_t& f : m_faces){
+      appendLittleEndian(static_cast<uint32_t>(f), buffer);
+    }
+    result["faces"] = makeBufferView(facesOffset, m_faces.size(), threeUnsignedIntComponentType);
+
+    result["normals"] = Json::Value(Json::arrayValue);
+    result["uvs"] = Json::Value(Json::arrayValue);
+    result["scale"] = m_scale;
+    result["visible"] = m_visible;
+    result["castShadow"] = m_castShadow;
+    result["receiveShadow"] = m_receiveShadow;
+    result["doubleSided"] = m_doubleSided;
+
+    return result;
+  }
+
+  size_t ThreeGeometryData::binaryByteLength() const
+  {
+    return 4 * (m_vertices.size() + m_faces.size());
+  }
+
   std::vector<double> ThreeGeometryData::vertices() const
   {
     return m_vertices;
@@ -573,6 +663,21 @@ namespace openstudio{
     return result;
   }
 
+  Json::Value ThreeGeometry::toJsonValue(std::vector<unsigned char>& buffer) const
+  {
+    Json::Value result(Json::objectValue);
+    result["uuid"] = m_uuid;
+    result["type"] = m_type;
+    result["data"] = m_data.toJsonValue(buffer);
+
+    return result;
+  }
+
+  size_t ThreeGeometry::binaryByteLength() const
+  {
+    return m_data.binaryByteLength();
+  }
+
    std::string ThreeGeometry::uuid() const
    {
      return m_uuid;
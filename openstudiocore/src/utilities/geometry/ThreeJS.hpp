@@ -113,6 +113,8 @@ namespace openstudio{
     friend class ThreeGeometry;
     ThreeGeometryData(const Json::Value& json);
     Json::Value toJsonValue() const;
+    Json::Value toJsonValue(std::vector<unsigned char>& buffer) const;
+    size_t binaryByteLength() const;
 
     std::vector<double> m_vertices;
     std::vector<size_t> m_normals;
@@ -137,6 +139,8 @@ namespace openstudio{
     friend class ThreeScene;
     ThreeGeometry(const Json::Value& json);
     Json::Value toJsonValue() const;
+    Json::Value toJsonValue(std::vector<unsigned char>& buffer) const;
+    size_t binaryByteLength() const;
 
     std::string m_uuid;
     std::string m_type;
@@ -539,6 +543,12 @@ namespace openstudio{
     /// print to JSON
     std::string toJSON(bool prettyPrint = false) const;
 
+    /// print to JSON with geometry vertices and faces appended to buffer instead of written as JSON number arrays
+    /// vertices are little endian 32 bit floats and faces are little endian 32 bit unsigned integers, each geometry
+    /// references its data with glTF style views giving buffer, byteOffset, byteLength, componentType, and count
+    /// intended for display, the result cannot be loaded by ThreeScene
+    std::string toJSON(std::vector<unsigned char>& buffer, bool prettyPrint = false) const;
+
     ThreeSceneMetadata metadata() const;
     std::vector<ThreeGeometry> geometries() const;
     boost::optional<ThreeGeometry> getGeometry(const std::string& geometryId) const;
@@ -549,6 +559,8 @@ namespace openstudio{
   private:
     REGISTER_LOGGER("ThreeScene");
 
+    std::string writeJSON(std::vector<unsigned char>* buffer, bool prettyPrint) const;
+
     ThreeSceneMetadata m_metadata;
     std::vector<ThreeGeometry> m_geometries;
     std::vector<ThreeMaterial> m_materials;
@@ -41,6 +41,7 @@
 #include "../plot/ProgressBar.hpp"
 #include "../core/PathHelpers.hpp"
 #include "../core/Assert.hpp"
+#include "../core/Trace.hpp"
 
 
 
@@ -326,6 +327,8 @@ boost::optional<IdfFile> IdfFile::load(std::istream& is,
                                        const IddFileType& iddFileType,
                                        ProgressBar* progressBar)
 {
+  OS_TRACE_SCOPE("idf", "IdfFile::load");
+
   IdfFile result(iddFileType);
   // remove initial version object
   if (OptionalIdfObject vo = result.versionObject()) {
@@ -343,6 +346,8 @@ OptionalIdfFile IdfFile::load(std::istream& is,
                               const IddFile& iddFile,
                               ProgressBar* progressBar)
 {
+  OS_TRACE_SCOPE("idf", "IdfFile::load");
+
   IdfFile result(iddFile);
   // remove initial version object
   if (OptionalIdfObject vo = result.versionObject()) {
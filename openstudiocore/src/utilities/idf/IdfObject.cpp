@@ -50,6 +50,7 @@
 #include "../units/OSOptionalQuantity.hpp"
 #include "../units/QuantityConverter.hpp"
 
+#include <boost/functional/hash.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include <iomanip>
@@ -1141,6 +1142,10 @@ namespace detail {
   }
 
   bool IdfObject_Impl::dataFieldsEqual(const IdfObject& other) const {
+    return dataFieldsEqual(other, false);
+  }
+
+  bool IdfObject_Impl::dataFieldsEqual(const IdfObject& other, bool ignoreName) const {
     if (m_iddObject != other.iddObject()) {
       return false;
     }
@@ -1154,6 +1159,10 @@ namespace detail {
 
     // iddObject() same, field indices same--compare data
     for (unsigned i : myFields) {
+      if (ignoreName && iName && (i == iName.get())) {
+        continue;
+      }
+
       bool compareStrings = true;
       OptionalIddField oIddField = m_iddObject.getField(i);
 
@@ -1208,6 +1217,52 @@ namespace detail {
     return true;
   }
 
+  std::size_t IdfObject_Impl::dataFieldsHash() const {
+    std::size_t result = 0;
+    OptionalUnsigned iName = m_iddObject.nameFieldIndex();
+
+    // must agree with dataFieldsEqual--anything compared with a tolerance or a normalization
+    // other than case only contributes whether or not it has a value
+    for (unsigned i : dataFields()) {
+      if (iName && (i == iName.get())) {
+        continue;
+      }
+      boost::hash_combine(result, i);
+
+      OptionalIddField oIddField = m_iddObject.getField(i);
+      if (oIddField) {
+        IddFieldType fieldType = oIddField->properties().type;
+        if (fieldType == IddFieldType::IntegerType) {
+          if (OptionalInt oIntValue = getInt(i)) {
+            boost::hash_combine(result, oIntValue.get());
+            continue;
+          }
+        }
+        else if (fieldType == IddFieldType::RealType) {
+          if (getDouble(i)) {
+            boost::hash_combine(result, 'r');
+            continue;
+          }
+        }
+        else if (fieldType == IddFieldType::URLType) {
+          if (getURL(i)) {
+            boost::hash_combine(result, 'u');
+            continue;
+          }
+        }
+      }
+
+      // strings (case-insensitive)
+      OptionalString oStringValue = getString(i);
+      OS_ASSERT(oStringValue);
+      for (char c : *oStringValue) {
+        boost::hash_combine(result, toupper(static_cast<unsigned char>(c)));
+      }
+    }
+
+    return result;
+  }
+
   bool IdfObject_Impl::objectListFieldsEqual(const IdfObject& other) const {
     if (m_iddObject != other.iddObject()) { return false; }
     UnsignedVector myFields = objectListFields();
@@ -2342,6 +2397,10 @@ bool IdfObject::dataFieldsEqual(const IdfObject& other) const {
   return m_impl->dataFieldsEqual(other);
 }
 
+std::size_t IdfObject::dataFieldsHash() const {
+  return m_impl->dataFieldsHash();
+}
+
 bool IdfObject::objectListFieldsEqual(const IdfObject& other) const {
   return m_impl->objectListFieldsEqual(other);
 }
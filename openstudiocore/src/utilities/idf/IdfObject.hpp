@@ -331,6 +331,10 @@ class UTILITIES_API IdfObject {
    *  of name. */
   bool dataFieldsEqual(const IdfObject& other) const;
 
+  /** Returns a hash of the data fields, excluding the name. Objects that are dataFieldsEqual
+   *  always have the same hash, so the hash can be used to find equality candidates quickly. */
+  std::size_t dataFieldsHash() const;
+
   /** Checks for equality of objectListFields(). Prerequisite: iddObject()s must be
    *  equal. */
   bool objectListFieldsEqual(const IdfObject& other) const;
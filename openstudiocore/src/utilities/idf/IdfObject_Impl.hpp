@@ -324,6 +324,14 @@ namespace detail {
      *  of name. */
     bool dataFieldsEqual(const IdfObject& other) const;
 
+    /** As above, but optionally skips the name field so that otherwise identical objects
+     *  compare equal. */
+    bool dataFieldsEqual(const IdfObject& other, bool ignoreName) const;
+
+    /** Returns a hash of the data fields, excluding the name. Objects that are
+     *  dataFieldsEqual always have the same hash. */
+    std::size_t dataFieldsHash() const;
+
     /** Checks for equality of objectListFields(). Prerequisite: iddObject()s must be
      *  equal. */
     bool objectListFieldsEqual(const IdfObject& other) const;
@@ -30,6 +30,8 @@
 #include "ObjectOrderBase.hpp"
 #include "../math/Permutation.hpp"
 
+#include <algorithm>
+
 
 namespace openstudio {
 
@@ -43,7 +45,10 @@ ObjectOrderBase::ObjectOrderBase(bool directOrder) : m_orderByIddEnum(!directOrd
 
 ObjectOrderBase::ObjectOrderBase(const IddObjectTypeVector& iddOrder) :
     m_orderByIddEnum(false),
-    m_iddOrder(iddOrder) {}
+    m_iddOrder(iddOrder)
+{
+  rebuildIddRanks();
+}
 
 // GETTERS AND SETTERS
 
@@ -54,6 +59,7 @@ bool ObjectOrderBase::orderByIddEnum() const {
 void ObjectOrderBase::setOrderByIddEnum() {
   m_iddOrder = boost::none;
   m_orderByIddEnum = true;
+  rebuildIddRanks();
 }
 
 boost::optional<IddObjectTypeVector> ObjectOrderBase::iddOrder() const {
@@ -63,11 +69,13 @@ boost::optional<IddObjectTypeVector> ObjectOrderBase::iddOrder() const {
 void ObjectOrderBase::setIddOrder(const IddObjectTypeVector& order) {
   m_iddOrder = order;
   m_orderByIddEnum = false;
+  rebuildIddRanks();
 }
 
 bool ObjectOrderBase::push_back(IddObjectType type) {
   if (!m_iddOrder) { return false; }
   m_iddOrder->push_back(type);
+  rebuildIddRanks();
   return true;
 }
 
@@ -75,6 +83,7 @@ bool ObjectOrderBase::insert(IddObjectType type, IddObjectType insertBeforeType)
   if (!m_iddOrder) { return false; }
   auto it = getIterator(insertBeforeType);
   m_iddOrder->insert(it,type);
+  rebuildIddRanks();
   return true;
 }
 
@@ -86,6 +95,7 @@ bool ObjectOrderBase::insert(IddObjectType type, unsigned index) {
     m_iddOrder->insert(it,type);
   }
   else { m_iddOrder->push_back(type); }
+  rebuildIddRanks();
   return true;
 }
 
@@ -124,6 +134,7 @@ bool ObjectOrderBase::swap(IddObjectType type1, IddObjectType type2) {
   if (it1 == it2) { return true; }
   *it1 = type2;
   *it2 = type1;
+  rebuildIddRanks();
   return true;
 }
 
@@ -132,12 +143,14 @@ bool ObjectOrderBase::erase(IddObjectType type) {
   auto it = getIterator(type);
   if (it == m_iddOrder->end()) { return false; }
   m_iddOrder->erase(it);
+  rebuildIddRanks();
   return true;
 }
 
 void ObjectOrderBase::setDirectOrder() {
   m_orderByIddEnum = false;
   m_iddOrder = boost::none;
+  rebuildIddRanks();
 }
 
 // SORTING
@@ -148,7 +161,7 @@ bool ObjectOrderBase::less(IddObjectType left, IddObjectType right) const {
   }
   else {
     OS_ASSERT(m_iddOrder);
-    return (getIterator(left) < getIterator(right));
+    return (sortKey(left) < sortKey(right));
   }
 }
 
@@ -165,8 +178,7 @@ bool ObjectOrderBase::less(boost::optional<IddObjectType> left,
 bool ObjectOrderBase::inOrder(const IddObjectType& type) const {
   if (m_orderByIddEnum) { return true; }
   if (m_iddOrder) {
-    auto it = getIterator(type);
-    if (it != m_iddOrder->end()) { return true; }
+    return (sortKey(type) < m_iddOrder->size());
   }
   return false;
 }
@@ -174,12 +186,19 @@ bool ObjectOrderBase::inOrder(const IddObjectType& type) const {
 OptionalUnsigned ObjectOrderBase::indexInOrder(const IddObjectType& type) const {
   if (m_orderByIddEnum) { return static_cast<unsigned>(type.value()); }
   if (m_iddOrder) {
-    auto it = getIterator(type);
-    return (it - m_iddOrder->begin());
+    return sortKey(type);
   }
   return boost::none;
 }
 
+unsigned ObjectOrderBase::sortKey(IddObjectType type) const {
+  if (m_orderByIddEnum) { return static_cast<unsigned>(type.value()); }
+  OS_ASSERT(m_iddOrder);
+  unsigned index = static_cast<unsigned>(type.value());
+  if (index < m_iddRanks.size()) { return m_iddRanks[index]; }
+  return m_iddOrder->size();
+}
+
 // PRIVATE
 
 // assumes that m_iddOrder == true
@@ -193,4 +212,20 @@ IddObjectTypeVector::const_iterator ObjectOrderBase::getIterator(const IddObject
   return std::find(m_iddOrder->begin(),m_iddOrder->end(),type);
 }
 
+void ObjectOrderBase::rebuildIddRanks() {
+  m_iddRanks.clear();
+  if (!m_iddOrder) { return; }
+  unsigned n = m_iddOrder->size();
+  int maxValue = -1;
+  for (const IddObjectType& type : *m_iddOrder) {
+    maxValue = std::max(maxValue, static_cast<int>(type.value()));
+  }
+  // types not in the order rank after all types in the order
+  m_iddRanks.resize(maxValue + 1, n);
+  // iterate backwards so that the first occurrence of a type wins, as with getIterator
+  for (unsigned i = n; i > 0; --i) {
+    m_iddRanks[static_cast<unsigned>((*m_iddOrder)[i - 1].value())] = i - 1;
+  }
+}
+
 } // openstudio
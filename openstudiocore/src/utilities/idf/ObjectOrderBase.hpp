@@ -125,6 +125,12 @@ class UTILITIES_API ObjectOrderBase {
    *  user-specified order. Otherwise, the return value evaluates to false. */
   OptionalUnsigned indexInOrder(const IddObjectType& type) const;
 
+  /** Returns the sort key of type if ordering by enum or by user-specified IddObjectType order, types
+   *  are ordered by increasing key. Types not in the user-specified order all have key iddOrder()->size().
+   *  Constant time, so may be precomputed for each object to be sorted. Must not be called if
+   *  neither of these orders is in effect. */
+  unsigned sortKey(IddObjectType type) const;
+
  protected:
 
   bool m_orderByIddEnum;
@@ -136,6 +142,11 @@ class UTILITIES_API ObjectOrderBase {
 
  private:
 
+  // rank of each IddObjectType value in m_iddOrder, rebuilt whenever m_iddOrder changes
+  std::vector<unsigned> m_iddRanks;
+
+  void rebuildIddRanks();
+
   REGISTER_LOGGER("utilities.idf.ObjectOrderBase");
 };
 
@@ -184,3 +184,36 @@ TEST_F(IdfFixture,ObjectOrderBase_ManipulateIddObjectTypeOrder) {
   EXPECT_FALSE(success);
   EXPECT_TRUE(orderer.iddOrder()->size() < n);
 }
+
+TEST_F(IdfFixture,ObjectOrderBase_SortKey) {
+  ObjectOrderBase orderer;
+  EXPECT_EQ(static_cast<unsigned>(IddObjectType(IddObjectType::Zone).value()),orderer.sortKey(IddObjectType::Zone));
+
+  IddObjectTypeVector order;
+  order.push_back(openstudio::IddObjectType::Lights);    // 0
+  order.push_back(openstudio::IddObjectType::Zone);      // 1
+  order.push_back(openstudio::IddObjectType::Lights);    // duplicate, first occurrence is used
+  order.push_back(openstudio::IddObjectType::Building);  // 3
+  orderer.setIddOrder(order);
+  EXPECT_EQ(0u,orderer.sortKey(openstudio::IddObjectType::Lights));
+  EXPECT_EQ(1u,orderer.sortKey(openstudio::IddObjectType::Zone));
+  EXPECT_EQ(3u,orderer.sortKey(openstudio::IddObjectType::Building));
+  EXPECT_EQ(4u,orderer.sortKey(openstudio::IddObjectType::RunPeriod));
+
+  // key is kept up to date as the order changes
+  EXPECT_TRUE(orderer.erase(openstudio::IddObjectType::Lights));
+  EXPECT_EQ(0u,orderer.sortKey(openstudio::IddObjectType::Zone));
+  EXPECT_EQ(1u,orderer.sortKey(openstudio::IddObjectType::Lights));
+  EXPECT_TRUE(orderer.push_back(openstudio::IddObjectType::RunPeriod));
+  EXPECT_EQ(3u,orderer.sortKey(openstudio::IddObjectType::RunPeriod));
+  EXPECT_EQ(4u,orderer.sortKey(openstudio::IddObjectType::Branch));
+  EXPECT_TRUE(orderer.swap(openstudio::IddObjectType::Zone,openstudio::IddObjectType::RunPeriod));
+  EXPECT_EQ(0u,orderer.sortKey(openstudio::IddObjectType::RunPeriod));
+  EXPECT_TRUE(orderer.less(openstudio::IddObjectType::RunPeriod,openstudio::IddObjectType::Zone));
+  EXPECT_TRUE(orderer.move(openstudio::IddObjectType::Building,0));
+  EXPECT_EQ(0u,orderer.sortKey(openstudio::IddObjectType::Building));
+
+  for (const IddObjectType& type : *orderer.iddOrder()) {
+    EXPECT_EQ(*orderer.indexInOrder(type),orderer.sortKey(type));
+  }
+}
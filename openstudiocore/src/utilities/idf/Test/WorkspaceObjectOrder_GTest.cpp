@@ -128,3 +128,34 @@ TEST_F(IdfFixture,WorkspaceObjectOrder_ByIddObjectType) {
   }
 
 }
+
+TEST_F(IdfFixture,WorkspaceObjectOrder_SortIsStable) {
+  Workspace workspace(IdfFixture::epIdfFile,openstudio::StrictnessLevel::Draft);
+  WorkspaceObjectVector unsorted = workspace.objects(false);
+
+  // reverse enum order, objects of the same type should keep their relative order
+  WorkspaceObjectOrder wsOrder = workspace.order();
+  IddObjectTypeVector orderByType;
+  IntSet enumValues = IddObjectType::getValues();
+  for (auto it = enumValues.rbegin(); it != enumValues.rend(); ++it) {
+    orderByType.push_back(IddObjectType(*it));
+  }
+  wsOrder.setIddOrder(orderByType);
+  WorkspaceObjectVector sorted = workspace.objects(true);
+  ASSERT_EQ(unsorted.size(),sorted.size());
+
+  for (unsigned i = 1; i < sorted.size(); ++i) {
+    EXPECT_TRUE(sorted[i - 1].iddObject().type() >= sorted[i].iddObject().type());
+    if (sorted[i - 1].iddObject().type() == sorted[i].iddObject().type()) {
+      auto previous = std::find(unsorted.begin(),unsorted.end(),sorted[i - 1]);
+      auto current = std::find(unsorted.begin(),unsorted.end(),sorted[i]);
+      EXPECT_TRUE(previous < current);
+    }
+  }
+
+  HandleVector handles = workspace.handles(true);
+  ASSERT_EQ(sorted.size(),handles.size());
+  for (unsigned i = 0; i < sorted.size(); ++i) {
+    EXPECT_EQ(sorted[i].handle(),handles[i]);
+  }
+}
@@ -0,0 +1,108 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <utilities/idd/IddEnums.hxx>
+#include "IdfFixture.hpp"
+#include "../Workspace.hpp"
+#include "../WorkspaceObject.hpp"
+#include "../WorkspaceObject_Impl.hpp"
+#include "../WorkspaceObjectStore.hpp"
+
+using namespace openstudio;
+using openstudio::detail::WorkspaceObject_Impl;
+using openstudio::detail::WorkspaceObjectStore;
+
+TEST_F(IdfFixture,WorkspaceObjectStore) {
+  Workspace workspace(StrictnessLevel::None,IddFileType::EnergyPlus);
+  std::vector<std::shared_ptr<WorkspaceObject_Impl> > impls;
+  for (unsigned i = 0; i < 100; ++i) {
+    OptionalWorkspaceObject object = workspace.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(object);
+    impls.push_back(object->getImpl<WorkspaceObject_Impl>());
+  }
+
+  WorkspaceObjectStore store;
+  EXPECT_TRUE(store.empty());
+  for (const std::shared_ptr<WorkspaceObject_Impl>& impl : impls) {
+    EXPECT_TRUE(store.insert(impl->handle(),impl));
+  }
+  EXPECT_FALSE(store.insert(impls[0]->handle(),impls[0]));
+  EXPECT_EQ(impls.size(),store.size());
+
+  // iteration is in insertion order
+  unsigned i = 0;
+  for (const WorkspaceObjectStore::value_type& p : store) {
+    EXPECT_EQ(impls[i]->handle(),p.first);
+    EXPECT_EQ(impls[i],p.second);
+    ++i;
+  }
+  EXPECT_EQ(impls.size(),i);
+
+  // keep every fourth object, enough holes to compact the storage
+  for (unsigned j = 0; j < impls.size(); ++j) {
+    if (j % 4 != 1) {
+      EXPECT_TRUE(store.erase(impls[j]->handle()));
+    }
+  }
+  EXPECT_FALSE(store.erase(impls[0]->handle()));
+  EXPECT_EQ(impls.size() / 4,store.size());
+  EXPECT_FALSE(store.find(impls[0]->handle()));
+  EXPECT_FALSE(store.contains(impls[0]->handle()));
+  for (unsigned j = 1; j < impls.size(); j += 4) {
+    EXPECT_EQ(impls[j],store.find(impls[j]->handle()));
+  }
+
+  i = 1;
+  for (const WorkspaceObjectStore::value_type& p : store) {
+    EXPECT_EQ(impls[i],p.second);
+    i += 4;
+  }
+
+  // objects added back go to the end
+  EXPECT_TRUE(store.insert(impls[0]->handle(),impls[0]));
+  EXPECT_EQ(impls[0],store.find(impls[0]->handle()));
+  WorkspaceObjectStore::const_iterator last;
+  for (auto it = store.begin(); it != store.end(); ++it) {
+    last = it;
+  }
+  EXPECT_EQ(impls[0],last->second);
+
+  // assign replaces in place
+  store.assign(impls[1]->handle(),impls[2]);
+  EXPECT_EQ(impls[2],store.begin()->second);
+  EXPECT_EQ(impls.size() / 4 + 1,store.size());
+
+  WorkspaceObjectStore other;
+  other.swap(store);
+  EXPECT_TRUE(store.empty());
+  EXPECT_EQ(impls.size() / 4 + 1,other.size());
+  other.clear();
+  EXPECT_TRUE(other.begin() == other.end());
+}
@@ -48,6 +48,7 @@
 #include <utilities/idd/Zone_FieldEnums.hxx>
 #include <utilities/idd/Lights_FieldEnums.hxx>
 #include <utilities/idd/Output_Meter_FieldEnums.hxx>
+#include <utilities/idd/Output_Variable_FieldEnums.hxx>
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
 #include <utilities/idd/Wall_Exterior_FieldEnums.hxx>
 #include <utilities/idd/Wall_Adiabatic_FieldEnums.hxx>
@@ -1106,6 +1107,51 @@ TEST_F(IdfFixture,Workspace_InsertDifferentObjectSameName) {
               (secondConstructionAdded[0].name().get() != construction1.name().get()));
 }
 
+TEST_F(IdfFixture,Workspace_InsertUnnamedObjects) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  auto outputVariable = [](const std::string& variableName, const std::string& frequency) {
+    IdfObject result(IddObjectType::Output_Variable);
+    EXPECT_TRUE(result.setString(Output_VariableFields::VariableName, variableName));
+    EXPECT_TRUE(result.setString(Output_VariableFields::ReportingFrequency, frequency));
+    return result;
+  };
+
+  OptionalWorkspaceObject temperature = ws.insertObject(outputVariable("Zone Mean Air Temperature", "Hourly"));
+  ASSERT_TRUE(temperature);
+  EXPECT_FALSE(temperature->iddObject().hasNameField());
+  OptionalWorkspaceObject humidity = ws.insertObject(outputVariable("Zone Air Relative Humidity", "Hourly"));
+  ASSERT_TRUE(humidity);
+  EXPECT_EQ(2u, ws.numObjects());
+  EXPECT_EQ(temperature->dataFieldsHash(), outputVariable("ZONE MEAN AIR TEMPERATURE", "hourly").dataFieldsHash());
+
+  // equivalent objects are found regardless of case
+  OptionalWorkspaceObject inserted = ws.insertObject(outputVariable("ZONE MEAN AIR TEMPERATURE", "hourly"));
+  ASSERT_TRUE(inserted);
+  EXPECT_EQ(temperature->handle(), inserted->handle());
+  EXPECT_EQ(2u, ws.numObjects());
+
+  // changes to objects already in the workspace are picked up
+  EXPECT_TRUE(humidity->setString(Output_VariableFields::ReportingFrequency, "Daily"));
+  inserted = ws.insertObject(outputVariable("Zone Air Relative Humidity", "Daily"));
+  ASSERT_TRUE(inserted);
+  EXPECT_EQ(humidity->handle(), inserted->handle());
+  EXPECT_EQ(2u, ws.numObjects());
+
+  inserted = ws.insertObject(outputVariable("Zone Air Relative Humidity", "Hourly"));
+  ASSERT_TRUE(inserted);
+  EXPECT_NE(humidity->handle(), inserted->handle());
+  EXPECT_EQ(3u, ws.numObjects());
+
+  // as are removals
+  Handle humidityHandle = humidity->handle();
+  humidity->remove();
+  inserted = ws.insertObject(outputVariable("Zone Air Relative Humidity", "Daily"));
+  ASSERT_TRUE(inserted);
+  EXPECT_NE(humidityHandle, inserted->handle());
+  EXPECT_EQ(3u, ws.numObjects());
+}
+
 TEST_F(IdfFixture,Workspace_DefaultNames) {
   Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
 
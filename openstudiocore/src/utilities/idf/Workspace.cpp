@@ -42,6 +42,7 @@
 #include "../core/Assert.hpp"
 #include "../core/URLHelpers.hpp"
 #include "../core/StringHelpers.hpp"
+#include "../core/Trace.hpp"
 
 #include <boost/lexical_cast.hpp>
 
@@ -62,7 +63,6 @@ namespace detail {
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
-    m_workspaceObjectMap.reserve(1<<15);
     m_idfReferencesMap.reserve(1<<15);
   }
 
@@ -75,7 +75,6 @@ namespace detail {
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
-    m_workspaceObjectMap.reserve(1<<15);
     m_idfReferencesMap.reserve(1<<15);
   }
 
@@ -96,7 +95,6 @@ namespace detail {
     if (directOrderVector) {
       m_workspaceObjectOrder.setDirectOrder(*directOrderVector);
     }
-    m_workspaceObjectMap.reserve(1<<15);
     m_idfReferencesMap.reserve(1<<15);
   }
 
@@ -125,7 +123,6 @@ namespace detail {
       }
       m_workspaceObjectOrder.setDirectOrder(subsetOrder);
     }
-    m_workspaceObjectMap.reserve(1<<15);
     m_idfReferencesMap.reserve(1<<15);
   }
 
@@ -171,9 +168,7 @@ namespace detail {
     m_fastNaming = otherImpl->m_fastNaming;
     otherImpl->m_fastNaming = tfn;
 
-    WorkspaceObjectMap twop = m_workspaceObjectMap;
-    m_workspaceObjectMap = otherImpl->m_workspaceObjectMap;
-    otherImpl->m_workspaceObjectMap = twop;
+    m_workspaceObjectStore.swap(otherImpl->m_workspaceObjectStore);
 
     WorkspaceObjectOrder twoo = m_workspaceObjectOrder;
     m_workspaceObjectOrder = otherImpl->m_workspaceObjectOrder;
@@ -186,6 +181,10 @@ namespace detail {
     IdfReferencesMap tirm = m_idfReferencesMap;
     m_idfReferencesMap = otherImpl->m_idfReferencesMap;
     otherImpl->m_idfReferencesMap = tirm;
+
+    // rebuilt on demand
+    m_equivalenceIndexMap.clear();
+    otherImpl->m_equivalenceIndexMap.clear();
   }
 
   // GETTERS
@@ -227,9 +226,8 @@ namespace detail {
   }
 
   boost::optional<WorkspaceObject> Workspace_Impl::getObject(const Handle& handle) const {
-    auto womIt = m_workspaceObjectMap.find(handle);
-    if (womIt != m_workspaceObjectMap.end()) {
-      return WorkspaceObject(womIt->second);
+    if (std::shared_ptr<WorkspaceObject_Impl> objectImplPtr = m_workspaceObjectStore.find(handle)) {
+      return WorkspaceObject(objectImplPtr);
     }
     return boost::none;
   }
@@ -260,10 +258,10 @@ namespace detail {
     }
 
     WorkspaceObjectVector result;
-    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
-      WorkspaceObject obj = WorkspaceObject(p.second);
-      if (obj.iddObject() != versionIdd.get()) {
-        result.push_back(obj);
+    result.reserve(m_workspaceObjectStore.size());
+    for (const WorkspaceObjectStore::value_type& p : m_workspaceObjectStore) {
+      if (p.second->iddObject() != versionIdd.get()) {
+        result.push_back(WorkspaceObject(p.second));
       }
     }
     return result;
@@ -288,7 +286,8 @@ namespace detail {
     HandleVector result;
     OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
     if (!versionIdd) { return result; }
-    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+    result.reserve(m_workspaceObjectStore.size());
+    for (const WorkspaceObjectStore::value_type& p : m_workspaceObjectStore) {
       if (p.second->iddObject() != versionIdd.get()) {
         result.push_back(p.first);
       }
@@ -298,7 +297,7 @@ namespace detail {
 
   std::vector<WorkspaceObject> Workspace_Impl::objectsWithURLFields() const {
     WorkspaceObjectVector result;
-    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+    for (const WorkspaceObjectStore::value_type& p : m_workspaceObjectStore) {
       if( p.second->iddObject().hasURL()) {
          result.push_back(WorkspaceObject(p.second));
       }
@@ -347,7 +346,7 @@ namespace detail {
   {
     WorkspaceObjectVector result;
     if (exactMatch) {
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      for (const WorkspaceObjectStore::value_type& p : m_workspaceObjectStore) {
         if (OptionalString candidate = p.second->name()) {
           if (istringEqual(*candidate,name)) {
             result.push_back(WorkspaceObject(p.second));
@@ -357,7 +356,7 @@ namespace detail {
     }
     else {
       std::string baseName = getBaseName(name);
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      for (const WorkspaceObjectStore::value_type& p : m_workspaceObjectStore) {
         if (OptionalString candidate = p.second->name()) {
           if (baseNamesMatch(baseName, *candidate)) {
             result.push_back(WorkspaceObject(p.second));
@@ -509,6 +508,8 @@ namespace detail {
       bool expectToLosePointers,
       bool checkNames)
   {
+    OS_TRACE_SCOPE("idf", "Workspace_Impl::addObjects");
+
     HandleVector newHandles;
     WorkspaceObjectVector newObjects;
 
@@ -520,20 +521,25 @@ namespace detail {
 
     // step 1: add to maps
     bool ok = true;
-    for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
-      ok = ok && nominallyAddObject(ptr); // will fail if ptr already in map
-      if (ok) {
-        newHandles.push_back(ptr->handle());
-        LOG(Trace,"Adding object with handle " << newHandles.back());
-      }
-      else {
-        LOG(Error,"Tried to add two objects with the same handle: " << ptr->handle());
+    {
+      OS_TRACE_SCOPE("idf", "nominallyAddObjects");
+      m_workspaceObjectStore.reserveAdditional(objectImplPtrs.size());
+      for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+        ok = ok && nominallyAddObject(ptr); // will fail if ptr already in map
+        if (ok) {
+          newHandles.push_back(ptr->handle());
+          LOG(Trace,"Adding object with handle " << newHandles.back());
+        }
+        else {
+          LOG(Error,"Tried to add two objects with the same handle: " << ptr->handle());
+        }
+        this->progressValue.nano_emit(++i);
       }
-      this->progressValue.nano_emit(++i);
     }
 
     // step 2: replace string pointers
     if (ok){
+      OS_TRACE_SCOPE("idf", "initializeOnAdd");
       for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
         ptr->initializeOnAdd(expectToLosePointers);
         this->progressValue.nano_emit(++i);
@@ -556,6 +562,7 @@ namespace detail {
 
     // step 5: check validity
     if (ok && driverMethod) {
+      OS_TRACE_SCOPE("idf", "checkValidity");
       StrictnessLevel level = strictnessLevel();
       if ((objectImplPtrs.size() == numAllObjects()) || (level == StrictnessLevel::Final)) {
         // check whole workspace
@@ -586,6 +593,7 @@ namespace detail {
 
     // step 7: emit signals for successful completion
     if (driverMethod) {
+      OS_TRACE_SCOPE("idf", "registerAdditionOfObjects");
       for (const WorkspaceObject& newObject : newObjects) {
         registerAdditionOfObject(newObject);
       }
@@ -615,9 +623,10 @@ namespace detail {
 
     // step 1: add objects to maps
     HandleVector newHandles;
+    m_workspaceObjectStore.reserveAdditional(objectImplPtrs.size());
     for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
       newHandles.push_back(ptr->handle());
-      m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(),ptr));
+      m_workspaceObjectStore.insert(newHandles.back(),ptr);
       insertIntoIddObjectTypeMap(ptr);
       insertIntoIdfReferencesMap(ptr);
       this->progressValue.nano_emit(++i);
@@ -761,6 +770,7 @@ namespace detail {
     bool checkedForNameConflicts(false);
     if (numObjects() > 0) {
       // handle potential name conflicts
+      OS_TRACE_SCOPE("idf", "resolvePotentialNameConflicts");
       Workspace working = this->cloneSubset(HandleVector()); // empty clone
       working.order().setDirectOrder(HandleVector()); // maintain order in vector
       // call method like this one, but simpler, which expects to lose outward pointers
@@ -789,9 +799,12 @@ namespace detail {
 
     // no name conflicts---directly create and add objects
     OS_ASSERT(newObjects.empty());
-    auto it(idfObjects.begin()), itEnd(idfObjects.end());
-    for (; it != itEnd; ++it) {
-      newObjects.push_back(this->createObject(*it,keepHandles));
+    {
+      OS_TRACE_SCOPE("idf", "createObjects");
+      auto it(idfObjects.begin()), itEnd(idfObjects.end());
+      for (; it != itEnd; ++it) {
+        newObjects.push_back(this->createObject(*it,keepHandles));
+      }
     }
     result = addObjects(newObjects,checkNames);
     if (!checkedForNameConflicts) {
@@ -1655,7 +1668,7 @@ namespace detail {
   }
 
   unsigned Workspace_Impl::numAllObjects() const {
-    return m_workspaceObjectMap.size();
+    return m_workspaceObjectStore.size();
   }
 
   unsigned Workspace_Impl::numObjectsOfType(IddObjectType type) const {
@@ -1669,8 +1682,7 @@ namespace detail {
   }
 
   bool Workspace_Impl::isMember(const Handle& handle) const {
-    auto womIt = m_workspaceObjectMap.find(handle);
-    return (womIt != m_workspaceObjectMap.end());
+    return m_workspaceObjectStore.contains(handle);
   }
 
   bool Workspace_Impl::canBeTarget(const Handle& handle,
@@ -1749,7 +1761,7 @@ namespace detail {
     map<string,list <std::shared_ptr<WorkspaceObject_Impl> > > objectsRepeatNames;
 
     // by-object items
-    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap)
+    for (const WorkspaceObjectStore::value_type& p : m_workspaceObjectStore)
     {
 
       //find all objects with the same name
@@ -2013,7 +2025,14 @@ namespace detail {
       if (owo) { candidates.push_back(*owo); }
     }
     else {
-      candidates = getObjectsByType(other.iddObject().type());
+      // only objects whose data fields hash the same can be equivalent
+      const EquivalenceIndex& index = equivalenceIndex(other.iddObject().type());
+      auto range = index.handlesByHash.equal_range(other.dataFieldsHash());
+      for (auto it = range.first; it != range.second; ++it) {
+        std::shared_ptr<WorkspaceObject_Impl> candidate = m_workspaceObjectStore.find(it->second);
+        OS_ASSERT(candidate);
+        candidates.push_back(candidate);
+      }
     }
 
     // test for equivalency
@@ -2039,6 +2058,75 @@ namespace detail {
     return result;
   }
 
+  const Workspace_Impl::EquivalenceIndex& Workspace_Impl::equivalenceIndex(IddObjectType type) const {
+    auto it = m_equivalenceIndexMap.find(type);
+    if (it == m_equivalenceIndexMap.end()) {
+      EquivalenceIndex& index = m_equivalenceIndexMap[type];
+      auto iotmLoc = m_iddObjectTypeMap.find(type);
+      if (iotmLoc != m_iddObjectTypeMap.end()) {
+        index.hashesByHandle.reserve(iotmLoc->second.size());
+        for (const auto& objectPair : iotmLoc->second) {
+          std::size_t hash = objectPair.second->dataFieldsHash();
+          index.handlesByHash.insert(std::make_pair(hash, objectPair.first));
+          index.hashesByHandle.insert(std::make_pair(objectPair.first, hash));
+        }
+      }
+      return index;
+    }
+
+    // rehash objects added or changed since last use
+    EquivalenceIndex& index = it->second;
+    for (const Handle& handle : index.dirty) {
+      auto hashIt = index.hashesByHandle.find(handle);
+      if (hashIt != index.hashesByHandle.end()) {
+        auto range = index.handlesByHash.equal_range(hashIt->second);
+        for (auto entryIt = range.first; entryIt != range.second; ++entryIt) {
+          if (entryIt->second == handle) {
+            index.handlesByHash.erase(entryIt);
+            break;
+          }
+        }
+        index.hashesByHandle.erase(hashIt);
+      }
+
+      if (std::shared_ptr<WorkspaceObject_Impl> objectImplPtr = m_workspaceObjectStore.find(handle)) {
+        std::size_t hash = objectImplPtr->dataFieldsHash();
+        index.handlesByHash.insert(std::make_pair(hash, handle));
+        index.hashesByHandle.insert(std::make_pair(handle, hash));
+      }
+    }
+    index.dirty.clear();
+
+    return index;
+  }
+
+  void Workspace_Impl::markEquivalenceIndexDirty(const WorkspaceObject_Impl& object) const {
+    auto it = m_equivalenceIndexMap.find(object.iddObject().type());
+    if (it != m_equivalenceIndexMap.end()) {
+      it->second.dirty.insert(object.handle());
+    }
+  }
+
+  void Workspace_Impl::removeFromEquivalenceIndex(IddObjectType type, const Handle& handle) {
+    auto it = m_equivalenceIndexMap.find(type);
+    if (it == m_equivalenceIndexMap.end()) {
+      return;
+    }
+    EquivalenceIndex& index = it->second;
+    index.dirty.erase(handle);
+    auto hashIt = index.hashesByHandle.find(handle);
+    if (hashIt != index.hashesByHandle.end()) {
+      auto range = index.handlesByHash.equal_range(hashIt->second);
+      for (auto entryIt = range.first; entryIt != range.second; ++entryIt) {
+        if (entryIt->second == handle) {
+          index.handlesByHash.erase(entryIt);
+          break;
+        }
+      }
+      index.hashesByHandle.erase(hashIt);
+    }
+  }
+
   // SETTER HELPERS
 
   bool Workspace_Impl::setIddFile(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper) {
@@ -2059,10 +2147,8 @@ namespace detail {
     Handle h = ptr->handle();
     if (h.isNull()) { return false; }
 
-    // WorkspaceObjectMap
-    std::pair<WorkspaceObjectMap::iterator,bool> insertOK;
-    insertOK = m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(h,ptr));
-    if (!insertOK.second) { return false; }
+    // WorkspaceObjectStore
+    if (!m_workspaceObjectStore.insert(h,ptr)) { return false; }
 
     // WorkspaceObjectOrder--push_back if ordered directly
     if (m_workspaceObjectOrder.isDirectOrder()) {
@@ -2081,13 +2167,14 @@ namespace detail {
   void Workspace_Impl::insertIntoObjectMap(
       const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
   {
-    m_workspaceObjectMap[handle] = objectImplPtr;
+    m_workspaceObjectStore.assign(handle,objectImplPtr);
   }
 
   void Workspace_Impl::insertIntoIddObjectTypeMap(
       const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
   {
     m_iddObjectTypeMap[objectImplPtr->iddObject().type()].insert(std::make_pair(objectImplPtr->handle(),objectImplPtr));
+    markEquivalenceIndexDirty(*objectImplPtr);
   }
 
   void Workspace_Impl::insertIntoIdfReferencesMap(
@@ -2302,15 +2389,15 @@ namespace detail {
     iotmLoc->second.erase(loc);
     // erase entry if set is empty
     if (iotmLoc->second.empty()) { m_iddObjectTypeMap.erase(iotmLoc); }
+    removeFromEquivalenceIndex(objectImplPtr->iddObject().type(), handle);
 
     // WorkspaceObjectOrder
     if (m_workspaceObjectOrder.isDirectOrder()) {
       m_workspaceObjectOrder.erase(handle);
     }
 
-    // WorkspaceObjectMap
-    auto womIt = m_workspaceObjectMap.find(handle);
-    m_workspaceObjectMap.erase(womIt);
+    // WorkspaceObjectStore
+    m_workspaceObjectStore.erase(handle);
 
     return sources;
   }
@@ -2357,8 +2444,8 @@ namespace detail {
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
-    // WorkspaceObjectMap
-    m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(savedObject.handle,savedObject.objectImplPtr));
+    // WorkspaceObjectStore
+    m_workspaceObjectStore.insert(savedObject.handle,savedObject.objectImplPtr);
 
     // WorkspaceObjectOrder
     if (savedObject.orderIndex) {
@@ -2711,7 +2798,8 @@ namespace detail {
 
   std::vector<WorkspaceObject> Workspace_Impl::allObjects() const {
     WorkspaceObjectVector result;
-    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+    result.reserve(m_workspaceObjectStore.size());
+    for (const WorkspaceObjectStore::value_type& p : m_workspaceObjectStore) {
       result.push_back(WorkspaceObject(p.second));
     }
     return result;
@@ -908,6 +908,10 @@ namespace detail {
       return;
     }
 
+    if (m_workspace) {
+      m_workspace->markEquivalenceIndexDirty(*this);
+    }
+
     bool nameChange = false;
     bool dataChange = false;
 
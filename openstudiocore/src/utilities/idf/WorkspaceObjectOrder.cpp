@@ -33,10 +33,41 @@
 
 #include "../math/Permutation.hpp"
 
+#include <algorithm>
+#include <map>
+
 
 namespace openstudio {
 
 namespace detail {
+
+  namespace {
+
+    // stable counting sort of items by precomputed keys in [0, numKeys)
+    template<class T>
+    std::vector<T> sortByKeys(const std::vector<T>& items, const std::vector<unsigned>& keys, unsigned numKeys)
+    {
+      std::vector<unsigned> offsets(numKeys + 1, 0);
+      for (unsigned key : keys) {
+        ++offsets[key + 1];
+      }
+      for (unsigned i = 1; i <= numKeys; ++i) {
+        offsets[i] += offsets[i - 1];
+      }
+      std::vector<unsigned> permutation(items.size());
+      for (unsigned i = 0, n = items.size(); i < n; ++i) {
+        permutation[offsets[keys[i]]++] = i;
+      }
+      std::vector<T> result;
+      result.reserve(items.size());
+      for (unsigned i : permutation) {
+        result.push_back(items[i]);
+      }
+      return result;
+    }
+
+  }
+
   // CONSTRUCTORS
 
   WorkspaceObjectOrder_Impl::WorkspaceObjectOrder_Impl(const ObjectGetter& objectGetter)
@@ -180,18 +211,63 @@ namespace detail {
     }
   }
 
+  // Sorting computes the key of each element once, and then buckets by key. This gives the same order as sorting
+  // with less, with elements of equal key kept in their original order.
   std::vector<Handle> WorkspaceObjectOrder_Impl::sort(const std::vector<Handle>& handles) const {
-    HandleVector result(handles);
-    std::sort(result.begin(), result.end(), std::bind(&WorkspaceObjectOrder_Impl::less_Handle, this, std::placeholders::_1, std::placeholders::_2));
-    return result;
+    std::vector<unsigned> keys;
+    keys.reserve(handles.size());
+    unsigned numKeys = 0;
+    if (m_directOrder) {
+      std::map<Handle, unsigned> positions = directOrderPositions();
+      numKeys = m_directOrder->size() + 1;
+      for (const Handle& handle : handles) {
+        auto it = positions.find(handle);
+        keys.push_back((it == positions.end()) ? m_directOrder->size() : it->second);
+      }
+    }
+    else {
+      // handles without objects go last
+      std::vector<boost::optional<unsigned> > typeKeys;
+      typeKeys.reserve(handles.size());
+      for (const Handle& handle : handles) {
+        boost::optional<IddObjectType> type = getIddObjectType(handle);
+        if (type) {
+          typeKeys.push_back(sortKey(*type));
+          numKeys = std::max(numKeys, *typeKeys.back() + 1);
+        }
+        else {
+          typeKeys.push_back(boost::none);
+        }
+      }
+      for (const boost::optional<unsigned>& typeKey : typeKeys) {
+        keys.push_back(typeKey ? *typeKey : numKeys);
+      }
+      ++numKeys;
+    }
+    return sortByKeys(handles, keys, numKeys);
   }
 
   std::vector<WorkspaceObject> WorkspaceObjectOrder_Impl::sort(
       const std::vector<WorkspaceObject>& objects) const
   {
-    WorkspaceObjectVector result(objects);
-    std::sort(result.begin(), result.end(), std::bind(&WorkspaceObjectOrder_Impl::less_WorkspaceObject, this, std::placeholders::_1, std::placeholders::_2));
-    return result;
+    std::vector<unsigned> keys;
+    keys.reserve(objects.size());
+    unsigned numKeys = 0;
+    if (m_directOrder) {
+      std::map<Handle, unsigned> positions = directOrderPositions();
+      numKeys = m_directOrder->size() + 1;
+      for (const WorkspaceObject& object : objects) {
+        auto it = positions.find(object.handle());
+        keys.push_back((it == positions.end()) ? m_directOrder->size() : it->second);
+      }
+    }
+    else {
+      for (const WorkspaceObject& object : objects) {
+        keys.push_back(sortKey(object.iddObject().type()));
+        numKeys = std::max(numKeys, keys.back() + 1);
+      }
+    }
+    return sortByKeys(objects, keys, numKeys);
   }
 
   /// returns empty vector if not all handles can be converted to objects
@@ -299,6 +375,16 @@ namespace detail {
     return std::find(m_directOrder->begin(),m_directOrder->end(),object.handle());
   }
 
+  std::map<Handle, unsigned> WorkspaceObjectOrder_Impl::directOrderPositions() const {
+    OS_ASSERT(m_directOrder);
+    std::map<Handle, unsigned> result;
+    for (unsigned i = 0, n = m_directOrder->size(); i < n; ++i) {
+      // first occurrence wins, as with getIterator
+      result.insert(std::make_pair((*m_directOrder)[i], i));
+    }
+    return result;
+  }
+
   boost::optional<IddObjectType> WorkspaceObjectOrder_Impl::getIddObjectType(
       const Handle& handle) const
   {
@@ -140,6 +140,9 @@ namespace detail {
 
     boost::optional<IddObjectType> getIddObjectType(const Handle& handle) const;
 
+    // position of each handle in the direct order, for sorting
+    std::map<Handle, unsigned> directOrderPositions() const;
+
     // returns empty vector if can't convert all.
     WorkspaceObjectVector getObjects(const std::vector<Handle>& handles) const;
 
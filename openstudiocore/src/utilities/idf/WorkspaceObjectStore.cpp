@@ -0,0 +1,127 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "WorkspaceObjectStore.hpp"
+#include "WorkspaceObject_Impl.hpp"
+
+#include "../core/Assert.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+namespace detail {
+
+  WorkspaceObjectStore::WorkspaceObjectStore()
+  {}
+
+  void WorkspaceObjectStore::reserve(std::size_t n) {
+    m_objects.reserve(n);
+    m_positions.reserve(n);
+  }
+
+  void WorkspaceObjectStore::reserveAdditional(std::size_t n) {
+    std::size_t needed = m_objects.size() + n;
+    if (needed > m_objects.capacity()) {
+      reserve(std::max(needed, 2 * m_objects.capacity()));
+    }
+  }
+
+  std::shared_ptr<WorkspaceObject_Impl> WorkspaceObjectStore::find(const Handle& handle) const {
+    auto it = m_positions.find(handle);
+    if (it != m_positions.end()) {
+      return m_objects[it->second].second;
+    }
+    return std::shared_ptr<WorkspaceObject_Impl>();
+  }
+
+  bool WorkspaceObjectStore::contains(const Handle& handle) const {
+    return (m_positions.find(handle) != m_positions.end());
+  }
+
+  bool WorkspaceObjectStore::insert(const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& object) {
+    OS_ASSERT(object);
+    std::pair<std::unordered_map<Handle, unsigned, boost::hash<boost::uuids::uuid> >::iterator, bool> inserted =
+      m_positions.insert(std::make_pair(handle, static_cast<unsigned>(m_objects.size())));
+    if (!inserted.second) {
+      return false;
+    }
+    m_objects.push_back(value_type(handle, object));
+    return true;
+  }
+
+  void WorkspaceObjectStore::assign(const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& object) {
+    OS_ASSERT(object);
+    auto it = m_positions.find(handle);
+    if (it != m_positions.end()) {
+      m_objects[it->second].second = object;
+    }
+    else {
+      insert(handle, object);
+    }
+  }
+
+  bool WorkspaceObjectStore::erase(const Handle& handle) {
+    auto it = m_positions.find(handle);
+    if (it == m_positions.end()) {
+      return false;
+    }
+    m_objects[it->second].second.reset();
+    m_positions.erase(it);
+    if (m_objects.size() > 2 * m_positions.size() + 16) {
+      compact();
+    }
+    return true;
+  }
+
+  void WorkspaceObjectStore::clear() {
+    m_objects.clear();
+    m_positions.clear();
+  }
+
+  void WorkspaceObjectStore::swap(WorkspaceObjectStore& other) {
+    m_objects.swap(other.m_objects);
+    m_positions.swap(other.m_positions);
+  }
+
+  void WorkspaceObjectStore::compact() {
+    unsigned n = 0;
+    for (value_type& entry : m_objects) {
+      if (entry.second) {
+        m_positions[entry.first] = n;
+        if (&m_objects[n] != &entry) {
+          m_objects[n] = std::move(entry);
+        }
+        ++n;
+      }
+    }
+    m_objects.resize(n);
+  }
+
+} // detail
+} // openstudio
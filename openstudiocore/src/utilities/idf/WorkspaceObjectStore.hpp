@@ -0,0 +1,150 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_WORKSPACEOBJECTSTORE_HPP
+#define UTILITIES_IDF_WORKSPACEOBJECTSTORE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "Handle.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  class WorkspaceObject_Impl;
+
+  /** Storage for the objects of a Workspace. Objects are kept in insertion order in a dense vector,
+   *  with a table from handle to position, so that full scans walk contiguous memory instead of the
+   *  nodes of a hash map. Erasing an object leaves a hole that iteration skips, holes are compacted
+   *  once they outnumber the objects, so positions are stable between compactions. */
+  class UTILITIES_API WorkspaceObjectStore {
+   public:
+    typedef std::pair<Handle, std::shared_ptr<WorkspaceObject_Impl> > value_type;
+
+    /** Forward iterator over the objects in insertion order. */
+    class const_iterator {
+     public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef WorkspaceObjectStore::value_type value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const value_type* pointer;
+      typedef const value_type& reference;
+
+      const_iterator() : m_it(), m_end() {}
+
+      reference operator*() const { return *m_it; }
+      pointer operator->() const { return &(*m_it); }
+
+      const_iterator& operator++() {
+        ++m_it;
+        skipHoles();
+        return *this;
+      }
+
+      const_iterator operator++(int) {
+        const_iterator result(*this);
+        ++(*this);
+        return result;
+      }
+
+      bool operator==(const const_iterator& other) const { return m_it == other.m_it; }
+      bool operator!=(const const_iterator& other) const { return m_it != other.m_it; }
+
+     private:
+      friend class WorkspaceObjectStore;
+
+      const_iterator(std::vector<value_type>::const_iterator it, std::vector<value_type>::const_iterator end)
+        : m_it(it), m_end(end)
+      {
+        skipHoles();
+      }
+
+      void skipHoles() {
+        while ((m_it != m_end) && !m_it->second) { ++m_it; }
+      }
+
+      std::vector<value_type>::const_iterator m_it;
+      std::vector<value_type>::const_iterator m_end;
+    };
+
+    WorkspaceObjectStore();
+
+    /** Reserves space for n objects. */
+    void reserve(std::size_t n);
+
+    /** Reserves space for n objects on top of the current ones. Capacity grows at least
+     *  geometrically, so that many small additions stay amortized constant time. */
+    void reserveAdditional(std::size_t n);
+
+    /** Returns the number of objects. */
+    std::size_t size() const { return m_positions.size(); }
+
+    bool empty() const { return m_positions.empty(); }
+
+    /** Returns the object with handle, or a null pointer if there is no such object. */
+    std::shared_ptr<WorkspaceObject_Impl> find(const Handle& handle) const;
+
+    bool contains(const Handle& handle) const;
+
+    /** Appends the object, returns false if an object with handle is already stored. */
+    bool insert(const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    /** Replaces the object with handle in place, or appends it if there is no such object. */
+    void assign(const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    /** Removes the object with handle, returns false if there is no such object. */
+    bool erase(const Handle& handle);
+
+    void clear();
+
+    void swap(WorkspaceObjectStore& other);
+
+    const_iterator begin() const { return const_iterator(m_objects.begin(), m_objects.end()); }
+    const_iterator end() const { return const_iterator(m_objects.end(), m_objects.end()); }
+
+   private:
+    // remove holes left by erase, updating positions
+    void compact();
+
+    std::vector<value_type> m_objects;
+    std::unordered_map<Handle, unsigned, boost::hash<boost::uuids::uuid> > m_positions;
+  };
+
+} // detail
+} // openstudio
+
+#endif // UTILITIES_IDF_WORKSPACEOBJECTSTORE_HPP
@@ -34,6 +34,7 @@
 
 #include <utilities/idf/WorkspaceObject_Impl.hpp>
 #include <utilities/idf/WorkspaceObjectOrder.hpp>
+#include <utilities/idf/WorkspaceObjectStore.hpp>
 #include <utilities/idf/ValidityEnums.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
@@ -50,6 +51,7 @@
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio {
 
@@ -442,6 +444,10 @@ namespace detail {
      *  use this method, then IdfFile.print(ostream). */
     IdfFile toIdfFile();
 
+    /** Marks object for rehashing in the equivalent object index. Called by WorkspaceObject_Impl
+     *  when its data changes. */
+    void markEquivalenceIndexDirty(const WorkspaceObject_Impl& object) const;
+
     /// Locates and updates urls in the workspace
     std::vector<std::pair<QUrl, openstudio::path> > locateUrls(const std::vector<URLSearchPath> &t_paths, bool t_create_relative_paths,
      const openstudio::path &t_infile, const openstudio::path &t_locationForRemoteUrls = openstudio::path());
@@ -514,7 +520,9 @@ namespace detail {
     bool m_fastNaming;
 
     typedef std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, boost::hash<boost::uuids::uuid> > WorkspaceObjectMap;
-    WorkspaceObjectMap m_workspaceObjectMap;
+
+    // all objects in the collection, in insertion order
+    WorkspaceObjectStore m_workspaceObjectStore;
 
     // object for ordering objects in the collection.
     WorkspaceObjectOrder m_workspaceObjectOrder;
@@ -527,6 +535,17 @@ namespace detail {
     typedef std::unordered_map<std::string, WorkspaceObjectMap> IdfReferencesMap; // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // dataFieldsHash index used to find equivalent objects that have no name, built on first use
+    // for each IddObjectType and then kept up to date incrementally
+    struct EquivalenceIndex {
+      typedef std::unordered_multimap<std::size_t, Handle> HandlesByHash;
+      HandlesByHash handlesByHash;
+      std::unordered_map<Handle, std::size_t, boost::hash<boost::uuids::uuid> > hashesByHandle;
+      std::unordered_set<Handle, boost::hash<boost::uuids::uuid> > dirty;
+    };
+    typedef std::map<IddObjectType, EquivalenceIndex> EquivalenceIndexMap;
+    mutable EquivalenceIndexMap m_equivalenceIndexMap;
+
     // data object for undos
     struct SavedWorkspaceObject {
       Handle                   handle;
@@ -553,6 +572,11 @@ namespace detail {
 
     boost::optional<WorkspaceObject> getEquivalentObject(const IdfObject& other) const;
 
+    // Returns the up to date equivalence index for type, building it if necessary.
+    const EquivalenceIndex& equivalenceIndex(IddObjectType type) const;
+
+    void removeFromEquivalenceIndex(IddObjectType type, const Handle& handle);
+
     // SETTERS
 
     // Replace m_iddFactoryWrapper if workspace remains valid.
@@ -1694,6 +1694,15 @@ void SqlFile::illuminanceMap(const int& hourlyReportIndex, std::vector<double>&
 
 
 
+boost::optional<double> SqlFile::componentSizingValue(const std::string& componentName, const std::string& description) const
+{
+  if (m_impl)
+  {
+    return m_impl->componentSizingValue(componentName, description);
+  }
+  return boost::none;
+}
+
 // equality test
 bool SqlFile::operator==(const SqlFile& other) const
 {
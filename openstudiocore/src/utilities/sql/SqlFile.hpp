@@ -784,6 +784,12 @@ class UTILITIES_API SqlFile {
   /// Returns the summary data for each installlocation and fuel type found in report variables
   std::vector<SummaryData> getSummaryData() const;
 
+  /** Returns the value from the Initialization Summary Component Sizing Information table in the row containing both
+   *  componentName (upper case, as reported by EnergyPlus) and description (with units in brackets, e.g. 'Design Size Rated Air Flow Rate [m3/s]').
+   *  The table is read once and indexed by component name on the first call, so this is suitable for looking up every
+   *  autosized field in a model. */
+  boost::optional<double> componentSizingValue(const std::string& componentName, const std::string& description) const;
+
 
   int insertZone(const std::string &t_name,
       double t_relNorth,
@@ -36,6 +36,8 @@
 #include "../core/Containers.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+
 
 
 using boost::multi_index_container;
@@ -56,7 +58,7 @@ namespace openstudio{
     }
 
     SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
-      : m_path(path), m_connectionOpen(false), m_supportedVersion(false), m_hasYear(true)
+      : m_path(path), m_connectionOpen(false), m_supportedVersion(false), m_hasYear(true), m_componentSizingLoaded(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
@@ -67,7 +69,7 @@ namespace openstudio{
 
     SqlFile_Impl::SqlFile_Impl(const openstudio::path &t_path, const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
         const openstudio::Calendar &t_calendar, const bool createIndexes)
-      : m_path(t_path)
+      : m_path(t_path), m_componentSizingLoaded(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
@@ -423,6 +425,9 @@ namespace openstudio{
         sqlite3_close(m_db);
         m_connectionOpen = false;
       }
+      m_componentSizingLoaded = false;
+      m_componentSizingRows.clear();
+      m_componentSizingRowsByCell.clear();
       return true;
     }
 
@@ -757,6 +762,90 @@ namespace openstudio{
       }
     }
 
+    boost::optional<double> SqlFile_Impl::componentSizingValue(const std::string& componentName, const std::string& description) const
+    {
+      if (!m_componentSizingLoaded) {
+        loadComponentSizing();
+      }
+
+      auto it = m_componentSizingRowsByCell.find(componentName);
+      if (it == m_componentSizingRowsByCell.end()) {
+        return boost::none;
+      }
+
+      // first row containing both the component name and the description, as the row by row queries did
+      for (unsigned rowIndex : it->second) {
+        const ComponentSizingRow& row = m_componentSizingRows[rowIndex];
+        if (row.value && (std::find(row.cells.begin(), row.cells.end(), description) != row.cells.end())) {
+          return row.value;
+        }
+      }
+
+      return boost::none;
+    }
+
+    void SqlFile_Impl::loadComponentSizing() const
+    {
+      m_componentSizingLoaded = true;
+      m_componentSizingRows.clear();
+      m_componentSizingRowsByCell.clear();
+
+      if (!m_db) {
+        return;
+      }
+
+      std::string statement = "SELECT RowName, ColumnName, Value FROM tabulardatawithstrings "
+        "WHERE ReportName='Initialization Summary' "
+        "AND ReportForString='Entire Facility' "
+        "AND TableName='Component Sizing Information'";
+
+      sqlite3_stmt* sqlStmtPtr;
+      int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+      if (code != SQLITE_OK) {
+        sqlite3_finalize(sqlStmtPtr);
+        return;
+      }
+
+      std::unordered_map<std::string, unsigned> rowIndices;
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        // any of the columns may be null
+        std::string rowName, columnName, value;
+        if (const unsigned char* text = sqlite3_column_text(sqlStmtPtr, 0)) {
+          rowName = columnText(text);
+        }
+        if (const unsigned char* text = sqlite3_column_text(sqlStmtPtr, 1)) {
+          columnName = columnText(text);
+        }
+        const unsigned char* valueText = sqlite3_column_text(sqlStmtPtr, 2);
+        if (valueText) {
+          value = columnText(valueText);
+        }
+
+        auto inserted = rowIndices.insert(std::make_pair(rowName, static_cast<unsigned>(m_componentSizingRows.size())));
+        if (inserted.second) {
+          m_componentSizingRows.push_back(ComponentSizingRow());
+        }
+        unsigned rowIndex = inserted.first->second;
+        ComponentSizingRow& row = m_componentSizingRows[rowIndex];
+
+        if (columnName == "Value" && !row.value) {
+          row.value = sqlite3_column_double(sqlStmtPtr, 2);
+        }
+
+        // null values never matched the row by row queries
+        if (valueText) {
+          std::vector<unsigned>& cellRows = m_componentSizingRowsByCell[value];
+          if (cellRows.empty() || cellRows.back() != rowIndex) {
+            cellRows.push_back(rowIndex);
+          }
+          row.cells.push_back(value);
+        }
+      }
+
+      // must finalize to prevent memory leaks
+      sqlite3_finalize(sqlStmtPtr);
+    }
+
     std::vector<SummaryData> SqlFile_Impl::getSummaryData() const
     {
       std::vector<SummaryData> retval;
@@ -44,6 +44,7 @@
 #include <boost/optional.hpp>
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio{
@@ -762,6 +763,9 @@ namespace openstudio{
       /// Returns the summary data for each install location and fuel type found in report variables
       std::vector<openstudio::SummaryData> getSummaryData() const;
 
+      /// value from the Initialization Summary Component Sizing Information table for a component name and description with units
+      boost::optional<double> componentSizingValue(const std::string& componentName, const std::string& description) const;
+
       // Insert a new report variable record into the database
       // This does not support meter data
       void insertTimeSeriesData(const std::string &t_variableType, const std::string &t_indexGroup,
@@ -828,6 +832,16 @@ namespace openstudio{
 
       void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
+      // read the Component Sizing Information table into m_componentSizingRows
+      void loadComponentSizing() const;
+
+      // one row of the Component Sizing Information table
+      struct ComponentSizingRow
+      {
+        std::vector<std::string> cells;
+        boost::optional<double> value;
+      };
+
       openstudio::path m_path;
       bool m_connectionOpen;
       DataDictionaryTable m_dataDictionary;
@@ -838,6 +852,11 @@ namespace openstudio{
 
       bool m_hasYear;
 
+      // Component Sizing Information rows and the rows containing each cell value, loaded on first use
+      mutable bool m_componentSizingLoaded;
+      mutable std::vector<ComponentSizingRow> m_componentSizingRows;
+      mutable std::unordered_map<std::string, std::vector<unsigned> > m_componentSizingRowsByCell;
+
       REGISTER_LOGGER("openstudio.energyplus.SqlFile");
     };
 
@@ -575,3 +575,41 @@ TEST_F(SqlFileFixture, SqlFile_LeapYear)
     EXPECT_EQ(original_datetimes, reloaded_datetimes);
   }
 }
+
+TEST_F(SqlFileFixture, ComponentSizingValue)
+{
+  // compare the indexed lookup against querying each row of the table
+  std::string table = "FROM tabulardatawithstrings WHERE ReportName='Initialization Summary' AND ReportForString='Entire Facility' "
+                      "AND TableName='Component Sizing Information' ";
+  boost::optional<std::vector<std::string> > rowNames = sqlFile2.execAndReturnVectorOfString("SELECT DISTINCT RowName " + table);
+  ASSERT_TRUE(rowNames);
+  ASSERT_FALSE(rowNames->empty());
+
+  unsigned numChecked = 0;
+  for (const std::string& rowName : rowNames.get()) {
+    std::string row = "AND RowName='" + rowName + "'";
+    boost::optional<std::string> componentName = sqlFile2.execAndReturnFirstString("SELECT Value " + table + row + " AND ColumnName='Component Name'");
+    boost::optional<std::string> description = sqlFile2.execAndReturnFirstString("SELECT Value " + table + row + " AND ColumnName='Description'");
+    boost::optional<double> value = sqlFile2.execAndReturnFirstDouble("SELECT Value " + table + row + " AND ColumnName='Value'");
+    ASSERT_TRUE(componentName);
+    ASSERT_TRUE(description);
+    ASSERT_TRUE(value);
+
+    // the first row for a component and description wins
+    boost::optional<std::string> firstRowName = sqlFile2.execAndReturnFirstString("SELECT RowName " + table + "AND ColumnName='Component Name' AND Value='" + componentName.get() + "' "
+                                                                                  "AND RowName IN (SELECT RowName " + table + "AND ColumnName='Description' AND Value='" + description.get() + "')");
+    ASSERT_TRUE(firstRowName);
+    if (firstRowName.get() != rowName) {
+      continue;
+    }
+
+    boost::optional<double> indexed = sqlFile2.componentSizingValue(componentName.get(), description.get());
+    ASSERT_TRUE(indexed) << componentName.get() << " " << description.get();
+    EXPECT_EQ(value.get(), indexed.get());
+    ++numChecked;
+  }
+  EXPECT_LT(0u, numChecked);
+
+  EXPECT_FALSE(sqlFile2.componentSizingValue("NOT A COMPONENT", "Design Size Nominal Capacity [W]"));
+  EXPECT_FALSE(sqlFile2.componentSizingValue(rowNames->front(), "Not A Description"));
+}
@@ -45,6 +45,14 @@
 
 #include "../core/Assert.hpp"
 
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <memory>
+
 namespace openstudio {
 
 boost::optional<Quantity> QuantityConverterSingleton::convert(const Quantity &q,
@@ -507,32 +515,185 @@ boost::optional<Quantity> QuantityConverterSingleton::m_convertToTargetFromSI(
   return converted;
 }
 
+namespace {
+
+  /** Conversion between two unit strings, resolved once through UnitFactory and
+   *  QuantityConverter. Unit conversions are affine in the value, so converted = factor * value +
+   *  offset. If a spot check shows otherwise, affine is false and values go through
+   *  QuantityConverter one at a time (still skipping the unit string parsing). */
+  struct ResolvedConversion {
+    Unit originalUnit;
+    Unit finalUnit;
+    double factor;
+    double offset;
+    bool affine;
+  };
+
+  typedef std::shared_ptr<const ResolvedConversion> ResolvedConversionPtr;
+
+  boost::optional<double> convertValue(const ResolvedConversion& conversion, double value) {
+    if (conversion.affine) {
+      return conversion.factor * value + conversion.offset;
+    }
+    boost::optional<Quantity> converted = QuantityConverter::instance().convert(
+        Quantity(value, conversion.originalUnit), conversion.finalUnit);
+    if (converted) {
+      return converted->value();
+    }
+    return boost::none;
+  }
+
+  /** Conversions are probed at plus and minus this value (2^30) to find their factor. Converting 0
+   *  and 1 instead loses the factor's precision to the rounding of a large offset, for C to K
+   *  274.15 - 273.15 is 0.99999999999997726. Scaling by a power of two is exact, so conversions
+   *  without an offset get exactly the factor the Quantity path multiplies by. */
+  const double factorProbe = 1073741824.0;
+
+  ResolvedConversionPtr resolveConversion(const std::string& originalUnits, const std::string& finalUnits) {
+    boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
+    boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+    if (!originalUnit || !finalUnit) {
+      return ResolvedConversionPtr();
+    }
+
+    QuantityConverterSingleton& converter = QuantityConverter::instance();
+    boost::optional<Quantity> atZero = converter.convert(Quantity(0.0, *originalUnit), *finalUnit);
+    boost::optional<Quantity> atPlus = converter.convert(Quantity(factorProbe, *originalUnit), *finalUnit);
+    boost::optional<Quantity> atMinus = converter.convert(Quantity(-factorProbe, *originalUnit), *finalUnit);
+    if (!atZero || !atPlus || !atMinus) {
+      return ResolvedConversionPtr();
+    }
+
+    std::shared_ptr<ResolvedConversion> result = std::make_shared<ResolvedConversion>();
+    result->originalUnit = *originalUnit;
+    result->finalUnit = *finalUnit;
+    result->offset = atZero->value();
+    result->factor = (atPlus->value() - atMinus->value()) / (2.0 * factorProbe);
+
+    // spot check away from the fit points
+    const double checkValue = 100.0;
+    boost::optional<Quantity> atCheck = converter.convert(Quantity(checkValue, *originalUnit), *finalUnit);
+    result->affine = false;
+    if (atCheck) {
+      double expected = result->factor * checkValue + result->offset;
+      result->affine = (std::fabs(atCheck->value() - expected) <= 1.0e-9 * std::max(1.0, std::fabs(atCheck->value())));
+    }
+    if (!result->affine) {
+      LOG_FREE(Debug, "openstudio.units.QuantityConverter", "Conversion from '" << originalUnits << "' to '"
+               << finalUnits << "' is not affine, values will be converted individually.");
+    }
+    return result;
+  }
+
+  /** Least recently used cache of resolved conversions keyed on (originalUnits, finalUnits).
+   *  Failed resolutions are cached too, as a null pointer. */
+  class ConversionCache {
+   public:
+    static ConversionCache& instance() {
+      static auto cache = new ConversionCache();
+      return *cache;
+    }
+
+    ResolvedConversionPtr find(const std::string& originalUnits, const std::string& finalUnits) {
+      Key key(originalUnits, finalUnits);
+      {
+        boost::lock_guard<boost::mutex> l(m_mutex);
+        auto it = m_index.find(key);
+        if (it != m_index.end()) {
+          m_entries.splice(m_entries.begin(), m_entries, it->second);
+          return it->second->second;
+        }
+      }
+
+      // resolve outside of the lock, UnitFactory and QuantityConverter do their own work
+      ResolvedConversionPtr resolved = resolveConversion(originalUnits, finalUnits);
+
+      boost::lock_guard<boost::mutex> l(m_mutex);
+      if (m_index.find(key) == m_index.end()) {
+        m_entries.push_front(Entry(key, resolved));
+        m_index[key] = m_entries.begin();
+        if (m_entries.size() > maxEntries) {
+          m_index.erase(m_entries.back().first);
+          m_entries.pop_back();
+        }
+      }
+      return resolved;
+    }
+
+   private:
+    typedef std::pair<std::string, std::string> Key;
+    typedef std::pair<Key, ResolvedConversionPtr> Entry;
+
+    static const size_t maxEntries = 256;
+
+    boost::mutex m_mutex;
+    std::list<Entry> m_entries;
+    std::map<Key, std::list<Entry>::iterator> m_index;
+  };
+
+  /** Applies offset + factor * value to each value of original in one pass, where offset,
+   *  atPlus and atMinus are the conversions of 0, factorProbe and -factorProbe in original's units. */
+  OSQuantityVector applyConversion(const OSQuantityVector& original,
+                                   const Quantity& offset,
+                                   const Quantity& atPlus,
+                                   const Quantity& atMinus)
+  {
+    OS_ASSERT(offset.units() == atPlus.units());
+    OS_ASSERT(offset.units() == atMinus.units());
+    double factor = (atPlus.value() - atMinus.value()) / (2.0 * factorProbe);
+    double offsetValue = offset.value();
+    std::vector<double> values = original.values();
+    for (double& value : values) {
+      value = factor * value + offsetValue;
+    }
+    return OSQuantityVector(offset.units(), values);
+  }
+
+} // anonymous namespace
+
 boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits)
 {
   if (originalUnits == finalUnits){
     return original;
   }
 
-  //create the units from the strings
-  boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
-  boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
-
-  //make sure both unit strings were valid
-  if (originalUnit && finalUnit) {
+  ResolvedConversionPtr conversion = ConversionCache::instance().find(originalUnits, finalUnits);
+  if (!conversion) {
+    return boost::none;
+  }
+  return convertValue(*conversion, original);
+}
 
-    //make the original quantity
-    Quantity originalQuant = Quantity(original, *originalUnit);
+boost::optional<std::vector<double> > convert(const std::vector<double>& original,
+                                              const std::string& originalUnits,
+                                              const std::string& finalUnits)
+{
+  if (originalUnits == finalUnits){
+    return original;
+  }
 
-    //convert to final units
-    boost::optional<Quantity> finalQuant = QuantityConverter::instance().convert(originalQuant, *finalUnit);
+  ResolvedConversionPtr conversion = ConversionCache::instance().find(originalUnits, finalUnits);
+  if (!conversion) {
+    return boost::none;
+  }
 
-    //if the conversion
-    if (finalQuant) {
-      return finalQuant->value();
+  std::vector<double> result(original.size());
+  if (conversion->affine) {
+    const double factor = conversion->factor;
+    const double offset = conversion->offset;
+    for (size_t i = 0, n = original.size(); i < n; ++i) {
+      result[i] = factor * original[i] + offset;
+    }
+  } else {
+    for (size_t i = 0, n = original.size(); i < n; ++i) {
+      boost::optional<double> value = convertValue(*conversion, original[i]);
+      if (!value) {
+        return boost::none;
+      }
+      result[i] = *value;
     }
   }
-
-  return boost::none;
+  return result;
 }
 
 boost::optional<Quantity> convert(const Quantity &q, UnitSystem sys) {
@@ -546,13 +707,13 @@ OSQuantityVector convert(const OSQuantityVector& original, UnitSystem sys) {
   if (!offset) {
     return result;
   }
-  testQuantity.setValue(1.0);
-  OptionalQuantity factorPlusOffset = convert(testQuantity,sys);
-  OS_ASSERT(factorPlusOffset);
-  OS_ASSERT(offset->units() == factorPlusOffset->units());
-  result = OSQuantityVector(offset->units(),original.values());
-  result = result * (factorPlusOffset->value() - offset->value()) + offset.get();
-  return result;
+  testQuantity.setValue(factorProbe);
+  OptionalQuantity atPlus = convert(testQuantity,sys);
+  OS_ASSERT(atPlus);
+  testQuantity.setValue(-factorProbe);
+  OptionalQuantity atMinus = convert(testQuantity,sys);
+  OS_ASSERT(atMinus);
+  return applyConversion(original, *offset, *atPlus, *atMinus);
 }
 
 boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUnits) {
@@ -566,13 +727,13 @@ OSQuantityVector convert(const OSQuantityVector& original, const Unit& targetUni
   if (!offset) {
     return result;
   }
-  testQuantity.setValue(1.0);
-  OptionalQuantity factorPlusOffset = convert(testQuantity,targetUnits);
-  OS_ASSERT(factorPlusOffset);
-  OS_ASSERT(offset->units() == factorPlusOffset->units());
-  result = OSQuantityVector(offset->units(),original.values());
-  result = result * (factorPlusOffset->value() - offset->value()) + offset.get();
-  return result;
+  testQuantity.setValue(factorProbe);
+  OptionalQuantity atPlus = convert(testQuantity,targetUnits);
+  OS_ASSERT(atPlus);
+  testQuantity.setValue(-factorProbe);
+  OptionalQuantity atMinus = convert(testQuantity,targetUnits);
+  OS_ASSERT(atMinus);
+  return applyConversion(original, *offset, *atPlus, *atMinus);
 }
 
 }// namespace openstudio
@@ -37,6 +37,7 @@
 #include "Unit.hpp"
 #include <string>
 #include <map>
+#include <vector>
 
 class QDomElement;
 
@@ -118,9 +119,18 @@ class UTILITIES_API QuantityConverterSingleton {
 /** \relates QuantityConverterSingleton */
 typedef openstudio::Singleton<QuantityConverterSingleton> QuantityConverter;
 
-/** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
+/** Non-member function to simplify interface for users. The unit strings are resolved to an
+ *  affine factor and offset once and kept in a small LRU cache, so repeated calls with the same
+ *  pair of unit strings do not re-parse the units. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits);
 
+/** Non-member function that converts every value in original from originalUnits to finalUnits
+ *  using a single cached conversion. Returns boost::none if the units cannot be converted.
+ *  \relates QuantityConverterSingleton */
+UTILITIES_API boost::optional<std::vector<double> > convert(const std::vector<double>& original,
+                                                            const std::string& originalUnits,
+                                                            const std::string& finalUnits);
+
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys);
 
@@ -8,6 +8,8 @@
 // hide shared_ptrs, expose helper functions
 %ignore QuantityConverterSingleton;
 %ignore QuantityConverter;
+// optional vector return is not wrapped, use OSQuantityVector instead
+%ignore openstudio::convert(const std::vector<double>&, const std::string&, const std::string&);
 %include <utilities/units/QuantityConverter.hpp>
 
 #endif // UTILITIES_UNITS_QUANTITYCONVERTER_I
@@ -44,6 +44,11 @@
 #include "../SIUnit.hpp"
 #include "../Unit.hpp"
 
+#include "../../core/Optional.hpp"
+
+#include <algorithm>
+#include <cmath>
+
 using namespace openstudio;
 
 TEST_F(UnitsFixture, QuantityConverter_IPandSIUsingSystem)
@@ -258,6 +263,83 @@ TEST_F(UnitsFixture,QuantityConverter_OSQuantityVector) {
   EXPECT_TRUE(resultQ->isRelative());
 }
 
+TEST_F(UnitsFixture,QuantityConverter_StringUnits) {
+  // scalar and vector conversions agree with the Quantity path
+  std::vector<double> values;
+  for (int i = -5; i <= 5; ++i) {
+    values.push_back(37.5 * i);
+  }
+
+  Unit ft2 = createUnit("ft^2").get();
+  Unit m2 = createUnit("m^2").get();
+  boost::optional<std::vector<double> > areas = convert(values, "ft^2", "m^2");
+  ASSERT_TRUE(areas);
+  ASSERT_EQ(values.size(), areas->size());
+  for (unsigned i = 0, n = values.size(); i < n; ++i) {
+    OptionalQuantity expected = convert(Quantity(values[i], ft2), m2);
+    ASSERT_TRUE(expected);
+    EXPECT_NEAR(expected->value(), (*areas)[i], 1.0E-12 * std::max(1.0, std::fabs(expected->value())));
+    OptionalDouble scalar = convert(values[i], "ft^2", "m^2");
+    ASSERT_TRUE(scalar);
+    EXPECT_DOUBLE_EQ((*areas)[i], *scalar);
+  }
+
+  // affine conversion, repeated to exercise the cached path
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    OptionalDouble f = convert(100.0, "C", "F");
+    ASSERT_TRUE(f);
+    EXPECT_NEAR(212.0, *f, 1.0E-10);
+    OptionalDouble c = convert(32.0, "F", "C");
+    ASSERT_TRUE(c);
+    EXPECT_NEAR(0.0, *c, 1.0E-10);
+  }
+
+  // same units are passed through untouched
+  boost::optional<std::vector<double> > same = convert(values, "W", "W");
+  ASSERT_TRUE(same);
+  EXPECT_EQ(values, *same);
+
+  // bad units fail every time, not just on the first call
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    EXPECT_FALSE(convert(1.0, "W", "m"));
+    EXPECT_FALSE(convert(values, "W", "m"));
+    EXPECT_FALSE(convert(1.0, "notaunit", "m"));
+  }
+
+  // an empty vector converts to an empty vector
+  boost::optional<std::vector<double> > empty = convert(std::vector<double>(), "ft", "m");
+  ASSERT_TRUE(empty);
+  EXPECT_TRUE(empty->empty());
+}
+
+TEST_F(UnitsFixture,QuantityConverter_OffsetConversionsMatchQuantityPath) {
+  // the cached and vector paths give exactly what converting each Quantity gives
+  Unit c = createUnit("C").get();
+  Unit k = createUnit("K").get();
+  std::vector<double> values{-273.15, -40.0, -17.3, 0.0, 0.1, 1.0, 21.7, 100.0, 1234.5678};
+
+  boost::optional<std::vector<double> > kelvins = convert(values, "C", "K");
+  ASSERT_TRUE(kelvins);
+  ASSERT_EQ(values.size(), kelvins->size());
+  OSQuantityVector kelvinVec = convert(OSQuantityVector(c, values), k);
+  ASSERT_EQ(values.size(), kelvinVec.size());
+  for (unsigned i = 0, n = values.size(); i < n; ++i) {
+    OptionalQuantity expected = convert(Quantity(values[i], c), k);
+    ASSERT_TRUE(expected);
+    OptionalDouble scalar = convert(values[i], "C", "K");
+    ASSERT_TRUE(scalar);
+    EXPECT_EQ(expected->value(), *scalar) << values[i];
+    EXPECT_EQ(expected->value(), (*kelvins)[i]) << values[i];
+    EXPECT_EQ(expected->value(), kelvinVec.values()[i]) << values[i];
+
+    expected = convert(Quantity(values[i], k), c);
+    ASSERT_TRUE(expected);
+    scalar = convert(values[i], "K", "C");
+    ASSERT_TRUE(scalar);
+    EXPECT_EQ(expected->value(), *scalar) << values[i];
+  }
+}
+
 TEST_F(UnitsFixture,QuantityConverter_Profiling_QuantityVectorBaseCase) {
   QuantityVector result(testQuantityVector);
   for (auto & elem : result) {